@@ -0,0 +1,86 @@
+dnl -*- shell-script -*-
+dnl
+dnl Copyright (c) 2021      Nanook Consulting.  All rights reserved.
+dnl $COPYRIGHT$
+dnl
+dnl Additional copyrights may follow
+dnl
+dnl $HEADER$
+dnl
+dnl Check whether the compiler can build the hardware-accelerated
+dnl CRC32C and checksum kernels used by src/util/crc.c. The kernels
+dnl are compiled with per-function target attributes and selected at
+dnl runtime, so no special CFLAGS are required and the resulting
+dnl library still runs on hosts that lack the instructions.
+
+# PRTE_CHECK_CRC_KERNELS()
+# ------------------------
+AC_DEFUN([PRTE_CHECK_CRC_KERNELS],[
+    AC_ARG_ENABLE([crc-kernels],
+                  [AS_HELP_STRING([--disable-crc-kernels],
+                                  [Do not build the SSE4.2/AVX2/ARMv8 CRC32C and checksum kernels (default: enabled)])])
+
+    prte_crc_sse42=0
+    prte_crc_avx2=0
+    prte_crc_armv8=0
+
+    AS_IF([test "$enable_crc_kernels" != "no"],
+          [AC_CACHE_CHECK([for SSE4.2 CRC32C intrinsics],
+                          [prte_cv_crc_kernels_sse42],
+                          [AC_LINK_IFELSE([AC_LANG_PROGRAM([[
+#include <stdint.h>
+#include <nmmintrin.h>
+__attribute__((target("sse4.2")))
+static uint32_t crc(uint32_t c, uint64_t v) { return (uint32_t) _mm_crc32_u64(c, v); }
+]], [[
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse4.2") ? (int) crc(0, 1) : 0;
+]])],
+                                          [prte_cv_crc_kernels_sse42=yes],
+                                          [prte_cv_crc_kernels_sse42=no])])
+           AS_IF([test "$prte_cv_crc_kernels_sse42" = "yes"], [prte_crc_sse42=1])
+
+           AC_CACHE_CHECK([for AVX2 integer intrinsics],
+                          [prte_cv_crc_kernels_avx2],
+                          [AC_LINK_IFELSE([AC_LANG_PROGRAM([[
+#include <immintrin.h>
+__attribute__((target("avx2")))
+static long long sum(const long long *src)
+{
+    long long lanes[4];
+    __m256i acc = _mm256_setzero_si256();
+    acc = _mm256_add_epi64(acc, _mm256_loadu_si256((const __m256i *) src));
+    _mm256_storeu_si256((__m256i *) lanes, acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+]], [[
+    long long src[4] = {1, 2, 3, 4};
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") ? (int) sum(src) : 0;
+]])],
+                                          [prte_cv_crc_kernels_avx2=yes],
+                                          [prte_cv_crc_kernels_avx2=no])])
+           AS_IF([test "$prte_cv_crc_kernels_avx2" = "yes"], [prte_crc_avx2=1])
+
+           AC_CACHE_CHECK([for ARMv8 CRC32 intrinsics],
+                          [prte_cv_crc_kernels_armv8],
+                          [AC_LINK_IFELSE([AC_LANG_PROGRAM([[
+#include <stdint.h>
+#include <sys/auxv.h>
+#include <arm_acle.h>
+__attribute__((target("+crc")))
+static uint32_t crc(uint32_t c, uint64_t v) { return __crc32cd(c, v); }
+]], [[
+    return (getauxval(AT_HWCAP) & HWCAP_CRC32) ? (int) crc(0, 1) : 0;
+]])],
+                                          [prte_cv_crc_kernels_armv8=yes],
+                                          [prte_cv_crc_kernels_armv8=no])])
+           AS_IF([test "$prte_cv_crc_kernels_armv8" = "yes"], [prte_crc_armv8=1])])
+
+    AC_DEFINE_UNQUOTED([PRTE_HAVE_CRC32C_SSE42], [$prte_crc_sse42],
+                       [Whether the SSE4.2 CRC32C kernel can be built])
+    AC_DEFINE_UNQUOTED([PRTE_HAVE_CSUM_AVX2], [$prte_crc_avx2],
+                       [Whether the AVX2 checksum kernels can be built])
+    AC_DEFINE_UNQUOTED([PRTE_HAVE_CRC32C_ARMV8], [$prte_crc_armv8],
+                       [Whether the ARMv8 CRC32C kernel can be built])
+])
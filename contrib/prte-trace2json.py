@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2021      Nanook Consulting.  All rights reserved.
+# $COPYRIGHT$
+#
+# Additional copyrights may follow
+#
+# $HEADER$
+#
+# Convert the binary trace files written when PRTE runs with
+# "--prtemca prte_trace 1" into Chrome trace / Perfetto JSON:
+#
+#     prte-trace2json.py /tmp/prte-trace.*.bin > trace.json
+#
+# Each file becomes one process in the viewer (named after its host
+# and rank) and each of its rings one thread. Timestamps from all
+# files are placed on a common wall-clock axis.
+
+import json
+import struct
+import sys
+
+# keep in sync with prte_trace_event_id_t in src/util/trace.h
+EVENTS = {
+    1: ('job_state', 'i', 'state', 'jobid'),
+    2: ('proc_state', 'i', 'state', 'rank'),
+    3: ('rml_send', 'i', 'tag', 'peer'),
+    4: ('rml_recv', 'i', 'tag', 'peer'),
+    5: ('xcast', 'i', 'tag', 'bytes'),
+    6: ('allgather', 'B', 'sigsize', 'bytes'),
+    7: ('allgather', 'E', 'sigsize', 'bytes'),
+    8: ('fork', 'B', 'unused', 'rank'),
+    9: ('fork', 'E', 'pid', 'rank'),
+    10: ('iof_read', 'i', 'channel', 'bytes'),
+    11: ('iof_write', 'i', 'fd', 'bytes'),
+}
+
+FILE_HDR = struct.Struct('=8sIIIIQ256s64s')
+RING_HDR = struct.Struct('=IIQ')
+RECORD = struct.Struct('=QIIQ')
+MAGIC = b'PRTETRC1'
+
+
+def cstr(b):
+    return b.split(b'\0', 1)[0].decode('utf-8', 'replace')
+
+
+def convert(path, out):
+    with open(path, 'rb') as f:
+        data = f.read()
+    magic, version, rank, nrings, recsize, epoch, nspace, host = \
+        FILE_HDR.unpack_from(data, 0)
+    if magic != MAGIC or version != 1 or recsize != RECORD.size:
+        sys.stderr.write('%s: not a PRTE trace file\n' % path)
+        return
+    pid = '%s:%d' % (cstr(nspace), rank)
+    out.append({'ph': 'M', 'name': 'process_name', 'pid': pid,
+                'args': {'name': '%s rank %d' % (cstr(host), rank)}})
+    off = FILE_HDR.size
+    for _ in range(nrings):
+        ring, nrecords, dropped = RING_HDR.unpack_from(data, off)
+        off += RING_HDR.size
+        if dropped:
+            sys.stderr.write('%s: ring %d dropped %d records\n' % (path, ring, dropped))
+        for _ in range(nrecords):
+            ts, event, arg0, arg1 = RECORD.unpack_from(data, off)
+            off += RECORD.size
+            name, ph, a0, a1 = EVENTS.get(event, ('event%d' % event, 'i', 'arg0', 'arg1'))
+            ev = {'name': name, 'ph': ph, 'pid': pid, 'tid': ring,
+                  'ts': (epoch + ts) / 1000.0, 'args': {a0: arg0, a1: arg1}}
+            if 'i' == ph:
+                ev['s'] = 't'
+            out.append(ev)
+
+
+def main():
+    if 2 > len(sys.argv):
+        sys.stderr.write('usage: %s trace-file [trace-file ...]\n' % sys.argv[0])
+        return 1
+    events = []
+    for path in sys.argv[1:]:
+        convert(path, events)
+    json.dump({'traceEvents': events, 'displayTimeUnit': 'ns'}, sys.stdout)
+    sys.stdout.write('\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -208,6 +208,7 @@ extern char *prte_hwloc_print_null;
 PRTE_EXPORT char *prte_hwloc_base_print_locality(prte_hwloc_locality_t locality);
 
 PRTE_EXPORT extern char *prte_hwloc_base_topo_file;
+PRTE_EXPORT extern char *prte_hwloc_base_topo_cache_dir;
 
 /* convenience macro for debugging */
 #define PRTE_HWLOC_SHOW_BINDING(n, v, t)                                                        \
@@ -397,6 +398,12 @@ PRTE_EXPORT prte_hwloc_locality_t prte_hwloc_compute_relative_locality(char *loc
 PRTE_EXPORT int prte_hwloc_base_topology_export_xmlbuffer(hwloc_topology_t topology, char **xmlpath,
                                                           int *buflen);
 
+/* retrieve/record a topology in the on-disk cache kept in the
+ * prte_hwloc_base_topo_cache_dir directory. The topology returned
+ * by the retrieve function belongs to the caller. */
+PRTE_EXPORT hwloc_topology_t prte_hwloc_base_get_cached_topology(const char *sig);
+PRTE_EXPORT void prte_hwloc_base_cache_topology(const char *sig, hwloc_topology_t topo);
+
 PRTE_EXPORT int prte_hwloc_base_topology_set_flags(hwloc_topology_t topology, unsigned long flags,
                                                    bool io);
 
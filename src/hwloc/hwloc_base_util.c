@@ -49,11 +49,13 @@
 #endif
 
 #include "src/include/constants.h"
+#include "src/include/hash_string.h"
 #include "src/pmix/pmix-internal.h"
 #include "src/runtime/prte_globals.h"
 #include "src/threads/tsd.h"
 #include "src/util/argv.h"
 #include "src/util/os_dirpath.h"
+#include "src/util/os_path.h"
 #include "src/util/output.h"
 #include "src/util/printf.h"
 #include "src/util/proc_info.h"
@@ -2083,6 +2085,106 @@ int prte_hwloc_base_topology_set_flags(hwloc_topology_t topology, unsigned long
     return hwloc_topology_set_flags(topology, flags);
 }
 
+static char *cache_file_name(const char *sig)
+{
+    uint32_t h;
+    char *fname, *path;
+
+    PRTE_HASH_STR(sig, h);
+    prte_asprintf(&fname, "topo-%08x.xml", h);
+    path = prte_os_path(false, prte_hwloc_base_topo_cache_dir, fname, NULL);
+    free(fname);
+    return path;
+}
+
+/* Each cache file holds the signature of the topology on its first
+ * line followed by the topology's XML - the signature is checked
+ * on retrieval to protect against hash collisions */
+hwloc_topology_t prte_hwloc_base_get_cached_topology(const char *sig)
+{
+    char *path, *buf = NULL, *xml;
+    FILE *fp;
+    long len;
+    hwloc_topology_t topo = NULL;
+
+    if (NULL == prte_hwloc_base_topo_cache_dir || NULL == sig) {
+        return NULL;
+    }
+    path = cache_file_name(sig);
+    fp = fopen(path, "r");
+    free(path);
+    if (NULL == fp) {
+        return NULL;
+    }
+    if (0 != fseek(fp, 0, SEEK_END) || 0 >= (len = ftell(fp)) || 0 != fseek(fp, 0, SEEK_SET)) {
+        goto done;
+    }
+    buf = (char *) malloc(len + 1);
+    if (NULL == buf || (size_t) len != fread(buf, 1, len, fp)) {
+        goto done;
+    }
+    buf[len] = '\0';
+    if (NULL == (xml = strchr(buf, '\n'))) {
+        goto done;
+    }
+    *xml = '\0';
+    ++xml;
+    if (0 != strcmp(buf, sig)) {
+        goto done;
+    }
+
+    if (0 != hwloc_topology_init(&topo)) {
+        topo = NULL;
+        goto done;
+    }
+    if (0 != hwloc_topology_set_xmlbuffer(topo, xml, strlen(xml) + 1)
+        || 0 != prte_hwloc_base_topology_set_flags(topo, 0, true)
+        || 0 != hwloc_topology_load(topo)) {
+        hwloc_topology_destroy(topo);
+        topo = NULL;
+        goto done;
+    }
+    prte_output_verbose(5, prte_hwloc_base_output,
+                        "hwloc:base:get_cached_topology found topology for signature %s", sig);
+
+done:
+    if (NULL != buf) {
+        free(buf);
+    }
+    fclose(fp);
+    return topo;
+}
+
+void prte_hwloc_base_cache_topology(const char *sig, hwloc_topology_t topo)
+{
+    char *path, *tmp, *xml = NULL;
+    int len;
+    FILE *fp;
+
+    if (NULL == prte_hwloc_base_topo_cache_dir || NULL == sig || NULL == topo) {
+        return;
+    }
+    if (PRTE_SUCCESS != prte_os_dirpath_create(prte_hwloc_base_topo_cache_dir, S_IRWXU)) {
+        return;
+    }
+    if (0 != prte_hwloc_base_topology_export_xmlbuffer(topo, &xml, &len)) {
+        return;
+    }
+    path = cache_file_name(sig);
+    /* write to a temporary file and move it into place so that
+     * concurrent readers never see a partial entry */
+    prte_asprintf(&tmp, "%s.%lu", path, (unsigned long) getpid());
+    if (NULL != (fp = fopen(tmp, "w"))) {
+        fprintf(fp, "%s\n%s", sig, xml);
+        if (0 != fclose(fp) || 0 != rename(tmp, path)) {
+            unlink(tmp);
+        }
+    }
+    hwloc_free_xmlbuffer(topo, xml);
+    free(tmp);
+    free(path);
+}
+
 #define PRTE_HWLOC_MAX_STRING 2048
 
 static void print_hwloc_obj(char **output, char *prefix, hwloc_topology_t topo, hwloc_obj_t obj)
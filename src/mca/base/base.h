@@ -72,6 +72,7 @@ PRTE_EXPORT PRTE_CLASS_DECLARATION(prte_mca_base_component_priority_list_item_t)
  * Public variables
  */
 PRTE_EXPORT extern char *prte_mca_base_component_path;
+PRTE_EXPORT extern char *prte_mca_base_component_cache;
 PRTE_EXPORT extern bool prte_mca_base_component_show_load_errors;
 PRTE_EXPORT extern bool prte_mca_base_component_track_load_errors;
 PRTE_EXPORT extern bool prte_mca_base_component_disable_dlopen;
@@ -36,6 +36,9 @@
 #ifdef HAVE_UNISTD_H
 #    include <unistd.h>
 #endif
+#ifdef HAVE_SYS_STAT_H
+#    include <sys/stat.h>
+#endif
 
 #include "constants.h"
 #include "src/class/prte_hash_table.h"
@@ -44,8 +47,11 @@
 #include "src/mca/base/prte_mca_base_component_repository.h"
 #include "src/mca/mca.h"
 #include "src/mca/prtedl/base/base.h"
+#include "src/util/argv.h"
 #include "src/util/basename.h"
+#include "src/util/output.h"
 #include "src/util/printf.h"
+#include "src/util/proc_info.h"
 #include "src/util/string_copy.h"
 
 #if PRTE_HAVE_DL_SUPPORT
@@ -199,11 +205,20 @@ static int file_exists(const char *filename, const char *ext)
     return (0 == ret);
 }
 
-#endif /* PRTE_HAVE_DL_SUPPORT */
+/* resolve the special directory names allowed in the component path */
+static char *resolve_dir(char *dir)
+{
+    if (0 == strcmp(dir, "USER_DEFAULT") || 0 == strcmp(dir, "USR_DEFAULT")) {
+        return prte_mca_base_user_default_path;
+    }
+    if (0 == strcmp(dir, "SYS_DEFAULT") || 0 == strcmp(dir, "SYSTEM_DEFAULT")) {
+        return prte_mca_base_system_default_path;
+    }
+    return dir;
+}
 
-int prte_mca_base_component_repository_add(const char *path)
+static int scan_path(const char *path, int (*cbfunc)(const char *filename, void *data), void *data)
 {
-#if PRTE_HAVE_DL_SUPPORT
     char *path_to_use = NULL, *dir, *ctx;
     const char sep[] = {PRTE_ENV_SEP, '\0'};
 
@@ -216,28 +231,193 @@ int prte_mca_base_component_repository_add(const char *path)
 
     dir = strtok_r(path_to_use, sep, &ctx);
     do {
-        if (0 == strcmp(dir, "USER_DEFAULT") || 0 == strcmp(dir, "USR_DEFAULT")) {
-            if (NULL == prte_mca_base_user_default_path) {
-                continue;
-            }
-            dir = prte_mca_base_user_default_path;
-        } else if (0 == strcmp(dir, "SYS_DEFAULT") || 0 == strcmp(dir, "SYSTEM_DEFAULT")) {
-            if (NULL == prte_mca_base_system_default_path) {
-                continue;
-            }
-            dir = prte_mca_base_system_default_path;
+        if (NULL == (dir = resolve_dir(dir))) {
+            continue;
         }
 
-        if (0 != prte_dl_foreachfile(dir, process_repository_item, NULL)) {
+        if (0 != prte_dl_foreachfile(dir, cbfunc, data)) {
             break;
         }
     } while (NULL != (dir = strtok_r(NULL, sep, &ctx)));
 
     free(path_to_use);
 
+    return PRTE_SUCCESS;
+}
+
+/*
+ * Component cache
+ *
+ * The cache file records the plugin files found by scanning the
+ * component path, preceded by one line per directory in the path
+ * giving its modification time and size:
+ *
+ *     prte-component-cache 1
+ *     D <dir> <mtime> <size>
+ *     F <plugin file>
+ *
+ * A process reading the cache recomputes the directory lines and
+ * only uses the recorded files if they all match - otherwise it
+ * falls back to scanning the path.
+ */
+#    define PRTE_MCA_BASE_CACHE_MAGIC "prte-component-cache 1"
+
+static char **cache_dir_keys(const char *path)
+{
+    char **keys = NULL, *path_to_use, *dir, *ctx, *tmp;
+    const char sep[] = {PRTE_ENV_SEP, '\0'};
+    struct stat st;
+
+    path_to_use = strdup(path);
+    for (dir = strtok_r(path_to_use, sep, &ctx); NULL != dir; dir = strtok_r(NULL, sep, &ctx)) {
+        if (NULL == (dir = resolve_dir(dir))) {
+            continue;
+        }
+        if (0 != stat(dir, &st)) {
+            prte_asprintf(&tmp, "D %s - -", dir);
+        } else {
+            prte_asprintf(&tmp, "D %s %ld %ld", dir, (long) st.st_mtime, (long) st.st_size);
+        }
+        prte_argv_append_nosize(&keys, tmp);
+        free(tmp);
+    }
+    free(path_to_use);
+    return keys;
+}
+
+static char *cache_getline(FILE *fp)
+{
+    char input[PRTE_PATH_MAX + 64];
+    size_t len;
+
+    if (NULL == fgets(input, sizeof(input), fp)) {
+        return NULL;
+    }
+    len = strlen(input);
+    if (0 < len && '\n' == input[len - 1]) {
+        input[len - 1] = '\0';
+    }
+    return strdup(input);
+}
+
+static int load_cache(const char *path)
+{
+    FILE *fp;
+    char **keys, **files = NULL, *line;
+    int nkeys = 0, ret = PRTE_ERR_NOT_FOUND, n;
+
+    if (NULL == (fp = fopen(prte_mca_base_component_cache, "r"))) {
+        return PRTE_ERR_NOT_FOUND;
+    }
+    keys = cache_dir_keys(path);
+
+    line = cache_getline(fp);
+    if (NULL == line || 0 != strcmp(line, PRTE_MCA_BASE_CACHE_MAGIC)) {
+        goto done;
+    }
+    free(line);
+    while (NULL != (line = cache_getline(fp))) {
+        if ('D' == line[0]) {
+            if (NULL == keys || NULL == keys[nkeys] || 0 != strcmp(line, keys[nkeys])) {
+                goto done;
+            }
+            ++nkeys;
+        } else if ('F' == line[0] && ' ' == line[1]) {
+            prte_argv_append_nosize(&files, &line[2]);
+        }
+        free(line);
+    }
+    if (nkeys != prte_argv_count(keys)) {
+        goto done;
+    }
+
+    /* the directories are unchanged - use the recorded files */
+    ret = PRTE_SUCCESS;
+    for (n = 0; NULL != files && NULL != files[n]; n++) {
+        if (PRTE_SUCCESS != (ret = process_repository_item(files[n], NULL))) {
+            break;
+        }
+    }
+    prte_output_verbose(PRTE_MCA_BASE_VERBOSE_COMPONENT, 0,
+                        "mca: base: component_repository: read %d plugin files from cache %s", n,
+                        prte_mca_base_component_cache);
+
+done:
+    if (NULL != line) {
+        free(line);
+    }
+    fclose(fp);
+    prte_argv_free(keys);
+    prte_argv_free(files);
+    return ret;
+}
+
+static int record_repository_item(const char *filename, void *data)
+{
+    char ***files = (char ***) data;
+
+    prte_argv_append_nosize(files, filename);
+    return process_repository_item(filename, NULL);
+}
+
+static void write_cache(const char *path, char **files)
+{
+    FILE *fp;
+    char **keys, *tmp;
+    int n;
+
+    prte_asprintf(&tmp, "%s.%lu", prte_mca_base_component_cache, (unsigned long) getpid());
+    if (NULL == (fp = fopen(tmp, "w"))) {
+        free(tmp);
+        return;
+    }
+    keys = cache_dir_keys(path);
+    fprintf(fp, "%s\n", PRTE_MCA_BASE_CACHE_MAGIC);
+    for (n = 0; NULL != keys && NULL != keys[n]; n++) {
+        fprintf(fp, "%s\n", keys[n]);
+    }
+    for (n = 0; NULL != files && NULL != files[n]; n++) {
+        fprintf(fp, "F %s\n", files[n]);
+    }
+    prte_argv_free(keys);
+    /* move it into place in one step so readers never see a partial file */
+    if (0 != fclose(fp) || 0 != rename(tmp, prte_mca_base_component_cache)) {
+        unlink(tmp);
+    }
+    free(tmp);
+}
+
+static int cached_add(const char *path)
+{
+    char **files = NULL;
+    int ret;
+
+    if (NULL == prte_mca_base_component_cache || NULL == path) {
+        return prte_mca_base_component_repository_add(path);
+    }
+    if (PRTE_SUCCESS == load_cache(path)) {
+        return PRTE_SUCCESS;
+    }
+    if (!PRTE_PROC_IS_MASTER) {
+        return prte_mca_base_component_repository_add(path);
+    }
+    ret = scan_path(path, record_repository_item, &files);
+    if (PRTE_SUCCESS == ret) {
+        write_cache(path, files);
+    }
+    prte_argv_free(files);
+    return ret;
+}
+
 #endif /* PRTE_HAVE_DL_SUPPORT */
 
+int prte_mca_base_component_repository_add(const char *path)
+{
+#if PRTE_HAVE_DL_SUPPORT
+    return scan_path(path, process_repository_item, NULL);
+#else
     return PRTE_SUCCESS;
+#endif /* PRTE_HAVE_DL_SUPPORT */
 }
 
 /*
@@ -269,7 +449,7 @@ int prte_mca_base_component_repository_init(void)
             return ret;
         }
 
-        ret = prte_mca_base_component_repository_add(prte_mca_base_component_path);
+        ret = cached_add(prte_mca_base_component_path);
         if (PRTE_SUCCESS != ret) {
             prte_output(0, "ERROR ON REPO ADD");
             PRTE_DESTRUCT(&prte_mca_base_component_repository);
@@ -53,6 +53,7 @@
  * Public variables
  */
 char *prte_mca_base_component_path = NULL;
+char *prte_mca_base_component_cache = NULL;
 int prte_mca_base_opened = 0;
 char *prte_mca_base_system_default_path = NULL;
 char *prte_mca_base_user_default_path = NULL;
@@ -115,6 +116,16 @@ int prte_mca_base_open(void)
                                &prte_mca_base_component_path);
     free(value);
 
+    prte_mca_base_component_cache = NULL;
+    prte_mca_base_var_register("prte", "mca", "base", "component_cache",
+                               "File used to cache the list of components found in the component "
+                               "path. The DVM master writes it after scanning the path; daemons "
+                               "read it instead of scanning the path themselves when the "
+                               "component directories are unchanged",
+                               PRTE_MCA_BASE_VAR_TYPE_STRING, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE,
+                               PRTE_INFO_LVL_9, PRTE_MCA_BASE_VAR_SCOPE_READONLY,
+                               &prte_mca_base_component_cache);
+
     prte_mca_base_component_show_load_errors = (bool) PRTE_SHOW_LOAD_ERRORS_DEFAULT;
     prte_mca_base_var_register("prte", "mca", "base", "component_show_load_errors",
                                "Whether to show errors for components that failed to load or not",
@@ -82,7 +82,7 @@ static prte_errmgr_detector_t prte_errmgr_world_detector = {0};
 /*
  * Local functions
  */
-static int fd_heartbeat_request(prte_errmgr_detector_t *detector);
+static void fd_update_observing(prte_errmgr_detector_t *detector);
 static void fd_heartbeat_send(prte_errmgr_detector_t *detector);
 
 static void fd_heartbeat_request_cb(int status, pmix_proc_t *sender, pmix_data_buffer_t *buffer,
@@ -250,48 +250,112 @@ static int init(void)
     return PRTE_SUCCESS;
 }
 
+static void fd_send(pmix_rank_t vpid, prte_rml_tag_t tag, pmix_data_buffer_t *buffer)
+{
+    pmix_proc_t daemon;
+    int rc;
+
+    PMIX_LOAD_PROCID(&daemon, prte_process_info.myproc.nspace, vpid);
+    if (0 > (rc = prte_rml.send_buffer_nb(&daemon, buffer, tag, prte_rml_send_callback, NULL))) {
+        PRTE_OUTPUT_VERBOSE((5, prte_errmgr_base_framework.framework_output,
+                             "errmgr:detector:failed to send to %s", PRTE_NAME_PRINT(&daemon)));
+        PRTE_ERROR_LOG(rc);
+        PMIX_DATA_BUFFER_RELEASE(buffer);
+    }
+}
+
+static pmix_data_buffer_t *fd_buffer(void)
+{
+    pmix_data_buffer_t *buffer;
+    int rc;
+
+    PMIX_DATA_BUFFER_CREATE(buffer);
+    rc = PMIx_Data_pack(NULL, buffer, &prte_process_info.myproc.nspace, 1, PMIX_PROC_NSPACE);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+    }
+    rc = PMIx_Data_pack(NULL, buffer, &prte_process_info.myproc.rank, 1, PMIX_PROC_RANK);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+    }
+    return buffer;
+}
+
 int finalize(void)
 {
     if (PRTE_PROC_IS_DAEMON) {
         prte_errmgr_detector_t *detector = &prte_errmgr_world_detector;
+        double elapsed;
 
-        if (detector->hb_observer != (int) PMIX_RANK_INVALID) {
-            detector->hb_observer = prte_process_info.myproc.rank;
+        if (0 < detector->nobservers) {
             PRTE_OUTPUT_VERBOSE((5, prte_errmgr_base_framework.framework_output,
                                  "errmgr:detector: send last heartbeat message"));
-            fd_heartbeat_send(detector);
+            /* a heartbeat from ourselves closes the detector */
+            fd_send(PRTE_PROC_MY_NAME->rank, PRTE_RML_TAG_HEARTBEAT, fd_buffer());
             detector->hb_period = INFINITY;
         }
+        if (NULL != detector->observing) {
+            elapsed = Wtime() - detector->hb_start;
+            prte_output_verbose(1, prte_errmgr_base_framework.framework_output,
+                                "%s errmgr:detector sent %lu and received %lu heartbeats in %.1f "
+                                "sec (%.2f/sec) - %d failed daemons",
+                                PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                                (unsigned long) detector->hb_sent,
+                                (unsigned long) detector->hb_recvd, elapsed,
+                                (0. < elapsed) ? (double) detector->hb_sent / elapsed : 0.,
+                                detector->failed_node_count);
+        }
         prte_event_del(&prte_errmgr_world_detector.fd_event);
         prte_rml.recv_cancel(PRTE_NAME_WILDCARD, PRTE_RML_TAG_HEARTBEAT_REQUEST);
         prte_rml.recv_cancel(PRTE_NAME_WILDCARD, PRTE_RML_TAG_HEARTBEAT);
         if (prte_event_base != fd_event_base) {
             prte_event_base_free(fd_event_base);
         }
-        /* set heartbeat period to infinity and observer to invalid */
-        prte_errmgr_world_detector.hb_period = INFINITY;
-        prte_errmgr_world_detector.hb_observer = PMIX_RANK_INVALID;
+        /* set heartbeat period to infinity and drop the observers */
+        detector->hb_period = INFINITY;
+        detector->nobservers = 0;
+        detector->nobserving = 0;
+        if (NULL != detector->observing) {
+            free(detector->observing);
+            detector->observing = NULL;
+            free(detector->observers);
+            detector->observers = NULL;
+            PRTE_DESTRUCT(&detector->failed);
+        }
     }
     return PRTE_SUCCESS;
 }
 
-bool errmgr_get_daemon_status(pmix_proc_t daemon)
+/* record that a daemon failed, returning true if we didn't know yet */
+static bool fd_mark_failed(prte_errmgr_detector_t *detector, pmix_rank_t vpid)
 {
-    prte_errmgr_detector_t *detector = &prte_errmgr_world_detector;
-    int i;
+    int n;
 
-    for (i = 0; i < detector->failed_node_count; i++) {
-        if (*(detector->daemons_state + i) == (int) daemon.rank) {
-            return false;
+    if (prte_bitmap_is_set_bit(&detector->failed, vpid)) {
+        return false;
+    }
+    if (PRTE_SUCCESS != prte_bitmap_set_bit(&detector->failed, vpid)) {
+        return false;
+    }
+    detector->failed_node_count++;
+    /* it won't be observing us any more */
+    for (n = 0; n < detector->nobservers; n++) {
+        if (detector->observers[n] == vpid) {
+            detector->observers[n] = detector->observers[--detector->nobservers];
+            break;
         }
     }
     return true;
 }
 
+bool errmgr_get_daemon_status(pmix_proc_t daemon)
+{
+    return !prte_bitmap_is_set_bit(&prte_errmgr_world_detector.failed, daemon.rank);
+}
+
 void errmgr_set_daemon_status(pmix_proc_t daemon)
 {
-    prte_errmgr_detector_t *detector = &prte_errmgr_world_detector;
-    *(detector->daemons_state + detector->failed_node_count) = daemon.rank;
+    fd_mark_failed(&prte_errmgr_world_detector, daemon.rank);
 }
 
 static double Wtime(void)
@@ -306,6 +370,17 @@ static double Wtime(void)
     return wtime;
 }
 
+/* the daemons are placed on the ring by vpid - the HNP isn't part of it */
+static pmix_rank_t ring_pred(pmix_rank_t vpid)
+{
+    return (1 < vpid) ? vpid - 1 : (pmix_rank_t)(prte_process_info.num_daemons - 1);
+}
+
+static pmix_rank_t ring_succ(pmix_rank_t vpid)
+{
+    return (vpid < (pmix_rank_t)(prte_process_info.num_daemons - 1)) ? vpid + 1 : 1;
+}
+
 static void enable_detector(bool enable_flag)
 {
     PRTE_OUTPUT_VERBOSE((5, prte_errmgr_base_framework.framework_output,
@@ -314,8 +389,9 @@ static void enable_detector(bool enable_flag)
 
     if (PRTE_PROC_IS_DAEMON && enable_flag) {
         prte_errmgr_detector_t *detector = &prte_errmgr_world_detector;
-        int ndmns, i;
-        uint32_t vpid;
+        int ndmns, k, n;
+        pmix_rank_t vpid;
+        double now;
 
         pmix_status_t pcode = prte_pmix_convert_rc(PRTE_ERR_PROC_ABORTED);
 
@@ -327,29 +403,54 @@ static void enable_detector(bool enable_flag)
 
         /* num of daemon in this jobid */
         ndmns = prte_process_info.num_daemons - 1;
-        vpid = prte_process_info.myproc.rank;
-        /*  we observing somebody {n,1,2,...n-1}, the ring */
-        if (0 != (vpid - 1)) {
-            detector->hb_observing = vpid - 1;
-        } else {
-            detector->hb_observing = ndmns;
+        /* we can't have more observers than there are other daemons */
+        k = prte_errmgr_detector_component.num_observers;
+        if (k > ndmns - 1) {
+            k = (0 < ndmns) ? ndmns - 1 : 0;
         }
-        /* someone is observing us: range [1~n], the observing ring */
-        detector->hb_observer = (ndmns + vpid) % ndmns + 1;
+
+        PRTE_CONSTRUCT(&detector->failed, prte_bitmap_t);
+        prte_bitmap_init(&detector->failed, ndmns + 1);
+        detector->failed_node_count = 0;
+        detector->observing = (prte_errmgr_detector_peer_t *)
+            calloc(k + 1, sizeof(prte_errmgr_detector_peer_t));
+        detector->observers_size = k + 1;
+        detector->observers = (pmix_rank_t *) calloc(detector->observers_size,
+                                                     sizeof(pmix_rank_t));
         detector->hb_period = prte_errmgr_detector_component.heartbeat_period;
         detector->hb_timeout = prte_errmgr_detector_component.heartbeat_timeout;
         detector->hb_sstamp = 0.;
-        /* give some slack for MPI_Init */
-        detector->hb_rstamp = Wtime() + (double) ndmns;
-
-        detector->daemons_state = malloc(8 * sizeof(int));
-        for (i = 0; i < 8; i++) {
-            *(detector->daemons_state + i) = -1;
+        detector->hb_sent = 0;
+        detector->hb_recvd = 0;
+        now = Wtime();
+        detector->hb_start = now;
+
+        /* we observe the k daemons before us on the ring, and the k
+         * daemons after us observe us */
+        detector->nobserving = 0;
+        detector->nobservers = 0;
+        vpid = prte_process_info.myproc.rank;
+        for (n = 0; n < k; n++) {
+            vpid = ring_pred(vpid);
+            detector->observing[n].vpid = vpid;
+            /* give some slack for MPI_Init */
+            detector->observing[n].rstamp = now + (double) ndmns;
+            detector->nobserving++;
+        }
+        vpid = prte_process_info.myproc.rank;
+        for (n = 0; n < k; n++) {
+            vpid = ring_succ(vpid);
+            detector->observers[n] = vpid;
+            detector->nobservers++;
         }
 
         PRTE_OUTPUT_VERBOSE((5, prte_errmgr_base_framework.framework_output,
-                             "errmgr:detector daemon %d observing %d; observed by %d", vpid,
-                             detector->hb_observing, detector->hb_observer));
+                             "errmgr:detector daemon %d observing %d daemons from %d; observed by "
+                             "%d daemons from %d",
+                             prte_process_info.myproc.rank, detector->nobserving,
+                             (0 < k) ? (int) detector->observing[0].vpid : -1,
+                             detector->nobservers,
+                             (0 < k) ? (int) detector->observers[0] : -1));
 
         prte_event_set(fd_event_base, &detector->fd_event, -1, PRTE_EV_TIMEOUT | PRTE_EV_PERSIST,
                        fd_event_cb, detector);
@@ -360,110 +461,166 @@ static void enable_detector(bool enable_flag)
     }
 }
 
-static int fd_heartbeat_request(prte_errmgr_detector_t *detector)
+/*
+ * Recompute the daemons we observe after some have failed: we want the
+ * nearest live daemons before us on the ring. Any daemon we weren't
+ * already observing is asked to send us heartbeats, and told which
+ * daemons we know to have failed so it can stop sending to them.
+ */
+static void fd_update_observing(prte_errmgr_detector_t *detector)
 {
+    prte_errmgr_detector_peer_t *observing;
+    pmix_data_buffer_t *buffer;
+    pmix_rank_t vpid, me = prte_process_info.myproc.rank;
+    int k, n, m, rc;
+    int32_t nfailed;
+    double now = Wtime();
 
-    int rc, ndmns;
-    uint32_t vpid;
-
-    pmix_proc_t temp_proc_name;
-
-    PMIX_LOAD_PROCID(&temp_proc_name, prte_process_info.myproc.nspace, detector->hb_observing);
-
-    if (errmgr_get_daemon_status(temp_proc_name)) {
-        /* already observing a live process, so nothing to do. */
-        return PRTE_SUCCESS;
+    k = prte_errmgr_detector_component.num_observers;
+    if (k > (int) prte_process_info.num_daemons - 2) {
+        k = (2 < prte_process_info.num_daemons) ? (int) prte_process_info.num_daemons - 2 : 0;
+    }
+    observing = (prte_errmgr_detector_peer_t *) calloc(k + 1, sizeof(prte_errmgr_detector_peer_t));
+    if (NULL == observing) {
+        PRTE_ERROR_LOG(PRTE_ERR_OUT_OF_RESOURCE);
+        return;
     }
 
-    ndmns = prte_process_info.num_daemons - 1;
-
-    pmix_data_buffer_t *buffer = NULL;
-    pmix_proc_t daemon;
-    PMIX_LOAD_NSPACE(daemon.nspace, prte_process_info.myproc.nspace);
-
-    for (vpid = (ndmns + detector->hb_observing) % ndmns; vpid != prte_process_info.myproc.rank;
-         vpid = (ndmns + vpid - 1) % ndmns) {
-
-        if (0 != vpid) {
-            daemon.rank = vpid;
-        } else {
-            daemon.rank = ndmns;
-        }
-        // this daemon is not alive
-        if (!errmgr_get_daemon_status(daemon)) {
+    n = 0;
+    for (vpid = ring_pred(me); vpid != me && n < k; vpid = ring_pred(vpid)) {
+        if (prte_bitmap_is_set_bit(&detector->failed, vpid)) {
             continue;
         }
-
-        /* everyone is gone, i dont need to monitor myself */
-        if (daemon.rank == prte_process_info.myproc.rank) {
-            detector->hb_observer = detector->hb_observing = PMIX_RANK_INVALID;
-            detector->hb_rstamp = INFINITY;
-            detector->hb_period = INFINITY;
-            return PRTE_SUCCESS;
-        }
-
-        PRTE_OUTPUT_VERBOSE((5, prte_errmgr_base_framework.framework_output,
-                             "errmgr:detector hb request updating ring"));
-        detector->hb_observing = daemon.rank;
-        PMIX_DATA_BUFFER_CREATE(buffer);
-        rc = PMIx_Data_pack(NULL, buffer, &prte_process_info.myproc.nspace, 1, PMIX_PROC_NSPACE);
-        if (PMIX_SUCCESS != rc) {
-            PMIX_ERROR_LOG(rc);
-        }
-        rc = PMIx_Data_pack(NULL, buffer, &prte_process_info.myproc.rank, 1, PMIX_PROC_RANK);
-        if (PMIX_SUCCESS != rc) {
-            PMIX_ERROR_LOG(rc);
+        observing[n].vpid = vpid;
+        /* we add one timeout slack to account for the send time */
+        observing[n].rstamp = now + detector->hb_timeout;
+        for (m = 0; m < detector->nobserving; m++) {
+            if (detector->observing[m].vpid == vpid) {
+                observing[n].rstamp = detector->observing[m].rstamp;
+                break;
+            }
         }
-        if (0 > (rc = prte_rml.send_buffer_nb(&daemon, buffer, PRTE_RML_TAG_HEARTBEAT_REQUEST,
-                                              prte_rml_send_callback, NULL))) {
-            PRTE_ERROR_LOG(rc);
+        if (m == detector->nobserving) {
+            /* a new one - ask it to send us heartbeats */
+            PRTE_OUTPUT_VERBOSE((5, prte_errmgr_base_framework.framework_output,
+                                 "errmgr:detector hb request updating ring"));
+            buffer = fd_buffer();
+            nfailed = detector->failed_node_count;
+            rc = PMIx_Data_pack(NULL, buffer, &nfailed, 1, PMIX_INT32);
+            if (PMIX_SUCCESS != rc) {
+                PMIX_ERROR_LOG(rc);
+            }
+            for (m = 1; m < (int) prte_process_info.num_daemons; m++) {
+                if (prte_bitmap_is_set_bit(&detector->failed, m)) {
+                    vpid = m;
+                    rc = PMIx_Data_pack(NULL, buffer, &vpid, 1, PMIX_PROC_RANK);
+                    if (PMIX_SUCCESS != rc) {
+                        PMIX_ERROR_LOG(rc);
+                    }
+                }
+            }
+            vpid = observing[n].vpid;
+            fd_send(vpid, PRTE_RML_TAG_HEARTBEAT_REQUEST, buffer);
         }
-        break;
+        ++n;
+    }
+    free(detector->observing);
+    detector->observing = observing;
+    detector->nobserving = n;
+
+    if (0 == n) {
+        /* everyone is gone, i dont need to monitor myself */
+        detector->nobservers = 0;
+        detector->hb_period = INFINITY;
     }
     PRTE_OUTPUT_VERBOSE((5, prte_errmgr_base_framework.framework_output,
-                         "errmgr:detector updated ring daemon %d observing %d; observed by %d",
-                         PRTE_PROC_MY_NAME->rank, detector->hb_observing, detector->hb_observer));
-    /* we add one timeout slack to account for the send time */
-    detector->hb_rstamp = Wtime() + detector->hb_timeout;
-    return PRTE_SUCCESS;
+                         "errmgr:detector updated ring daemon %d observing %d daemons from %d; "
+                         "observed by %d daemons",
+                         PRTE_PROC_MY_NAME->rank, detector->nobserving,
+                         (0 < n) ? (int) observing[0].vpid : -1, detector->nobservers));
 }
 
 static void fd_heartbeat_request_cb(int status, pmix_proc_t *sender, pmix_data_buffer_t *buffer,
                                     prte_rml_tag_t tg, void *cbdata)
 {
     prte_errmgr_detector_t *detector = &prte_errmgr_world_detector;
-    int ndmns, rr, ro;
     pmix_nspace_t jobid;
-    pmix_rank_t vpid;
+    pmix_rank_t vpid, failed;
+    pmix_rank_t *tmp;
+    int32_t nfailed, n;
+    bool update = false;
     int temp;
-    temp = 1;
-    int rc;
+    int rc, m;
 
+    temp = 1;
     rc = PMIx_Data_unpack(NULL, buffer, &jobid, &temp, PMIX_PROC_NSPACE);
     if (PMIX_SUCCESS != rc) {
         PMIX_ERROR_LOG(rc);
+        return;
     }
+    temp = 1;
     rc = PMIx_Data_unpack(NULL, buffer, &vpid, &temp, PMIX_PROC_RANK);
     if (PMIX_SUCCESS != rc) {
         PMIX_ERROR_LOG(rc);
+        return;
     }
     PRTE_OUTPUT_VERBOSE((5, prte_errmgr_base_framework.framework_output,
-                         "errmgr:detector %d receive %d", prte_process_info.myproc.rank,
-                         detector->hb_observer));
-    ndmns = prte_process_info.num_nodes;
-    rr = (ndmns - prte_process_info.myproc.rank + vpid)
-         % ndmns; /* translate msg->from in circular space so that myrank==0 */
-    ro = (ndmns - prte_process_info.myproc.rank + detector->hb_observer)
-         % ndmns; /* same for the observer rank */
-    if (rr < ro) {
-        return; /* never forward on the rbcast */
+                         "errmgr:detector %d receive hb request from %d",
+                         prte_process_info.myproc.rank, vpid));
+    if (NULL == detector->observing) {
+        /* not enabled */
+        return;
+    }
+
+    /* learn about the failures the requester knows of */
+    temp = 1;
+    rc = PMIx_Data_unpack(NULL, buffer, &nfailed, &temp, PMIX_INT32);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return;
+    }
+    for (n = 0; n < nfailed; n++) {
+        temp = 1;
+        rc = PMIx_Data_unpack(NULL, buffer, &failed, &temp, PMIX_PROC_RANK);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            return;
+        }
+        if (fd_mark_failed(detector, failed)) {
+            for (m = 0; m < detector->nobserving; m++) {
+                if (detector->observing[m].vpid == failed) {
+                    update = true;
+                }
+            }
+        }
+    }
+    if (update) {
+        fd_update_observing(detector);
     }
 
-    detector->hb_observer = vpid;
-    detector->hb_sstamp = 0.;
+    /* add the requester to our observers */
+    for (m = 0; m < detector->nobservers; m++) {
+        if (detector->observers[m] == vpid) {
+            break;
+        }
+    }
+    if (m == detector->nobservers) {
+        if (detector->nobservers == detector->observers_size) {
+            tmp = (pmix_rank_t *) realloc(detector->observers,
+                                          2 * detector->observers_size * sizeof(pmix_rank_t));
+            if (NULL == tmp) {
+                PRTE_ERROR_LOG(PRTE_ERR_OUT_OF_RESOURCE);
+                return;
+            }
+            detector->observers = tmp;
+            detector->observers_size *= 2;
+        }
+        detector->observers[detector->nobservers++] = vpid;
+    }
 
-    fd_heartbeat_send(detector);
-    return;
+    /* let it know right away that we are alive */
+    fd_send(vpid, PRTE_RML_TAG_HEARTBEAT, fd_buffer());
+    detector->hb_sent++;
 }
 
 /*
@@ -475,6 +632,8 @@ static void fd_event_cb(int fd, short flags, void *pdetector)
     // need to find a new time func
     double stamp = Wtime();
     prte_errmgr_detector_t *detector = pdetector;
+    bool update = false;
+    int n;
 
     // temp proc name for get the prte object
     pmix_proc_t temp_proc_name;
@@ -482,31 +641,25 @@ static void fd_event_cb(int fd, short flags, void *pdetector)
     if ((stamp - detector->hb_sstamp) >= detector->hb_period) {
         fd_heartbeat_send(detector);
     }
-    if (INFINITY == detector->hb_rstamp) {
-        return;
-    }
 
-    if ((stamp - detector->hb_rstamp) > detector->hb_timeout) {
+    for (n = 0; n < detector->nobserving; n++) {
+        if ((stamp - detector->observing[n].rstamp) <= detector->hb_timeout) {
+            continue;
+        }
         /* this process is now suspected dead. */
-        PMIX_LOAD_PROCID(&temp_proc_name, prte_process_info.myproc.nspace, detector->hb_observing);
+        PMIX_LOAD_PROCID(&temp_proc_name, prte_process_info.myproc.nspace,
+                         detector->observing[n].vpid);
         /* if first time detected */
-        if (errmgr_get_daemon_status(temp_proc_name)) {
+        if (fd_mark_failed(detector, temp_proc_name.rank)) {
             PRTE_OUTPUT_VERBOSE((5, prte_errmgr_base_framework.framework_output,
                                  "errmgr:detector %d detected daemon %d failed, heartbeat delay",
-                                 prte_process_info.myproc.rank, detector->hb_observing));
+                                 prte_process_info.myproc.rank, temp_proc_name.rank));
             prte_propagate.prp(temp_proc_name.nspace, NULL, &temp_proc_name, PRTE_ERR_PROC_ABORTED);
-
-            /* with every 8 failed nodes realloc 8 more slots to store the vpid of failed nodes */
-            if ((detector->failed_node_count / 8) > 0 && (detector->failed_node_count % 8) == 0) {
-                detector->daemons_state = realloc(detector->daemons_state,
-                                                  detector->failed_node_count + 8);
-            }
-
-            errmgr_set_daemon_status(temp_proc_name);
-            /* increase the number of failed nodes */
-            detector->failed_node_count++;
-            fd_heartbeat_request(detector);
         }
+        update = true;
+    }
+    if (update) {
+        fd_update_observing(detector);
     }
 }
 
@@ -515,6 +668,7 @@ static void fd_event_cb(int fd, short flags, void *pdetector)
  */
 static void fd_heartbeat_send(prte_errmgr_detector_t *detector)
 {
+    int n;
 
     double now = Wtime();
     if (0. != detector->hb_sstamp && (now - detector->hb_sstamp) >= 2. * detector->hb_period) {
@@ -526,27 +680,10 @@ static void fd_heartbeat_send(prte_errmgr_detector_t *detector)
     }
     detector->hb_sstamp = now;
 
-    pmix_data_buffer_t *buffer = NULL;
-    int rc;
-
-    PMIX_DATA_BUFFER_CREATE(buffer);
-    pmix_proc_t daemon;
-    PMIX_LOAD_PROCID(&daemon, prte_process_info.myproc.nspace, detector->hb_observer);
-    rc = PMIx_Data_pack(NULL, buffer, &prte_process_info.myproc.nspace, 1, PMIX_PROC_NSPACE);
-    if (PMIX_SUCCESS != rc) {
-        PMIX_ERROR_LOG(rc);
-    }
-    rc = PMIx_Data_pack(NULL, buffer, &prte_process_info.myproc.rank, 1, PMIX_PROC_RANK);
-    if (PMIX_SUCCESS != rc) {
-        PMIX_ERROR_LOG(rc);
-    }
     /* send the heartbeat with eager send */
-    if (0 > (rc = prte_rml.send_buffer_nb(&daemon, buffer, PRTE_RML_TAG_HEARTBEAT,
-                                          prte_rml_send_callback, NULL))) {
-        PRTE_OUTPUT_VERBOSE((5, prte_errmgr_base_framework.framework_output,
-                             "errmgr:detector:failed to send heartbeat to %s",
-                             PRTE_NAME_PRINT(&daemon)));
-        PRTE_ERROR_LOG(rc);
+    for (n = 0; n < detector->nobservers; n++) {
+        fd_send(detector->observers[n], PRTE_RML_TAG_HEARTBEAT, fd_buffer());
+        detector->hb_sent++;
     }
 }
 
@@ -554,7 +691,7 @@ static void fd_heartbeat_recv_cb(int status, pmix_proc_t *sender, pmix_data_buff
                                  prte_rml_tag_t tg, void *cbdata)
 {
     prte_errmgr_detector_t *detector = &prte_errmgr_world_detector;
-    int rc;
+    int rc, n;
     int32_t cnt;
     pmix_rank_t vpid;
     pmix_nspace_t jobid;
@@ -565,8 +702,7 @@ static void fd_heartbeat_recv_cb(int status, pmix_proc_t *sender, pmix_data_buff
                              "errmgr:detector:%s %s Received heartbeat from %d, "
                              "which is myself, quit msg to close detector",
                              PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), __func__, sender->rank));
-        detector->hb_observing = detector->hb_observer = PMIX_RANK_INVALID;
-        detector->hb_rstamp = INFINITY;
+        detector->nobserving = detector->nobservers = 0;
         detector->hb_period = INFINITY;
         return;
     }
@@ -581,21 +717,27 @@ static void fd_heartbeat_recv_cb(int status, pmix_proc_t *sender, pmix_data_buff
     if (PMIX_SUCCESS != rc) {
         PMIX_ERROR_LOG(rc);
     }
+    detector->hb_recvd++;
 
-    if ((int) vpid != detector->hb_observing) {
+    for (n = 0; n < detector->nobserving; n++) {
+        if (detector->observing[n].vpid == vpid) {
+            break;
+        }
+    }
+    if (n == detector->nobserving) {
         PRTE_OUTPUT_VERBOSE((5, prte_errmgr_base_framework.framework_output,
                              "errmgr:detector: daemon %s receive heartbeat from vpid %d, "
-                             "but I am monitoring vpid %d ",
-                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), vpid, detector->hb_observing));
+                             "but I am not monitoring it",
+                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), vpid));
     } else {
         double stamp = Wtime();
-        double grace = detector->hb_timeout - (stamp - detector->hb_rstamp);
+        double grace = detector->hb_timeout - (stamp - detector->observing[n].rstamp);
         PRTE_OUTPUT_VERBOSE((5, prte_errmgr_base_framework.framework_output,
                              "errmgr:detector: daemon %s receive heartbeat from vpid %d tag %d at "
                              "timestamp %g (remained %.1e of %.1e before suspecting)",
                              PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), vpid, tg, stamp, grace,
                              detector->hb_timeout));
-        detector->hb_rstamp = stamp;
+        detector->observing[n].rstamp = stamp;
         if (grace < 0.0) {
             PRTE_OUTPUT_VERBOSE((5, prte_errmgr_base_framework.framework_output,
                                  "errmgr:detector: daemon %s  MISSED (%.1e)",
@@ -22,20 +22,37 @@
 
 #include "prte_config.h"
 
+#include "src/class/prte_bitmap.h"
 #include "src/mca/errmgr/errmgr.h"
 
 BEGIN_C_DECLS
 
+/*
+ * The daemons form a ring, and each daemon observes the nearest
+ * num_observers live daemons preceding it - so every daemon is
+ * watched by that many peers and a failure goes unnoticed only if
+ * all of them fail too
+ */
+typedef struct {
+    pmix_rank_t vpid; /* the daemon we observe */
+    double rstamp;    /* the date of the last hb reception from it */
+} prte_errmgr_detector_peer_t;
+
 typedef struct {
-    prte_event_t fd_event; /* to trigger timeouts with prte_events */
-    int hb_observing;      /* the deamon vpid of the process we observe */
-    int hb_observer;       /* the daemon vpid of the process that observes us */
-    double hb_rstamp;      /* the date of the last hb reception */
+    prte_event_t fd_event;                  /* to trigger timeouts with prte_events */
+    prte_errmgr_detector_peer_t *observing; /* the daemons we observe */
+    int nobserving;
+    pmix_rank_t *observers; /* the daemons that observe us */
+    int nobservers;
+    int observers_size;
     double hb_timeout; /* the timeout before we start suspecting observed process as dead (delta) */
     double hb_period;  /* the time spacing between heartbeat emission (eta) */
     double hb_sstamp;  /* the date at which the last hb emission was done */
     int failed_node_count; /* the number of failed nodes in the ring */
-    int *daemons_state;    /* a list of failed daemons' vpid */
+    prte_bitmap_t failed;  /* the vpids of the failed daemons */
+    uint64_t hb_sent;      /* heartbeats sent and received, for the stats */
+    uint64_t hb_recvd;
+    double hb_start;       /* the date the detector was enabled */
 } prte_errmgr_detector_t;
 
 /*
@@ -46,6 +63,7 @@ typedef struct {
     prte_errmgr_base_component_t super;
     double heartbeat_period;
     double heartbeat_timeout;
+    int num_observers;
 } prte_errmgr_detector_component_t;
 
 PRTE_MODULE_EXPORT extern prte_errmgr_detector_component_t prte_errmgr_detector_component;
@@ -61,7 +61,8 @@ prte_errmgr_detector_component_t prte_errmgr_detector_component = {
         },
     },
     .heartbeat_period = 5.0,
-    .heartbeat_timeout = 10.0
+    .heartbeat_timeout = 10.0,
+    .num_observers = 1
 };
 
 static int my_priority;
@@ -89,6 +90,16 @@ static int errmgr_detector_register(void)
         PRTE_MCA_BASE_VAR_TYPE_DOUBLE, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
         PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_errmgr_detector_component.heartbeat_timeout);
 
+    (void) prte_mca_base_component_var_register(
+        c, "num_observers",
+        "Number of daemons that observe each daemon - a failure is detected as long as one of "
+        "them survives, at the cost of that many heartbeats per period from each daemon",
+        PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
+        PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_errmgr_detector_component.num_observers);
+    if (1 > prte_errmgr_detector_component.num_observers) {
+        prte_errmgr_detector_component.num_observers = 1;
+    }
+
     return PRTE_SUCCESS;
 }
 
@@ -316,7 +316,7 @@ static void job_errors(int fd, short args, void *cbdata)
         jdata->num_terminated = jdata->num_procs;
         /* activate the terminated state so we can exit */
         PRTE_ACTIVATE_JOB_STATE(jdata, PRTE_JOB_STATE_TERMINATED);
-        PRTE_RELEASE(caddy);
+        PRTE_STATE_CADDY_RELEASE(caddy);
         return;
     }
 
@@ -355,7 +355,95 @@ static void job_errors(int fd, short args, void *cbdata)
     }
 
     /* cleanup */
-    PRTE_RELEASE(caddy);
+    PRTE_STATE_CADDY_RELEASE(caddy);
+}
+
+/* elements of a job array are independent of each other, so an
+ * element that fails is only counted - any of its procs that are
+ * still running are killed, but the rest of the array keeps running
+ * and the count is reported once the whole array completes.
+ * Returns true if the failure was absorbed this way */
+static bool array_element_failed(prte_job_t *jdata, prte_proc_t *pptr, prte_proc_state_t state)
+{
+    prte_app_context_t *app;
+    prte_proc_t *peer;
+    prte_pointer_array_t procs;
+    int nkill = 0;
+    uint32_t size, *u32ptr = &size, nfailed = 0, *nfptr = &nfailed;
+    pmix_rank_t ppe, first, r;
+
+    switch (state) {
+    case PRTE_PROC_STATE_ABORTED:
+    case PRTE_PROC_STATE_ABORTED_BY_SIG:
+    case PRTE_PROC_STATE_TERM_WO_SYNC:
+    case PRTE_PROC_STATE_CALLED_ABORT:
+    case PRTE_PROC_STATE_TERM_NON_ZERO:
+        break;
+    default:
+        return false;
+    }
+    if (!prte_get_attribute(&jdata->attributes, PRTE_JOB_ARRAY_SIZE, (void **) &u32ptr,
+                            PMIX_UINT32)
+        || NULL == (app = (prte_app_context_t *) prte_pointer_array_get_item(jdata->apps, 0))) {
+        return false;
+    }
+
+    /* we can hear about the same proc more than once */
+    if (PRTE_PROC_STATE_TERMINATED < pptr->state) {
+        return true;
+    }
+    pptr->state = state;
+
+    /* let the state machine finish off the proc as usual */
+    PRTE_ACTIVATE_PROC_STATE(&pptr->name, PRTE_PROC_STATE_WAITPID_FIRED);
+    if (!PRTE_FLAG_TEST(pptr, PRTE_PROC_FLAG_LOCAL)) {
+        PRTE_ACTIVATE_PROC_STATE(&pptr->name, PRTE_PROC_STATE_IOF_COMPLETE);
+    }
+
+    /* only count the element the first time one of its procs fails */
+    ppe = app->num_procs / size;
+    first = (pptr->name.rank / ppe) * ppe;
+    for (r = first; r < first + ppe; r++) {
+        peer = (prte_proc_t *) prte_pointer_array_get_item(jdata->procs, r);
+        if (NULL != peer && peer != pptr && PRTE_PROC_STATE_TERMINATED < peer->state
+            && PRTE_PROC_STATE_KILLED_BY_CMD != peer->state) {
+            return true;
+        }
+    }
+
+    /* take down the rest of the element */
+    PRTE_CONSTRUCT(&procs, prte_pointer_array_t);
+    prte_pointer_array_init(&procs, ppe, INT_MAX, 1);
+    for (r = first; r < first + ppe; r++) {
+        peer = (prte_proc_t *) prte_pointer_array_get_item(jdata->procs, r);
+        if (NULL != peer && peer != pptr && peer->state < PRTE_PROC_STATE_UNTERMINATED) {
+            prte_pointer_array_add(&procs, peer);
+            ++nkill;
+        }
+    }
+    if (0 < nkill) {
+        prte_plm.terminate_procs(&procs);
+    }
+    PRTE_DESTRUCT(&procs);
+
+    prte_get_attribute(&jdata->attributes, PRTE_JOB_ARRAY_NUM_FAILED, (void **) &nfptr,
+                       PMIX_UINT32);
+    ++nfailed;
+    prte_set_attribute(&jdata->attributes, PRTE_JOB_ARRAY_NUM_FAILED, PRTE_ATTR_LOCAL, nfptr,
+                       PMIX_UINT32);
+    /* the array as a whole reports the status of the first failure */
+    if (0 == jdata->exit_code) {
+        jdata->exit_code = pptr->exit_code;
+        if (0 == jdata->exit_code) {
+            jdata->exit_code = PRTE_ERROR_DEFAULT_EXIT_CODE;
+        }
+    }
+
+    PRTE_OUTPUT_VERBOSE((5, prte_errmgr_base_framework.framework_output,
+                         "%s errmgr:dvm: element %u of job array %s failed (%u of %u)",
+                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), pptr->name.rank / ppe,
+                         PRTE_JOBID_PRINT(jdata->nspace), nfailed, size));
+    return true;
 }
 
 static void proc_errors(int fd, short args, void *cbdata)
@@ -377,7 +465,7 @@ static void proc_errors(int fd, short args, void *cbdata)
     /* get the job object */
     if (prte_finalizing || NULL == (jdata = prte_get_job_data_object(proc->nspace))) {
         /* could be a race condition */
-        PRTE_RELEASE(caddy);
+        PRTE_STATE_CADDY_RELEASE(caddy);
         return;
     }
     pptr = (prte_proc_t *) prte_pointer_array_get_item(jdata->procs, proc->rank);
@@ -474,6 +562,10 @@ static void proc_errors(int fd, short args, void *cbdata)
         goto cleanup;
     }
 
+    if (array_element_failed(jdata, pptr, state)) {
+        goto cleanup;
+    }
+
     /* update the proc state - can get multiple reports on a proc
      * depending on circumstances, so ensure we only do this once
      */
@@ -745,5 +837,5 @@ keep_going:
     }
 
 cleanup:
-    PRTE_RELEASE(caddy);
+    PRTE_STATE_CADDY_RELEASE(caddy);
 }
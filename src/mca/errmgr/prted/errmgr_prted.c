@@ -45,6 +45,7 @@
 #include "src/mca/plm/plm_types.h"
 #include "src/mca/rml/rml.h"
 #include "src/mca/routed/routed.h"
+#include "src/mca/state/base/state_private.h"
 #include "src/mca/state/state.h"
 
 #include "src/runtime/prte_globals.h"
@@ -311,7 +312,7 @@ static void job_errors(int fd, short args, void *cbdata)
     }
 
 cleanup:
-    PRTE_RELEASE(caddy);
+    PRTE_STATE_CADDY_RELEASE(caddy);
 }
 
 static void proc_errors(int fd, short args, void *cbdata)
@@ -320,7 +321,7 @@ static void proc_errors(int fd, short args, void *cbdata)
     prte_job_t *jdata;
     pmix_proc_t *proc = &caddy->name;
     prte_proc_state_t state = caddy->proc_state;
-    prte_proc_t *child, *ptr;
+    prte_proc_t *child;
     pmix_data_buffer_t *alert;
     prte_plm_cmd_flag_t cmd;
     int rc = PRTE_SUCCESS;
@@ -643,54 +644,27 @@ static void proc_errors(int fd, short args, void *cbdata)
 
     /* only other state is terminated - see if anyone is left alive */
     if (!any_live_children(proc->nspace)) {
-        PMIX_DATA_BUFFER_CREATE(alert);
-        /* pack update state command */
-        cmd = PRTE_PLM_UPDATE_PROC_STATE;
-        rc = PMIx_Data_pack(NULL, alert, &cmd, 1, PMIX_UINT8);
-        if (PMIX_SUCCESS != rc) {
-            PMIX_ERROR_LOG(rc);
-            PMIX_DATA_BUFFER_RELEASE(alert);
-            return;
-        }
-        /* pack the data for the job */
-        if (PMIX_SUCCESS != (rc = pack_state_update(alert, jdata))) {
-            PMIX_ERROR_LOG(rc);
-            PMIX_DATA_BUFFER_RELEASE(alert);
-            return;
-        }
-
         PRTE_OUTPUT_VERBOSE((5, prte_errmgr_base_framework.framework_output,
                              "%s errmgr:prted reporting all procs in %s terminated",
                              PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_JOBID_PRINT(jdata->nspace)));
+        /* record the final states before the children are released */
+        if (PRTE_SUCCESS != (rc = prte_state_base_report_proc_states(jdata))) {
+            PRTE_ERROR_LOG(rc);
+        }
 
         /* remove all of this job's children from the global list */
-        for (i = 0; i < prte_local_children->size; i++) {
-            if (NULL
-                == (ptr = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children, i))) {
-                continue;
-            }
-            if (PMIX_CHECK_NSPACE(jdata->nspace, ptr->name.nspace)) {
-                prte_pointer_array_set_item(prte_local_children, i, NULL);
-                PRTE_RELEASE(ptr);
-            }
-        }
+        prte_remove_local_children(jdata);
 
         /* ensure the job's local session directory tree is removed */
         prte_session_dir_cleanup(jdata->nspace);
 
         /* remove this job from our local job data since it is complete */
         PRTE_RELEASE(jdata);
-
-        /* send it */
-        if (0 > (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, alert, PRTE_RML_TAG_PLM,
-                                              prte_rml_send_callback, NULL))) {
-            PRTE_ERROR_LOG(rc);
-        }
         return;
     }
 
 cleanup:
-    PRTE_RELEASE(caddy);
+    PRTE_STATE_CADDY_RELEASE(caddy);
 }
 
 /*****************
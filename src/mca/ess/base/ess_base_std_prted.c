@@ -65,6 +65,7 @@
 #include "src/mca/routed/routed.h"
 #include "src/mca/rtc/base/base.h"
 #include "src/mca/state/base/base.h"
+#include "src/mca/state/base/state_private.h"
 #include "src/mca/state/state.h"
 #include "src/prted/pmix/pmix_server.h"
 #include "src/runtime/prte_globals.h"
@@ -595,6 +596,11 @@ int prte_ess_base_prted_finalize(void)
     prte_odls.kill_local_procs(NULL);
     (void) prte_mca_base_framework_close(&prte_rtc_base_framework);
     (void) prte_mca_base_framework_close(&prte_odls_base_framework);
+    /* send any proc-state reports we are still holding while
+     * the routed and rml are still available to carry them */
+    prte_state_base_flush_proc_states();
+    /* forward any show_help duplicate counts we are still holding */
+    prte_show_help_finalize();
     (void) prte_mca_base_framework_close(&prte_routed_base_framework);
     (void) prte_mca_base_framework_close(&prte_errmgr_base_framework);
     (void) prte_mca_base_framework_close(&prte_rml_base_framework);
@@ -602,6 +602,9 @@ static int rte_finalize(void)
     prte_odls.kill_local_procs(NULL);
     (void) prte_mca_base_framework_close(&prte_rtc_base_framework);
     (void) prte_mca_base_framework_close(&prte_odls_base_framework);
+    /* show the duplicate help counts reported by the daemons
+     * before we stop receiving them */
+    prte_show_help_finalize();
     (void) prte_mca_base_framework_close(&prte_routed_base_framework);
     (void) prte_mca_base_framework_close(&prte_rml_base_framework);
     (void) prte_mca_base_framework_close(&prte_oob_base_framework);
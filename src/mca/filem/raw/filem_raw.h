@@ -30,6 +30,7 @@ PRTE_MODULE_EXPORT extern prte_filem_base_component_t prte_filem_raw_component;
 PRTE_EXPORT extern prte_filem_base_module_t prte_filem_raw_module;
 
 extern bool prte_filem_raw_flatten_trees;
+extern bool prte_filem_raw_verify;
 
 #define PRTE_FILEM_RAW_CHUNK_MAX 16384
 
@@ -37,6 +37,7 @@ static int filem_raw_close(void);
 static int filem_raw_query(prte_mca_base_module_t **module, int *priority);
 
 bool prte_filem_raw_flatten_trees = false;
+bool prte_filem_raw_verify = false;
 
 prte_filem_base_component_t prte_filem_raw_component = {
     .base_version = {
@@ -71,6 +72,15 @@ static int filem_raw_register(void)
                                                 PRTE_MCA_BASE_VAR_SCOPE_READONLY,
                                                 &prte_filem_raw_flatten_trees);
 
+    prte_filem_raw_verify = false;
+    (void) prte_mca_base_component_var_register(c, "verify",
+                                                "Protect each transferred chunk with a CRC32C "
+                                                "checksum and verify it on receipt",
+                                                PRTE_MCA_BASE_VAR_TYPE_BOOL, NULL, 0,
+                                                PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
+                                                PRTE_MCA_BASE_VAR_SCOPE_READONLY,
+                                                &prte_filem_raw_verify);
+
     return PRTE_SUCCESS;
 }
 
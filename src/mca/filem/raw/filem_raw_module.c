@@ -39,6 +39,7 @@
 
 #include "src/util/argv.h"
 #include "src/util/basename.h"
+#include "src/util/crc.h"
 #include "src/util/os_dirpath.h"
 #include "src/util/os_path.h"
 #include "src/util/output.h"
@@ -728,6 +729,7 @@ static void send_chunk(int xxx, short argc, void *cbdata)
     unsigned char data[PRTE_FILEM_RAW_CHUNK_MAX];
     int32_t numbytes;
     int rc;
+    uint32_t crc;
     pmix_data_buffer_t chunk;
     prte_grpcomm_signature_t *sig;
 
@@ -803,6 +805,24 @@ static void send_chunk(int xxx, short argc, void *cbdata)
             return;
         }
     }
+    /* flag whether or not a checksum of the data follows */
+    rc = PMIx_Data_pack(NULL, &chunk, &prte_filem_raw_verify, 1, PMIX_BOOL);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        close(fd);
+        PMIX_DATA_BUFFER_DESTRUCT(&chunk);
+        return;
+    }
+    if (prte_filem_raw_verify) {
+        crc = prte_crc32c(data, numbytes);
+        rc = PMIx_Data_pack(NULL, &chunk, &crc, 1, PMIX_UINT32);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            close(fd);
+            PMIX_DATA_BUFFER_DESTRUCT(&chunk);
+            return;
+        }
+    }
 
     /* goes to all daemons */
     sig = PRTE_NEW(prte_grpcomm_signature_t);
@@ -928,6 +948,8 @@ static void recv_files(int status, pmix_proc_t *sender, pmix_data_buffer_t *buff
     prte_list_item_t *item;
     int32_t type;
     char *cptr;
+    bool verify;
+    uint32_t crc;
 
     /* unpack the data */
     n = 1;
@@ -970,6 +992,34 @@ static void recv_files(int status, pmix_proc_t *sender, pmix_data_buffer_t *buff
             return;
         }
     }
+    /* check the data against the sender's checksum, if provided */
+    if (0 <= nchunk) {
+        n = 1;
+        rc = PMIx_Data_unpack(NULL, buffer, &verify, &n, PMIX_BOOL);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            send_complete(file, rc);
+            free(file);
+            return;
+        }
+        if (verify) {
+            n = 1;
+            rc = PMIx_Data_unpack(NULL, buffer, &crc, &n, PMIX_UINT32);
+            if (PMIX_SUCCESS != rc) {
+                PMIX_ERROR_LOG(rc);
+                send_complete(file, rc);
+                free(file);
+                return;
+            }
+            if (crc != prte_crc32c(data, nbytes)) {
+                prte_show_help("help-prte-filem-raw.txt", "chunk-crc-mismatch", true,
+                               prte_process_info.nodename, file, nchunk, nbytes);
+                send_complete(file, PRTE_ERR_FILE_WRITE_FAILURE);
+                free(file);
+                return;
+            }
+        }
+    }
 
     PRTE_OUTPUT_VERBOSE((1, prte_filem_base_framework.framework_output,
                          "%s filem:raw: received chunk %d for file %s containing %d bytes",
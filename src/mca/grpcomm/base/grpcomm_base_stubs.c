@@ -46,6 +46,7 @@
 #include "src/util/error_strings.h"
 #include "src/util/name_fns.h"
 #include "src/util/proc_info.h"
+#include "src/util/trace.h"
 
 static int pack_xcast(prte_grpcomm_signature_t *sig, pmix_data_buffer_t *buffer,
                       pmix_data_buffer_t *message, prte_rml_tag_t tag);
@@ -88,6 +89,7 @@ int prte_grpcomm_API_xcast(prte_grpcomm_signature_t *sig, prte_rml_tag_t tag,
                          "%s grpcomm:base:xcast sending %u bytes to tag %ld",
                          PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                          (NULL == msg) ? 0 : (unsigned int) msg->bytes_used, (long) tag));
+    PRTE_TRACE(PRTE_TRACE_XCAST, tag, (NULL == msg) ? 0 : msg->bytes_used);
 
     /* this function does not access any framework-global data, and
      * so it does not require us to push it into the event library */
@@ -161,6 +163,8 @@ int prte_grpcomm_API_rbcast(prte_grpcomm_signature_t *sig, prte_rml_tag_t tag,
             }
         }
     }
+    /* the modules send copies */
+    PMIX_DATA_BUFFER_RELEASE(buf);
 
     return rc;
 }
@@ -252,6 +256,7 @@ int prte_grpcomm_API_allgather(prte_grpcomm_signature_t *sig, pmix_data_buffer_t
 
     PRTE_OUTPUT_VERBOSE((1, prte_grpcomm_base_framework.framework_output,
                          "%s grpcomm:base:allgather", PRTE_NAME_PRINT(PRTE_PROC_MY_NAME)));
+    PRTE_TRACE(PRTE_TRACE_ALLGATHER_BEGIN, sig->sz, (NULL == buf) ? 0 : buf->bytes_used);
 
     /* must push this into the event library to ensure we can
      * access framework-global data safely */
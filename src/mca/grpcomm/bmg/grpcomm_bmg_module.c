@@ -154,9 +154,10 @@ static int rbcast(pmix_data_buffer_t *buf)
                 PRTE_ERROR_LOG(rc);
                 return rc;
             }
-            if (0 > (rc = prte_rml.send_buffer_nb(&daemon, buf, PRTE_RML_TAG_RBCAST,
+            if (0 > (rc = prte_rml.send_buffer_nb(&daemon, sndbuf, PRTE_RML_TAG_RBCAST,
                                                   prte_rml_send_callback, NULL))) {
                 PRTE_ERROR_LOG(rc);
+                PMIX_DATA_BUFFER_RELEASE(sndbuf);
             }
         }
     }
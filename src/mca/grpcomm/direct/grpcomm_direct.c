@@ -34,6 +34,7 @@
 #include "src/util/nidmap.h"
 #include "src/util/proc_info.h"
 #include "src/util/show_help.h"
+#include "src/util/trace.h"
 
 #include "grpcomm_direct.h"
 #include "src/mca/grpcomm/base/base.h"
@@ -671,6 +672,8 @@ static void barrier_release(int status, pmix_proc_t *sender, pmix_data_buffer_t
         return;
     }
 
+    PRTE_TRACE(PRTE_TRACE_ALLGATHER_END, sig.sz, buffer->bytes_used);
+
     /* execute the callback */
     if (NULL != coll->cbfunc) {
         coll->cbfunc(ret, buffer, coll->cbdata);
@@ -44,6 +44,7 @@
 #include "src/runtime/prte_globals.h"
 #include "src/threads/threads.h"
 #include "src/util/name_fns.h"
+#include "src/util/trace.h"
 
 #include "src/mca/iof/base/base.h"
 
@@ -112,6 +113,7 @@ void prte_iof_base_write_handler(int _fd, short event, void *cbdata)
             return;
         }
         num_written = write(wev->fd, output->data, output->numbytes);
+        PRTE_TRACE(PRTE_TRACE_IOF_WRITE, wev->fd, (0 > num_written) ? 0 : num_written);
         if (num_written < 0) {
             if (EAGAIN == errno || EINTR == errno) {
                 /* push this item back on the front of the list */
@@ -43,6 +43,7 @@
 #include "src/runtime/prte_wait.h"
 #include "src/threads/threads.h"
 #include "src/util/name_fns.h"
+#include "src/util/trace.h"
 
 #include "src/mca/iof/base/base.h"
 #include "src/mca/iof/iof.h"
@@ -82,6 +83,7 @@ void prte_iof_hnp_read_local_handler(int fd, short event, void *cbdata)
     /* read up to the fragment size */
     memset(data, 0, PRTE_IOF_BASE_MSG_MAX);
     numbytes = read(fd, data, sizeof(data));
+    PRTE_TRACE(PRTE_TRACE_IOF_READ, rev->tag, (0 > numbytes) ? 0 : numbytes);
 
     if (NULL == proct) {
         /* this is an error - nothing we can do */
@@ -39,6 +39,7 @@
 #include "src/runtime/prte_globals.h"
 #include "src/threads/threads.h"
 #include "src/util/name_fns.h"
+#include "src/util/trace.h"
 
 #include "src/mca/iof/base/base.h"
 #include "src/mca/iof/iof.h"
@@ -76,6 +77,7 @@ void prte_iof_prted_read_handler(int fd, short event, void *cbdata)
 
     /* read up to the fragment size */
     numbytes = read(fd, data, sizeof(data));
+    PRTE_TRACE(PRTE_TRACE_IOF_READ, rev->tag, (0 > numbytes) ? 0 : numbytes);
 
     if (NULL == proct) {
         /* nothing we can do */
@@ -150,17 +150,130 @@ done:
     PRTE_PMIX_WAKEUP_THREAD(&cd->lock);
 }
 
+/* pack the daemon hosting each proc of a job as runs of procs on the
+ * same daemon - consecutive ranks are almost always placed together */
+int prte_odls_base_pack_locations(pmix_data_buffer_t *buf, prte_job_t *jptr)
+{
+    pmix_rank_t *rvals = NULL;
+    int32_t *rlens = NULL, nruns = 0;
+    prte_proc_t *proc;
+    int n, rc = PMIX_ERR_NOMEM;
+
+    if (0 < jptr->num_procs) {
+        rvals = (pmix_rank_t *) malloc(jptr->num_procs * sizeof(pmix_rank_t));
+        rlens = (int32_t *) malloc(jptr->num_procs * sizeof(int32_t));
+        if (NULL == rvals || NULL == rlens) {
+            goto done;
+        }
+    }
+    for (n = 0; n < jptr->procs->size && nruns <= (int32_t) jptr->num_procs; n++) {
+        if (NULL == (proc = (prte_proc_t *) prte_pointer_array_get_item(jptr->procs, n))) {
+            continue;
+        }
+        if (0 < nruns && rvals[nruns - 1] == proc->parent) {
+            rlens[nruns - 1]++;
+        } else if (nruns < (int32_t) jptr->num_procs) {
+            rvals[nruns] = proc->parent;
+            rlens[nruns] = 1;
+            ++nruns;
+        } else {
+            rc = PMIX_ERR_BAD_PARAM;
+            goto done;
+        }
+    }
+    rc = PMIx_Data_pack(NULL, buf, &nruns, 1, PMIX_INT32);
+    if (PMIX_SUCCESS == rc && 0 < nruns) {
+        rc = PMIx_Data_pack(NULL, buf, rvals, nruns, PMIX_PROC_RANK);
+    }
+    if (PMIX_SUCCESS == rc && 0 < nruns) {
+        rc = PMIx_Data_pack(NULL, buf, rlens, nruns, PMIX_INT32);
+    }
+
+done:
+    free(rvals);
+    free(rlens);
+    return rc;
+}
+
+/* connect each proc of a job to the node of its daemon, creating
+ * any procs we don't have yet and moving any that have changed */
+int prte_odls_base_unpack_locations(pmix_data_buffer_t *buf, prte_job_t *jptr,
+                                    prte_job_t *daemons, int *nmoved)
+{
+    pmix_rank_t *rvals = NULL, v = 0;
+    int32_t *rlens = NULL, nruns, cnt, r, k;
+    prte_proc_t *pptr, *dmn;
+    int rc;
+
+    cnt = 1;
+    rc = PMIx_Data_unpack(NULL, buf, &nruns, &cnt, PMIX_INT32);
+    if (PMIX_SUCCESS != rc) {
+        return rc;
+    }
+    if (0 > nruns || (int32_t) jptr->num_procs < nruns) {
+        return PMIX_ERR_UNPACK_FAILURE;
+    }
+    if (0 < nruns) {
+        rvals = (pmix_rank_t *) malloc(nruns * sizeof(pmix_rank_t));
+        rlens = (int32_t *) malloc(nruns * sizeof(int32_t));
+        if (NULL == rvals || NULL == rlens) {
+            rc = PMIX_ERR_NOMEM;
+            goto done;
+        }
+        cnt = nruns;
+        if (PMIX_SUCCESS != (rc = PMIx_Data_unpack(NULL, buf, rvals, &cnt, PMIX_PROC_RANK))) {
+            goto done;
+        }
+        cnt = nruns;
+        if (PMIX_SUCCESS != (rc = PMIx_Data_unpack(NULL, buf, rlens, &cnt, PMIX_INT32))) {
+            goto done;
+        }
+    }
+
+    for (r = 0; r < nruns; r++) {
+        /* lookup the daemon */
+        if (NULL == (dmn = (prte_proc_t *) prte_pointer_array_get_item(daemons->procs, rvals[r]))
+            || NULL == dmn->node) {
+            rc = PRTE_ERR_NOT_FOUND;
+            goto done;
+        }
+        for (k = 0; k < rlens[r] && v < jptr->num_procs; k++, v++) {
+            if (NULL == (pptr = (prte_proc_t *) prte_pointer_array_get_item(jptr->procs, v))) {
+                pptr = PRTE_NEW(prte_proc_t);
+                PMIX_LOAD_PROCID(&pptr->name, jptr->nspace, v);
+                prte_pointer_array_set_item(jptr->procs, v, pptr);
+            }
+            if (pptr->node == dmn->node) {
+                continue;
+            }
+            /* connect the two */
+            if (NULL != pptr->node) {
+                PRTE_RELEASE(pptr->node);
+                ++(*nmoved);
+            }
+            PRTE_RETAIN(dmn->node);
+            pptr->node = dmn->node;
+            pptr->parent = rvals[r];
+        }
+    }
+    rc = PRTE_SUCCESS;
+
+done:
+    free(rvals);
+    free(rlens);
+    return rc;
+}
+
 /* IT IS CRITICAL THAT ANY CHANGE IN THE ORDER OF THE INFO PACKED IN
  * THIS FUNCTION BE REFLECTED IN THE CONSTRUCT_CHILD_LIST PARSER BELOW
  */
 int prte_odls_base_default_get_add_procs_data(pmix_data_buffer_t *buffer, pmix_nspace_t job)
 {
-    int rc, n;
+    int rc, njobs = 0;
     prte_job_t *jdata = NULL, *jptr;
     prte_job_map_t *map = NULL;
     pmix_data_buffer_t jobdata, priorjob;
     int8_t flag;
-    prte_proc_t *proc;
     pmix_status_t ret;
     prte_node_t *node;
     int i, k;
@@ -186,10 +299,16 @@ int prte_odls_base_default_get_add_procs_data(pmix_data_buffer_t *buffer, pmix_n
         return PRTE_SUCCESS;
     }
 
+    /* the daemons are about to be told where this job's procs are */
+    jdata->version++;
+
     /* we need to ensure that any new daemons get a complete
      * copy of all active jobs so the grpcomm collectives can
      * properly work should a proc from one of the other jobs
-     * interact with this one */
+     * interact with this one. Each copy is tagged with the version
+     * of the job so that daemons already holding that version
+     * can skip it, and those holding an older one can just
+     * update the locations of its procs */
     if (prte_get_attribute(&jdata->attributes, PRTE_JOB_LAUNCHED_DAEMONS, NULL, PMIX_BOOL)) {
         flag = 1;
         rc = PMIx_Data_pack(NULL, buffer, &flag, 1, PMIX_INT8);
@@ -215,18 +334,12 @@ int prte_odls_base_default_get_add_procs_data(pmix_data_buffer_t *buffer, pmix_n
                     return rc;
                 }
                 /* pack the location of each proc */
-                for (n = 0; n < jptr->procs->size; n++) {
-                    if (NULL
-                        == (proc = (prte_proc_t *) prte_pointer_array_get_item(jptr->procs, n))) {
-                        continue;
-                    }
-                    rc = PMIx_Data_pack(NULL, &priorjob, &proc->parent, 1, PMIX_PROC_RANK);
-                    if (PMIX_SUCCESS != rc) {
-                        PMIX_ERROR_LOG(rc);
-                        PMIX_DATA_BUFFER_DESTRUCT(&jobdata);
-                        PMIX_DATA_BUFFER_DESTRUCT(&priorjob);
-                        return rc;
-                    }
+                rc = prte_odls_base_pack_locations(&priorjob, jptr);
+                if (PMIX_SUCCESS != rc) {
+                    PMIX_ERROR_LOG(rc);
+                    PMIX_DATA_BUFFER_DESTRUCT(&jobdata);
+                    PMIX_DATA_BUFFER_DESTRUCT(&priorjob);
+                    return rc;
                 }
                 /* unload the buffer */
                 rc = PMIx_Data_unload(&priorjob, &pbo);
@@ -236,14 +349,21 @@ int prte_odls_base_default_get_add_procs_data(pmix_data_buffer_t *buffer, pmix_n
                     PMIX_DATA_BUFFER_DESTRUCT(&jobdata);
                     return rc;
                 }
-                /* add it to the jobdata buffer */
-                rc = PMIx_Data_pack(NULL, &jobdata, &pbo, 1, PMIX_BYTE_OBJECT);
+                /* add it to the jobdata buffer behind its id and version */
+                rc = PMIx_Data_pack(NULL, &jobdata, &jptr->nspace, 1, PMIX_PROC_NSPACE);
+                if (PMIX_SUCCESS == rc) {
+                    rc = PMIx_Data_pack(NULL, &jobdata, &jptr->version, 1, PMIX_UINT32);
+                }
+                if (PMIX_SUCCESS == rc) {
+                    rc = PMIx_Data_pack(NULL, &jobdata, &pbo, 1, PMIX_BYTE_OBJECT);
+                }
                 PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
                 if (PMIX_SUCCESS != rc) {
                     PMIX_ERROR_LOG(rc);
                     PMIX_DATA_BUFFER_DESTRUCT(&jobdata);
                     return rc;
                 }
+                ++njobs;
             }
         }
         /* unload the buffer */
@@ -253,6 +373,10 @@ int prte_odls_base_default_get_add_procs_data(pmix_data_buffer_t *buffer, pmix_n
             PMIX_DATA_BUFFER_DESTRUCT(&jobdata);
             return rc;
         }
+        prte_output_verbose(1, prte_odls_base_framework.framework_output,
+                            "%s odls:add_procs new daemons for job %s - %d prior jobs in %lu bytes",
+                            PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_JOBID_PRINT(jdata->nspace),
+                            njobs, (unsigned long) pbo.size);
         /* add it to the message */
         rc = PMIx_Data_pack(NULL, buffer, &pbo, 1, PMIX_BYTE_OBJECT);
         PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
@@ -407,9 +531,11 @@ int prte_odls_base_default_construct_child_list(pmix_data_buffer_t *buffer, pmix
 {
     int rc;
     int32_t cnt;
-    prte_job_t *jdata = NULL, *daemons;
+    prte_job_t *jdata = NULL, *daemons, *jptr;
     prte_node_t *node;
-    pmix_rank_t dmnvpid, v;
+    pmix_nspace_t nspace;
+    uint32_t version;
+    int nadded = 0, npatched = 0, nskipped = 0, nmoved = 0;
     int32_t n;
     pmix_data_buffer_t dbuf, jdbuf;
     prte_proc_t *pptr, *dmn;
@@ -465,8 +591,29 @@ int prte_odls_base_default_construct_child_list(pmix_data_buffer_t *buffer, pmix
             goto REPORT_ERROR;
         }
         cnt = 1;
-        rc = PMIx_Data_unpack(NULL, &dbuf, &pbo, &cnt, PMIX_BYTE_OBJECT);
+        rc = PMIx_Data_unpack(NULL, &dbuf, &nspace, &cnt, PMIX_PROC_NSPACE);
         while (PMIX_SUCCESS == rc) {
+            cnt = 1;
+            rc = PMIx_Data_unpack(NULL, &dbuf, &version, &cnt, PMIX_UINT32);
+            if (PMIX_SUCCESS == rc) {
+                cnt = 1;
+                rc = PMIx_Data_unpack(NULL, &dbuf, &pbo, &cnt, PMIX_BYTE_OBJECT);
+            }
+            if (PMIX_SUCCESS != rc) {
+                PMIX_ERROR_LOG(rc);
+                PMIX_DATA_BUFFER_DESTRUCT(&dbuf);
+                rc = prte_pmix_convert_status(rc);
+                goto REPORT_ERROR;
+            }
+            jptr = prte_get_job_data_object(nspace);
+            if (NULL != jptr && jptr->version >= version) {
+                /* we already have this one */
+                PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
+                ++nskipped;
+                cnt = 1;
+                rc = PMIx_Data_unpack(NULL, &dbuf, &nspace, &cnt, PMIX_PROC_NSPACE);
+                continue;
+            }
             PMIX_DATA_BUFFER_CONSTRUCT(&jdbuf);
             rc = PMIx_Data_load(&jdbuf, &pbo);
             if (PMIX_SUCCESS != rc) {
@@ -483,50 +630,39 @@ int prte_odls_base_default_construct_child_list(pmix_data_buffer_t *buffer, pmix
                 PMIX_DATA_BUFFER_DESTRUCT(&jdbuf);
                 goto REPORT_ERROR;
             }
-            /* check to see if we already have this one */
-            if (NULL != prte_get_job_data_object(jdata->nspace)) {
-                /* yep - so we can drop this copy */
-                jdata->index = -1;
-                PRTE_RELEASE(jdata);
-            } else {
-                /* nope - add it */
+            if (NULL == jptr) {
+                /* new to us - add it */
                 prte_set_job_data_object(jdata);
-                /* unpack the location of each proc in this job */
-                for (v = 0; v < jdata->num_procs; v++) {
-                    if (NULL
-                        == (pptr = (prte_proc_t *) prte_pointer_array_get_item(jdata->procs, v))) {
-                        pptr = PRTE_NEW(prte_proc_t);
-                        PMIX_LOAD_PROCID(&pptr->name, jdata->nspace, v);
-                        prte_pointer_array_set_item(jdata->procs, v, pptr);
-                    }
-                    cnt = 1;
-                    rc = PMIx_Data_unpack(NULL, &jdbuf, &dmnvpid, &cnt, PMIX_PROC_RANK);
-                    if (PMIX_SUCCESS != rc) {
-                        PMIX_ERROR_LOG(rc);
-                        PMIX_DATA_BUFFER_DESTRUCT(&dbuf);
-                        PMIX_DATA_BUFFER_DESTRUCT(&jdbuf);
-                        goto REPORT_ERROR;
-                    }
-                    /* lookup the daemon */
-                    if (NULL
-                        == (dmn = (prte_proc_t *) prte_pointer_array_get_item(daemons->procs,
-                                                                              dmnvpid))) {
-                        PRTE_ERROR_LOG(PRTE_ERR_NOT_FOUND);
-                        rc = PRTE_ERR_NOT_FOUND;
-                        PMIX_DATA_BUFFER_DESTRUCT(&dbuf);
-                        PMIX_DATA_BUFFER_DESTRUCT(&jdbuf);
-                        goto REPORT_ERROR;
-                    }
-                    /* connect the two */
-                    PRTE_RETAIN(dmn->node);
-                    pptr->node = dmn->node;
+                jptr = jdata;
+                ++nadded;
+            } else {
+                /* we have an older copy - just bring the procs up to date */
+                if (jptr->num_procs < jdata->num_procs) {
+                    jptr->num_procs = jdata->num_procs;
                 }
+                jdata->index = -1;
+                PRTE_RELEASE(jdata);
+                ++npatched;
+            }
+            /* unpack the location of each proc in this job */
+            rc = prte_odls_base_unpack_locations(&jdbuf, jptr, daemons, &nmoved);
+            if (PRTE_SUCCESS != rc) {
+                PRTE_ERROR_LOG(rc);
+                PMIX_DATA_BUFFER_DESTRUCT(&dbuf);
+                PMIX_DATA_BUFFER_DESTRUCT(&jdbuf);
+                goto REPORT_ERROR;
             }
+            jptr->version = version;
             /* release the buffer */
             PMIX_DATA_BUFFER_DESTRUCT(&jdbuf);
             cnt = 1;
-            rc = PMIx_Data_unpack(NULL, &dbuf, &pbo, &cnt, PMIX_BYTE_OBJECT);
+            rc = PMIx_Data_unpack(NULL, &dbuf, &nspace, &cnt, PMIX_PROC_NSPACE);
         }
+        prte_output_verbose(1, prte_odls_base_framework.framework_output,
+                            "%s odls:construct_child_list prior jobs: %d added, %d updated "
+                            "(%d procs moved), %d already current",
+                            PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), nadded, npatched, nmoved,
+                            nskipped);
         PMIX_DATA_BUFFER_DESTRUCT(&dbuf);
         if (PMIX_SUCCESS != rc && PMIX_ERR_UNPACK_READ_PAST_END_OF_BUFFER != rc) {
             PMIX_ERROR_LOG(rc);
@@ -743,9 +879,10 @@ next:
                 /* keep tabs of the number of local procs */
                 jdata->num_local_procs++;
                 /* add this proc to our child list */
-                PRTE_RETAIN(pptr);
-                PRTE_FLAG_SET(pptr, PRTE_PROC_FLAG_LOCAL);
-                prte_pointer_array_add(prte_local_children, pptr);
+                if (PRTE_SUCCESS != (rc = prte_add_local_child(jdata, pptr))) {
+                    PRTE_ERROR_LOG(rc);
+                    goto REPORT_ERROR;
+                }
             }
 
             /* if the job is in restart mode, the child must not barrier when launched */
@@ -1063,6 +1200,17 @@ void prte_odls_base_spawn_proc(int fd, short sd, void *cbdata)
         cd->argv = prte_argv_copy(app->argv);
     }
 
+    /* let each element of a job array know which one it is - the
+     * ranks are laid out element by element */
+    if (0 < cd->array_size) {
+        prte_asprintf(&ptr, "%u", child->name.rank / (app->num_procs / cd->array_size));
+        prte_setenv("PRTE_ARRAY_INDEX", ptr, true, &cd->env);
+        free(ptr);
+        prte_asprintf(&ptr, "%u", cd->array_size);
+        prte_setenv("PRTE_ARRAY_SIZE", ptr, true, &cd->env);
+        free(ptr);
+    }
+
     /* if we are indexing the argv by rank, do so now */
     if (cd->index_argv) {
         char *param;
@@ -1113,6 +1261,7 @@ void prte_odls_base_default_launch_local(int fd, short sd, void *cbdata)
     pmix_nspace_t job;
     prte_odls_base_fork_local_proc_fn_t fork_local = caddy->fork_local;
     bool index_argv;
+    uint32_t array_size, *u32ptr;
     char *msg;
     prte_odls_spawn_caddy_t *cd;
     prte_event_base_t *evb;
@@ -1154,8 +1303,17 @@ void prte_odls_base_default_launch_local(int fd, short sd, void *cbdata)
     /* track if we are indexing argvs so we don't check every time */
     index_argv = prte_get_attribute(&jobdat->attributes, PRTE_JOB_INDEX_ARGV, NULL, PMIX_BOOL);
 
-    /* compute the total number of local procs currently alive and about to be launched */
-    total_num_local_procs = compute_num_procs_alive(job) + jobdat->num_local_procs;
+    /* likewise for job arrays */
+    array_size = 0;
+    u32ptr = &array_size;
+    prte_get_attribute(&jobdat->attributes, PRTE_JOB_ARRAY_SIZE, (void **) &u32ptr, PMIX_UINT32);
+
+    /* compute the total number of local procs currently alive and about to be
+     * launched - this means looking at every child, so only do it if there
+     * is a limit to check it against */
+    if (0 < prte_sys_limits.num_procs || 0 < prte_sys_limits.num_files) {
+        total_num_local_procs = compute_num_procs_alive(job) + jobdat->num_local_procs;
+    }
 
     /* check the system limits - if we are at our max allowed children, then
      * we won't be allowed to do this anyway, so we may as well abort now.
@@ -1196,16 +1354,14 @@ void prte_odls_base_default_launch_local(int fd, short sd, void *cbdata)
         if (prte_sys_limits.num_files < limit) {
             if (2 < caddy->retries) {
                 /* tried enough - give up */
-                for (idx = 0; idx < prte_local_children->size; idx++) {
+                for (idx = 0; idx < jobdat->local_children.size; idx++) {
                     if (NULL
-                        == (child = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children,
-                                                                                idx))) {
+                        == (child = (prte_proc_t *)
+                                prte_pointer_array_get_item(&jobdat->local_children, idx))) {
                         continue;
                     }
-                    if (PMIX_CHECK_NSPACE(job, child->name.nspace)) {
-                        child->exit_code = PRTE_PROC_STATE_FAILED_TO_LAUNCH;
-                        PRTE_ACTIVATE_PROC_STATE(&child->name, PRTE_PROC_STATE_FAILED_TO_LAUNCH);
-                    }
+                    child->exit_code = PRTE_PROC_STATE_FAILED_TO_LAUNCH;
+                    PRTE_ACTIVATE_PROC_STATE(&child->name, PRTE_PROC_STATE_FAILED_TO_LAUNCH);
                 }
                 goto ERROR_OUT;
             }
@@ -1243,12 +1399,12 @@ void prte_odls_base_default_launch_local(int fd, short sd, void *cbdata)
              * so we can report things out correctly
              */
             /* cycle through children to find those for this jobid */
-            for (idx = 0; idx < prte_local_children->size; idx++) {
-                child = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children, idx);
+            for (idx = 0; idx < jobdat->local_children.size; idx++) {
+                child = (prte_proc_t *) prte_pointer_array_get_item(&jobdat->local_children, idx);
                 if (NULL == child) {
                     continue;
                 }
-                if (PMIX_CHECK_NSPACE(job, child->name.nspace) && j == (int) child->app_idx) {
+                if (j == (int) child->app_idx) {
                     child->exit_code = rc;
                     PRTE_ACTIVATE_PROC_STATE(&child->name, PRTE_PROC_STATE_FAILED_TO_LAUNCH);
                 }
@@ -1271,12 +1427,12 @@ void prte_odls_base_default_launch_local(int fd, short sd, void *cbdata)
              * so we can report things out correctly
              */
             /* cycle through children to find those for this jobid */
-            for (idx = 0; idx < prte_local_children->size; idx++) {
-                child = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children, idx);
+            for (idx = 0; idx < jobdat->local_children.size; idx++) {
+                child = (prte_proc_t *) prte_pointer_array_get_item(&jobdat->local_children, idx);
                 if (NULL == child) {
                     continue;
                 }
-                if (PMIX_CHECK_NSPACE(job, child->name.nspace) && j == (int) child->app_idx) {
+                if (j == (int) child->app_idx) {
                     child->exit_code = PRTE_PROC_STATE_FAILED_TO_LAUNCH;
                     PRTE_ACTIVATE_PROC_STATE(&child->name, PRTE_PROC_STATE_FAILED_TO_LAUNCH);
                 }
@@ -1287,12 +1443,12 @@ void prte_odls_base_default_launch_local(int fd, short sd, void *cbdata)
         /* setup any local files that were prepositioned for us */
         if (PRTE_SUCCESS != (rc = prte_filem.link_local_files(jobdat, app))) {
             /* cycle through children to find those for this jobid */
-            for (idx = 0; idx < prte_local_children->size; idx++) {
-                child = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children, idx);
+            for (idx = 0; idx < jobdat->local_children.size; idx++) {
+                child = (prte_proc_t *) prte_pointer_array_get_item(&jobdat->local_children, idx);
                 if (NULL == child) {
                     continue;
                 }
-                if (PMIX_CHECK_NSPACE(job, child->name.nspace) && j == (int) child->app_idx) {
+                if (j == (int) child->app_idx) {
                     child->exit_code = rc;
                     PRTE_ACTIVATE_PROC_STATE(&child->name, PRTE_PROC_STATE_FAILED_TO_LAUNCH);
                 }
@@ -1335,12 +1491,12 @@ void prte_odls_base_default_launch_local(int fd, short sd, void *cbdata)
         }
         if (PRTE_SUCCESS != rc) {
             /* cycle through children to find those for this jobid */
-            for (idx = 0; idx < prte_local_children->size; idx++) {
-                child = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children, idx);
+            for (idx = 0; idx < jobdat->local_children.size; idx++) {
+                child = (prte_proc_t *) prte_pointer_array_get_item(&jobdat->local_children, idx);
                 if (NULL == child) {
                     continue;
                 }
-                if (PMIX_CHECK_NSPACE(job, child->name.nspace) && j == (int) child->app_idx) {
+                if (j == (int) child->app_idx) {
                     child->exit_code = rc;
                     PRTE_ACTIVATE_PROC_STATE(&child->name, PRTE_PROC_STATE_FAILED_TO_LAUNCH);
                 }
@@ -1353,12 +1509,12 @@ void prte_odls_base_default_launch_local(int fd, short sd, void *cbdata)
             prte_show_help("help-prte-odls-default.txt", "set limit", true,
                            prte_process_info.nodename, app, __FILE__, __LINE__, msg);
             /* cycle through children to find those for this jobid */
-            for (idx = 0; idx < prte_local_children->size; idx++) {
-                child = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children, idx);
+            for (idx = 0; idx < jobdat->local_children.size; idx++) {
+                child = (prte_proc_t *) prte_pointer_array_get_item(&jobdat->local_children, idx);
                 if (NULL == child) {
                     continue;
                 }
-                if (PMIX_CHECK_NSPACE(job, child->name.nspace) && j == (int) child->app_idx) {
+                if (j == (int) child->app_idx) {
                     child->exit_code = rc;
                     PRTE_ACTIVATE_PROC_STATE(&child->name, PRTE_PROC_STATE_FAILED_TO_LAUNCH);
                 }
@@ -1380,8 +1536,8 @@ void prte_odls_base_default_launch_local(int fd, short sd, void *cbdata)
 
         /* okay, now let's launch all the local procs for this app using the provided fork_local fn
          */
-        for (idx = 0; idx < prte_local_children->size; idx++) {
-            child = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children, idx);
+        for (idx = 0; idx < jobdat->local_children.size; idx++) {
+            child = (prte_proc_t *) prte_pointer_array_get_item(&jobdat->local_children, idx);
             if (NULL == child) {
                 continue;
             }
@@ -1410,20 +1566,6 @@ void prte_odls_base_default_launch_local(int fd, short sd, void *cbdata)
                 PRTE_PROC_STATE_RESTART != child->state) {
                 continue;
             }
-            /* do we have a child from the specified job. Because the
-             * job could be given as a WILDCARD value, we must use
-             * the dss.compare function to check for equality.
-             */
-            if (!PMIX_CHECK_NSPACE(job, child->name.nspace)) {
-
-                PRTE_OUTPUT_VERBOSE((5, prte_odls_base_framework.framework_output,
-                                     "%s odls:launch child %s is not in job %s being launched",
-                                     PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                     PRTE_NAME_PRINT(&child->name), PRTE_JOBID_PRINT(job)));
-
-                continue;
-            }
-
             PRTE_OUTPUT_VERBOSE((5, prte_odls_base_framework.framework_output,
                                  "%s odls:launch working child %s",
                                  PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
@@ -1449,6 +1591,7 @@ void prte_odls_base_default_launch_local(int fd, short sd, void *cbdata)
             cd->child = child;
             cd->fork_local = fork_local;
             cd->index_argv = index_argv;
+            cd->array_size = array_size;
             /* setup any IOF */
             cd->opts.usepty = PRTE_ENABLE_PTY_SUPPORT;
 
@@ -1506,6 +1649,7 @@ int prte_odls_base_default_signal_local_procs(const pmix_proc_t *proc, int32_t s
 {
     int rc, i;
     prte_proc_t *child;
+    prte_job_t *jdata;
 
     PRTE_OUTPUT_VERBOSE((5, prte_odls_base_framework.framework_output, "%s odls: signaling proc %s",
                          PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
@@ -1533,16 +1677,18 @@ int prte_odls_base_default_signal_local_procs(const pmix_proc_t *proc, int32_t s
     }
 
     /* we want it sent to some specified process, so find it */
-    for (i = 0; i < prte_local_children->size; i++) {
-        child = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children, i);
-        if (NULL == child) {
-            continue;
-        }
-        if (PMIX_CHECK_PROCID(&child->name, proc)) {
-            if (PRTE_SUCCESS != (rc = signal_local(child->pid, (int) signal))) {
-                PRTE_ERROR_LOG(rc);
+    if (NULL != (jdata = prte_get_job_data_object(proc->nspace))) {
+        for (i = 0; i < jdata->local_children.size; i++) {
+            child = (prte_proc_t *) prte_pointer_array_get_item(&jdata->local_children, i);
+            if (NULL == child) {
+                continue;
+            }
+            if (PMIX_CHECK_PROCID(&child->name, proc)) {
+                if (PRTE_SUCCESS != (rc = signal_local(child->pid, (int) signal))) {
+                    PRTE_ERROR_LOG(rc);
+                }
+                return rc;
             }
-            return rc;
         }
     }
 
@@ -1681,14 +1827,11 @@ void prte_odls_base_default_wait_local_proc(int fd, short sd, void *cbdata)
             }
         } else {
             /* has any child in this job already registered? */
-            for (i = 0; i < prte_local_children->size; i++) {
-                cptr = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children, i);
+            for (i = 0; i < jobdat->local_children.size; i++) {
+                cptr = (prte_proc_t *) prte_pointer_array_get_item(&jobdat->local_children, i);
                 if (NULL == cptr) {
                     continue;
                 }
-                if (!PMIX_CHECK_NSPACE(cptr->name.nspace, proc->name.nspace)) {
-                    continue;
-                }
                 if (PRTE_FLAG_TEST(cptr, PRTE_PROC_FLAG_REG) && !prte_allowed_exit_without_sync) {
                     /* someone has registered, and we didn't before
                      * terminating - this is an abnormal termination unless
@@ -1801,12 +1944,91 @@ static void qcddes(prte_odls_quick_caddy_t *p)
 }
 PRTE_CLASS_INSTANCE(prte_odls_quick_caddy_t, prte_list_item_t, qcdcon, qcddes);
 
+/*
+ * Start killing one of our children - a live child is sent SIGCONT
+ * and added to procs_killed so the caller can follow up with SIGTERM
+ * and SIGKILL
+ */
+static void kill_child(prte_proc_t *child, prte_list_t *procs_killed,
+                       prte_odls_base_kill_local_fn_t kill_local)
+{
+    prte_odls_quick_caddy_t *cd;
+
+    /* is this process alive? if not, then nothing for us
+     * to do to it
+     */
+    if (!PRTE_FLAG_TEST(child, PRTE_PROC_FLAG_ALIVE) || 0 == child->pid) {
+
+        PRTE_OUTPUT_VERBOSE((5, prte_odls_base_framework.framework_output,
+                             "%s odls:kill_local_proc child %s is not alive",
+                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                             PRTE_NAME_PRINT(&child->name)));
+
+        /* ensure, though, that the state is terminated so we don't lockup if
+         * the proc never started
+         */
+        if (PRTE_PROC_STATE_UNDEF == child->state || PRTE_PROC_STATE_INIT == child->state
+            || PRTE_PROC_STATE_RUNNING == child->state) {
+            /* we can't be sure what happened, but make sure we
+             * at least have a value that will let us eventually wakeup
+             */
+            child->state = PRTE_PROC_STATE_TERMINATED;
+            /* ensure we realize that the waitpid will never come, if
+             * it already hasn't
+             */
+            PRTE_FLAG_SET(child, PRTE_PROC_FLAG_WAITPID);
+            child->pid = 0;
+            goto CLEANUP;
+        } else {
+            return;
+        }
+    }
+
+    /* ensure the stdin IOF channel for this child is closed. The other
+     * channels will automatically close when the proc is killed
+     */
+    if (NULL != prte_iof.close) {
+        prte_iof.close(&child->name, PRTE_IOF_STDIN);
+    }
+
+    /* cancel the waitpid callback as this induces unmanageable race
+     * conditions when we are deliberately killing the process
+     */
+    prte_wait_cb_cancel(child);
+
+    /* First send a SIGCONT in case the process is in stopped state.
+       If it is in a stopped state and we do not first change it to
+       running, then SIGTERM will not get delivered.  Ignore return
+       value. */
+    PRTE_OUTPUT_VERBOSE((5, prte_odls_base_framework.framework_output,
+                         "%s SENDING SIGCONT TO %s", PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                         PRTE_NAME_PRINT(&child->name)));
+    cd = PRTE_NEW(prte_odls_quick_caddy_t);
+    PRTE_RETAIN(child);
+    cd->child = child;
+    prte_list_append(procs_killed, &cd->super);
+    kill_local(child->pid, SIGCONT);
+    return;
+
+CLEANUP:
+    /* ensure the child's session directory is cleaned up */
+    prte_session_dir_finalize(&child->name);
+    /* check for everything complete - this will remove
+     * the child object from our local list
+     */
+    if (!prte_finalizing && PRTE_FLAG_TEST(child, PRTE_PROC_FLAG_IOF_COMPLETE)
+        && PRTE_FLAG_TEST(child, PRTE_PROC_FLAG_WAITPID)) {
+        PRTE_ACTIVATE_PROC_STATE(&child->name, child->state);
+    }
+}
+
 int prte_odls_base_default_kill_local_procs(prte_pointer_array_t *procs,
                                             prte_odls_base_kill_local_fn_t kill_local)
 {
     prte_proc_t *child;
     prte_list_t procs_killed;
     prte_proc_t *proc, proctmp;
+    prte_job_t *jdata;
     int i, j, ret;
     prte_pointer_array_t procarray, *procptr;
     bool do_cleanup;
@@ -1839,112 +2061,42 @@ int prte_odls_base_default_kill_local_procs(prte_pointer_array_t *procs,
         if (NULL == (proc = (prte_proc_t *) prte_pointer_array_get_item(procptr, i))) {
             continue;
         }
-        for (j = 0; j < prte_local_children->size; j++) {
-            child = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children, j);
-            if (NULL == child) {
-                continue;
+        /* a WILDCARD job covers all of our children */
+        if (PMIX_NSPACE_INVALID(proc->name.nspace)) {
+            for (j = 0; j < prte_local_children->size; j++) {
+                child = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children, j);
+                if (NULL != child) {
+                    kill_child(child, &procs_killed, kill_local);
+                }
             }
-
+            continue;
+        }
+        /* otherwise, only look at the children of the specified job */
+        if (NULL == (jdata = prte_get_job_data_object(proc->name.nspace))) {
             PRTE_OUTPUT_VERBOSE((5, prte_odls_base_framework.framework_output,
-                                 "%s odls:kill_local_proc checking child process %s",
+                                 "%s odls:kill_local_proc job %s is not known",
                                  PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                 PRTE_NAME_PRINT(&child->name)));
-
-            /* do we have a child from the specified job? Because the
-             *  job could be given as a WILDCARD value, we must
-             *  check for that as well as for equality.
-             */
-            if (!PMIX_NSPACE_INVALID(proc->name.nspace)
-                && !PMIX_CHECK_NSPACE(proc->name.nspace, child->name.nspace)) {
-
-                PRTE_OUTPUT_VERBOSE((5, prte_odls_base_framework.framework_output,
-                                     "%s odls:kill_local_proc child %s is not part of job %s",
-                                     PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                     PRTE_NAME_PRINT(&child->name),
-                                     PRTE_JOBID_PRINT(proc->name.nspace)));
-                continue;
-            }
-
-            /* see if this is the specified proc - could be a WILDCARD again, so check
-             * appropriately
-             */
-            if (PMIX_RANK_WILDCARD != proc->name.rank && proc->name.rank != child->name.rank) {
-
-                PRTE_OUTPUT_VERBOSE((5, prte_odls_base_framework.framework_output,
-                                     "%s odls:kill_local_proc child %s is not covered by rank %s",
-                                     PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                     PRTE_NAME_PRINT(&child->name),
-                                     PRTE_VPID_PRINT(proc->name.rank)));
-                continue;
-            }
-
-            /* is this process alive? if not, then nothing for us
-             * to do to it
-             */
-            if (!PRTE_FLAG_TEST(child, PRTE_PROC_FLAG_ALIVE) || 0 == child->pid) {
-
-                PRTE_OUTPUT_VERBOSE((5, prte_odls_base_framework.framework_output,
-                                     "%s odls:kill_local_proc child %s is not alive",
-                                     PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                     PRTE_NAME_PRINT(&child->name)));
-
-                /* ensure, though, that the state is terminated so we don't lockup if
-                 * the proc never started
-                 */
-                if (PRTE_PROC_STATE_UNDEF == child->state || PRTE_PROC_STATE_INIT == child->state
-                    || PRTE_PROC_STATE_RUNNING == child->state) {
-                    /* we can't be sure what happened, but make sure we
-                     * at least have a value that will let us eventually wakeup
-                     */
-                    child->state = PRTE_PROC_STATE_TERMINATED;
-                    /* ensure we realize that the waitpid will never come, if
-                     * it already hasn't
-                     */
-                    PRTE_FLAG_SET(child, PRTE_PROC_FLAG_WAITPID);
-                    child->pid = 0;
-                    goto CLEANUP;
-                } else {
-                    continue;
+                                 PRTE_JOBID_PRINT(proc->name.nspace)));
+            continue;
+        }
+        if (PMIX_RANK_WILDCARD == proc->name.rank) {
+            for (j = 0; j < jdata->local_children.size; j++) {
+                child = (prte_proc_t *) prte_pointer_array_get_item(&jdata->local_children, j);
+                if (NULL != child) {
+                    kill_child(child, &procs_killed, kill_local);
                 }
             }
-
-            /* ensure the stdin IOF channel for this child is closed. The other
-             * channels will automatically close when the proc is killed
-             */
-            if (NULL != prte_iof.close) {
-                prte_iof.close(&child->name, PRTE_IOF_STDIN);
-            }
-
-            /* cancel the waitpid callback as this induces unmanageable race
-             * conditions when we are deliberately killing the process
-             */
-            prte_wait_cb_cancel(child);
-
-            /* First send a SIGCONT in case the process is in stopped state.
-               If it is in a stopped state and we do not first change it to
-               running, then SIGTERM will not get delivered.  Ignore return
-               value. */
+            continue;
+        }
+        /* a specific rank is only ours if it is on our list of children */
+        child = (prte_proc_t *) prte_pointer_array_get_item(jdata->procs, proc->name.rank);
+        if (NULL == child || 0 > child->local_index) {
             PRTE_OUTPUT_VERBOSE((5, prte_odls_base_framework.framework_output,
-                                 "%s SENDING SIGCONT TO %s", PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                 PRTE_NAME_PRINT(&child->name)));
-            cd = PRTE_NEW(prte_odls_quick_caddy_t);
-            PRTE_RETAIN(child);
-            cd->child = child;
-            prte_list_append(&procs_killed, &cd->super);
-            kill_local(child->pid, SIGCONT);
+                                 "%s odls:kill_local_proc %s is not one of our children",
+                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_NAME_PRINT(&proc->name)));
             continue;
-
-        CLEANUP:
-            /* ensure the child's session directory is cleaned up */
-            prte_session_dir_finalize(&child->name);
-            /* check for everything complete - this will remove
-             * the child object from our local list
-             */
-            if (!prte_finalizing && PRTE_FLAG_TEST(child, PRTE_PROC_FLAG_IOF_COMPLETE)
-                && PRTE_FLAG_TEST(child, PRTE_PROC_FLAG_WAITPID)) {
-                PRTE_ACTIVATE_PROC_STATE(&child->name, child->state);
-            }
         }
+        kill_child(child, &procs_killed, kill_local);
     }
 
     /* if we are issuing signals, then we need to wait a little
@@ -2031,6 +2183,7 @@ int prte_odls_base_default_restart_proc(prte_proc_t *child,
     char *wdir = NULL;
     prte_odls_spawn_caddy_t *cd;
     prte_event_base_t *evb;
+    uint32_t *u32ptr;
 
     PRTE_OUTPUT_VERBOSE((5, prte_odls_base_framework.framework_output,
                          "%s odls:restart_proc for proc %s", PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
@@ -2092,6 +2245,9 @@ int prte_odls_base_default_restart_proc(prte_proc_t *child,
     cd->app = app;
     cd->child = child;
     cd->fork_local = fork_local;
+    cd->index_argv = prte_get_attribute(&jobdat->attributes, PRTE_JOB_INDEX_ARGV, NULL, PMIX_BOOL);
+    u32ptr = &cd->array_size;
+    prte_get_attribute(&jobdat->attributes, PRTE_JOB_ARRAY_SIZE, (void **) &u32ptr, PMIX_UINT32);
     /* setup any IOF */
     cd->opts.usepty = PRTE_ENABLE_PTY_SUPPORT;
 
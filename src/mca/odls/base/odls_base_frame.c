@@ -339,6 +339,8 @@ static void sccon(prte_odls_spawn_caddy_t *p)
     p->wdir = NULL;
     p->argv = NULL;
     p->env = NULL;
+    p->index_argv = false;
+    p->array_size = 0;
 }
 static void scdes(prte_odls_spawn_caddy_t *p)
 {
@@ -86,6 +86,17 @@ PRTE_EXPORT int prte_odls_base_default_construct_child_list(pmix_data_buffer_t *
 
 PRTE_EXPORT void prte_odls_base_spawn_proc(int fd, short sd, void *cbdata);
 
+/* pack the daemon hosting each proc of a job, as runs of procs
+ * hosted by the same daemon */
+PRTE_EXPORT int prte_odls_base_pack_locations(pmix_data_buffer_t *buf, prte_job_t *jptr);
+
+/* unpack the locations packed by prte_odls_base_pack_locations,
+ * connecting each proc of the job to the node of its daemon - procs
+ * we don't have yet are created, and nmoved is incremented for each
+ * proc that was already on a different node */
+PRTE_EXPORT int prte_odls_base_unpack_locations(pmix_data_buffer_t *buf, prte_job_t *jptr,
+                                                prte_job_t *daemons, int *nmoved);
+
 /* define a function that will fork a local proc */
 typedef int (*prte_odls_base_fork_local_proc_fn_t)(void *cd);
 
@@ -101,6 +112,7 @@ typedef struct {
     prte_app_context_t *app;
     prte_proc_t *child;
     bool index_argv;
+    uint32_t array_size; /* number of job array elements, or 0 if not an array */
     prte_iof_base_io_conf_t opts;
     prte_odls_base_fork_local_proc_fn_t fork_local;
 } prte_odls_spawn_caddy_t;
@@ -120,6 +120,7 @@
 #include "src/util/prte_environ.h"
 #include "src/util/show_help.h"
 #include "src/util/sys_limits.h"
+#include "src/util/trace.h"
 
 #include "src/mca/errmgr/errmgr.h"
 #include "src/mca/ess/ess.h"
@@ -591,7 +592,7 @@ static int do_parent(prte_odls_spawn_caddy_t *cd, int read_fd)
 static int odls_default_fork_local_proc(void *cdptr)
 {
     prte_odls_spawn_caddy_t *cd = (prte_odls_spawn_caddy_t *) cdptr;
-    int p[2];
+    int p[2], rc;
     pid_t pid;
     prte_proc_t *child = cd->child;
 
@@ -613,6 +614,7 @@ static int odls_default_fork_local_proc(void *cdptr)
     }
 
     /* Fork off the child */
+    PRTE_TRACE(PRTE_TRACE_FORK_BEGIN, 0, (NULL == child) ? PMIX_RANK_INVALID : child->name.rank);
     pid = fork();
     if (NULL != child) {
         child->pid = pid;
@@ -634,7 +636,10 @@ static int odls_default_fork_local_proc(void *cdptr)
     }
 
     close(p[1]);
-    return do_parent(cd, p[0]);
+    rc = do_parent(cd, p[0]);
+    /* do_parent returns once the exec has been confirmed */
+    PRTE_TRACE(PRTE_TRACE_FORK_END, pid, (NULL == child) ? PMIX_RANK_INVALID : child->name.rank);
+    return rc;
 }
 
 /**
@@ -90,6 +90,9 @@ typedef uint8_t prte_daemon_cmd_flag_t;
 /* tell DVM daemons to cleanup resources from job */
 #define PRTE_DAEMON_DVM_CLEANUP_JOB_CMD (prte_daemon_cmd_flag_t) 34
 
+/* for debug purposes, write out the trace event rings */
+#define PRTE_DAEMON_DUMP_TRACE_CMD (prte_daemon_cmd_flag_t) 35
+
 /*
  * Struct written up the pipe from the child to the parent.
  */
@@ -45,6 +45,7 @@
 #include "src/class/prte_bitmap.h"
 #include "src/class/prte_hash_table.h"
 #include "src/class/prte_list.h"
+#include "src/class/prte_pointer_array.h"
 #include "src/event/event-internal.h"
 #include "src/util/printf.h"
 
@@ -58,6 +59,24 @@ BEGIN_C_DECLS
 /*
  * Convenience Typedef
  */
+/* index of peers by name - see oob_base_peer_index.c */
+typedef struct {
+    prte_object_t super;
+    prte_pointer_array_t daemons; // peers in our own nspace, by rank
+    prte_hash_table_t jobs;       // nspace -> prte_pointer_array_t of peers, by rank
+} prte_oob_base_peer_index_t;
+PRTE_EXPORT PRTE_CLASS_DECLARATION(prte_oob_base_peer_index_t);
+
+/* ranks that can be held in the index - anything beyond has
+ * to be searched for */
+#define PRTE_OOB_BASE_PEER_INDEXABLE(n) ((n)->rank < (pmix_rank_t) INT_MAX)
+
+PRTE_EXPORT void *prte_oob_base_peer_index_get(prte_oob_base_peer_index_t *idx,
+                                               const pmix_proc_t *name);
+/* set the entry for name to peer, or clear it if peer is NULL */
+PRTE_EXPORT int prte_oob_base_peer_index_set(prte_oob_base_peer_index_t *idx,
+                                             const pmix_proc_t *name, void *peer);
+
 typedef struct {
     char *include;
     char *exclude;
@@ -65,6 +84,7 @@ typedef struct {
     prte_list_t actives;
     int max_uri_length;
     prte_list_t peers;
+    prte_oob_base_peer_index_t peer_index;
 } prte_oob_base_t;
 PRTE_EXPORT extern prte_oob_base_t prte_oob_base;
 
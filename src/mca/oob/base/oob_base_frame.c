@@ -70,6 +70,7 @@ static int prte_oob_base_close(void)
     PRTE_DESTRUCT(&prte_oob_base.actives);
 
     /* release all peers from the list */
+    PRTE_DESTRUCT(&prte_oob_base.peer_index);
     PRTE_LIST_DESTRUCT(&prte_oob_base.peers);
 
     return prte_mca_base_framework_components_close(&prte_oob_base_framework, NULL);
@@ -84,6 +85,7 @@ static int prte_oob_base_open(prte_mca_base_open_flag_t flags)
     /* setup globals */
     prte_oob_base.max_uri_length = -1;
     PRTE_CONSTRUCT(&prte_oob_base.peers, prte_list_t);
+    PRTE_CONSTRUCT(&prte_oob_base.peer_index, prte_oob_base_peer_index_t);
     PRTE_CONSTRUCT(&prte_oob_base.actives, prte_list_t);
 
     /* Open up all available components */
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2021      Nanook Consulting.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+/** @file
+ *
+ * Index of peer objects by process name.
+ *
+ * The daemons of our own DVM are by far the most common peers, so they
+ * are kept in an array indexed directly by rank. Peers in any other
+ * nspace are found by hashing the nspace to an array of that job's
+ * peers, again indexed by rank - so a lookup never has to compare the
+ * name against every known peer. The index does not hold a reference
+ * on the peers; whoever owns them must clear their entry before
+ * releasing them.
+ */
+
+#include "prte_config.h"
+#include "constants.h"
+
+#include <limits.h>
+#include <string.h>
+
+#include "src/class/prte_hash_table.h"
+#include "src/class/prte_pointer_array.h"
+#include "src/mca/errmgr/errmgr.h"
+#include "src/util/proc_info.h"
+
+#include "src/mca/oob/base/base.h"
+
+static void picon(prte_oob_base_peer_index_t *p)
+{
+    PRTE_CONSTRUCT(&p->daemons, prte_pointer_array_t);
+    prte_pointer_array_init(&p->daemons, 64, INT_MAX, 64);
+    PRTE_CONSTRUCT(&p->jobs, prte_hash_table_t);
+    prte_hash_table_init(&p->jobs, 16);
+}
+static void pides(prte_oob_base_peer_index_t *p)
+{
+    prte_pointer_array_t *array;
+    void *key, *node = NULL;
+    size_t keysize;
+    int rc;
+
+    PRTE_DESTRUCT(&p->daemons);
+    rc = prte_hash_table_get_first_key_ptr(&p->jobs, &key, &keysize, (void **) &array, &node);
+    while (PRTE_SUCCESS == rc) {
+        PRTE_RELEASE(array);
+        rc = prte_hash_table_get_next_key_ptr(&p->jobs, &key, &keysize, (void **) &array, node,
+                                              &node);
+    }
+    PRTE_DESTRUCT(&p->jobs);
+}
+PRTE_CLASS_INSTANCE(prte_oob_base_peer_index_t, prte_object_t, picon, pides);
+
+static prte_pointer_array_t *job_array(prte_oob_base_peer_index_t *idx, const pmix_nspace_t nspace,
+                                       bool create)
+{
+    prte_pointer_array_t *array = NULL;
+    size_t len;
+
+    if (PMIX_CHECK_NSPACE(nspace, PRTE_PROC_MY_NAME->nspace)) {
+        return &idx->daemons;
+    }
+    len = strnlen(nspace, PMIX_MAX_NSLEN);
+    if (PRTE_SUCCESS
+            != prte_hash_table_get_value_ptr(&idx->jobs, nspace, len, (void **) &array)
+        && create) {
+        array = PRTE_NEW(prte_pointer_array_t);
+        prte_pointer_array_init(array, 8, INT_MAX, 8);
+        prte_hash_table_set_value_ptr(&idx->jobs, nspace, len, array);
+    }
+    return array;
+}
+
+void *prte_oob_base_peer_index_get(prte_oob_base_peer_index_t *idx, const pmix_proc_t *name)
+{
+    prte_pointer_array_t *array;
+
+    if (!PRTE_OOB_BASE_PEER_INDEXABLE(name)
+        || NULL == (array = job_array(idx, name->nspace, false))) {
+        return NULL;
+    }
+    return prte_pointer_array_get_item(array, name->rank);
+}
+
+int prte_oob_base_peer_index_set(prte_oob_base_peer_index_t *idx, const pmix_proc_t *name,
+                                 void *peer)
+{
+    prte_pointer_array_t *array;
+
+    if (!PRTE_OOB_BASE_PEER_INDEXABLE(name)) {
+        return PRTE_ERR_BAD_PARAM;
+    }
+    if (NULL == (array = job_array(idx, name->nspace, NULL != peer))) {
+        /* nothing to clear */
+        return PRTE_SUCCESS;
+    }
+    return prte_pointer_array_set_item(array, name->rank, peer);
+}
@@ -331,6 +331,7 @@ static void process_uri(char *uri)
         pr = PRTE_NEW(prte_oob_base_peer_t);
         PMIX_XFER_PROCID(&pr->name, &peer);
         prte_list_append(&prte_oob_base.peers, &pr->super);
+        prte_oob_base_peer_index_set(&prte_oob_base.peer_index, &peer, pr);
     }
 
     /* loop across all available components and let them extract
@@ -370,6 +371,10 @@ prte_oob_base_peer_t *prte_oob_base_get_peer(const pmix_proc_t *pr)
 {
     prte_oob_base_peer_t *peer;
 
+    if (PRTE_OOB_BASE_PEER_INDEXABLE(pr)) {
+        return (prte_oob_base_peer_t *) prte_oob_base_peer_index_get(&prte_oob_base.peer_index,
+                                                                     pr);
+    }
     PRTE_LIST_FOREACH(peer, &prte_oob_base.peers, prte_oob_base_peer_t)
     {
         if (PMIX_CHECK_PROCID(pr, &peer->name)) {
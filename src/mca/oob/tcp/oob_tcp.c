@@ -96,7 +96,8 @@ static void accept_connection(const int accepted_fd, const struct sockaddr *addr
                         "%s accept_connection: %s:%d\n", PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                         prte_net_get_hostname(addr), prte_net_get_port(addr));
 
-    /* setup socket options */
+    /* setup socket options - the listener already made the
+     * socket non-blocking */
     prte_oob_tcp_set_socket_options(accepted_fd);
 
     /* use a one-time event to wait for receipt of peer's
@@ -208,6 +209,60 @@ static void send_nb(prte_rml_send_t *msg)
     }
 }
 
+/*
+ * Collect as much of the peer's handshake as the socket has available.
+ * The accepted socket is non-blocking, so a peer that sends its ident
+ * slowly (or not at all) only costs us another pass thru the event
+ * library instead of stalling every other connection being accepted.
+ * Returns PRTE_SUCCESS once the header and any ident payload are in,
+ * PRTE_ERR_WOULD_BLOCK if we need to wait for more.
+ */
+static int stage_handshake(int sd, prte_oob_tcp_conn_op_t *op)
+{
+    size_t hsize = sizeof(prte_oob_tcp_hdr_t);
+    char *ptr;
+    size_t want;
+    ssize_t rc;
+
+    while (1) {
+        if (op->cnt < hsize) {
+            ptr = (char *) &op->hdr + op->cnt;
+            want = hsize - op->cnt;
+        } else {
+            if (NULL == op->msg) {
+                /* just completed the header */
+                MCA_OOB_TCP_HDR_NTOH(&op->hdr);
+                if (MCA_OOB_TCP_IDENT != op->hdr.type || 0 == op->hdr.nbytes) {
+                    return PRTE_SUCCESS;
+                }
+                if (NULL == (op->msg = (char *) malloc(op->hdr.nbytes))) {
+                    return PRTE_ERR_OUT_OF_RESOURCE;
+                }
+            }
+            if (op->cnt - hsize == op->hdr.nbytes) {
+                return PRTE_SUCCESS;
+            }
+            ptr = op->msg + (op->cnt - hsize);
+            want = op->hdr.nbytes - (op->cnt - hsize);
+        }
+        rc = recv(sd, ptr, want, 0);
+        if (0 == rc) {
+            /* peer closed the connection */
+            return PRTE_ERR_UNREACH;
+        }
+        if (rc < 0) {
+            if (EINTR == prte_socket_errno) {
+                continue;
+            }
+            if (EAGAIN == prte_socket_errno || EWOULDBLOCK == prte_socket_errno) {
+                return PRTE_ERR_WOULD_BLOCK;
+            }
+            return PRTE_ERR_UNREACH;
+        }
+        op->cnt += rc;
+    }
+}
+
 /*
  * Event callback when there is data available on the registered
  * socket to recv.  This is called for the listen sockets to accept an
@@ -218,9 +273,10 @@ static void send_nb(prte_rml_send_t *msg)
 static void recv_handler(int sd, short flg, void *cbdata)
 {
     prte_oob_tcp_conn_op_t *op = (prte_oob_tcp_conn_op_t *) cbdata;
-    int flags;
     prte_oob_tcp_hdr_t hdr;
     prte_oob_tcp_peer_t *peer;
+    char *msg;
+    int rc;
 
     PRTE_ACQUIRE_OBJECT(op);
 
@@ -228,7 +284,22 @@ static void recv_handler(int sd, short flg, void *cbdata)
                         "%s:tcp:recv:handler called", PRTE_NAME_PRINT(PRTE_PROC_MY_NAME));
 
     /* get the handshake */
-    if (PRTE_SUCCESS != prte_oob_tcp_peer_recv_connect_ack(NULL, sd, &hdr)) {
+    rc = stage_handshake(sd, op);
+    if (PRTE_ERR_WOULD_BLOCK == rc) {
+        /* wait for the rest of it */
+        prte_event_add(&op->ev, 0);
+        return;
+    }
+    if (PRTE_SUCCESS != rc) {
+        prte_output_verbose(OOB_TCP_DEBUG_CONNECT, prte_oob_base_framework.framework_output,
+                            "%s unable to complete recv of connect-ack ON SOCKET %d",
+                            PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), sd);
+        CLOSE_THE_SOCKET(sd);
+        goto cleanup;
+    }
+    msg = op->msg;
+    op->msg = NULL;
+    if (PRTE_SUCCESS != prte_oob_tcp_peer_process_connect_ack(NULL, sd, &op->hdr, msg, &hdr)) {
         goto cleanup;
     }
 
@@ -239,19 +310,6 @@ static void recv_handler(int sd, short flg, void *cbdata)
             prte_oob_tcp_peer_close(peer);
             goto cleanup;
         }
-        /* set socket up to be non-blocking */
-        if ((flags = fcntl(sd, F_GETFL, 0)) < 0) {
-            prte_output(0, "%s prte_oob_tcp_recv_connect: fcntl(F_GETFL) failed: %s (%d)",
-                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), strerror(prte_socket_errno),
-                        prte_socket_errno);
-        } else {
-            flags |= O_NONBLOCK;
-            if (fcntl(sd, F_SETFL, flags) < 0) {
-                prte_output(0, "%s prte_oob_tcp_recv_connect: fcntl(F_SETFL) failed: %s (%d)",
-                            PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), strerror(prte_socket_errno),
-                            prte_socket_errno);
-            }
-        }
         /* is the peer instance willing to accept this connection */
         peer->sd = sd;
         if (prte_oob_tcp_peer_accept(peer) == false) {
@@ -179,6 +179,10 @@ prte_oob_tcp_peer_t *prte_oob_tcp_peer_lookup(const pmix_proc_t *name)
 {
     prte_oob_tcp_peer_t *peer;
 
+    if (PRTE_OOB_BASE_PEER_INDEXABLE(name)) {
+        return (prte_oob_tcp_peer_t *)
+            prte_oob_base_peer_index_get(&prte_oob_tcp_component.peer_index, name);
+    }
     PRTE_LIST_FOREACH(peer, &prte_oob_tcp_component.peers, prte_oob_tcp_peer_t)
     {
         if (PMIX_CHECK_PROCID(name, &peer->name)) {
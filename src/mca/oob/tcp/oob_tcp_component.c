@@ -140,6 +140,7 @@ prte_oob_tcp_component_t prte_oob_tcp_component = {
 static int tcp_component_open(void)
 {
     PRTE_CONSTRUCT(&prte_oob_tcp_component.peers, prte_list_t);
+    PRTE_CONSTRUCT(&prte_oob_tcp_component.peer_index, prte_oob_base_peer_index_t);
     PRTE_CONSTRUCT(&prte_oob_tcp_component.listeners, prte_list_t);
     if (PRTE_PROC_IS_MASTER) {
         PRTE_CONSTRUCT(&prte_oob_tcp_component.listen_thread, prte_thread_t);
@@ -164,6 +165,7 @@ static int tcp_component_open(void)
 static int tcp_component_close(void)
 {
     PRTE_LIST_DESTRUCT(&prte_oob_tcp_component.local_ifs);
+    PRTE_DESTRUCT(&prte_oob_tcp_component.peer_index);
     PRTE_LIST_DESTRUCT(&prte_oob_tcp_component.peers);
 
     if (NULL != prte_oob_tcp_component.ipv4conns) {
@@ -397,6 +399,29 @@ static int tcp_component_register(void)
         PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_4,
         PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_oob_tcp_component.max_recon_attempts);
 
+    prte_oob_tcp_component.verify = false;
+    (void) prte_mca_base_component_var_register(
+        component, "verify",
+        "Protect each message payload with a CRC32C checksum that is verified by the receiver",
+        PRTE_MCA_BASE_VAR_TYPE_BOOL, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
+        PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_oob_tcp_component.verify);
+
+    prte_oob_tcp_component.listen_backlog = SOMAXCONN;
+    (void) prte_mca_base_component_var_register(
+        component, "listen_backlog",
+        "Backlog of pending connections requested for each listening socket (the kernel may "
+        "cap it further)",
+        PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_5,
+        PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_oob_tcp_component.listen_backlog);
+
+    prte_oob_tcp_component.accept_batch = 64;
+    (void) prte_mca_base_component_var_register(
+        component, "accept_batch",
+        "Maximum number of pending connections to accept each time a listening socket "
+        "becomes ready",
+        PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_5,
+        PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_oob_tcp_component.accept_batch);
+
     return PRTE_SUCCESS;
 }
 
@@ -775,6 +800,7 @@ static int component_set_addr(pmix_proc_t *peer, char **uris)
                                     "%s SET_PEER ADDING PEER %s",
                                     PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_NAME_PRINT(peer));
                 prte_list_append(&prte_oob_tcp_component.peers, &pr->super);
+                prte_oob_base_peer_index_set(&prte_oob_tcp_component.peer_index, peer, pr);
             }
 
             maddr = PRTE_NEW(prte_oob_tcp_addr_t);
@@ -785,6 +811,7 @@ static int component_set_addr(pmix_proc_t *peer, char **uris)
                 PRTE_ERROR_LOG(rc);
                 PRTE_RELEASE(maddr);
                 prte_list_remove_item(&prte_oob_tcp_component.peers, &pr->super);
+                prte_oob_base_peer_index_set(&prte_oob_tcp_component.peer_index, peer, NULL);
                 PRTE_RELEASE(pr);
                 return PRTE_ERR_TAKE_NEXT_OPTION;
             }
@@ -868,6 +895,7 @@ void prte_oob_tcp_component_lost_connection(int fd, short args, void *cbdata)
     if (NULL != bpr) {
         prte_bitmap_clear_bit(&bpr->addressable, prte_oob_tcp_component.super.idx);
         prte_list_remove_item(&prte_oob_base.peers, &bpr->super);
+        prte_oob_base_peer_index_set(&prte_oob_base.peer_index, &bpr->name, NULL);
         PRTE_RELEASE(bpr);
     }
 
@@ -1083,7 +1111,19 @@ PRTE_CLASS_INSTANCE(prte_oob_tcp_peer_op_t, prte_object_t, pop_cons, pop_des);
 
 PRTE_CLASS_INSTANCE(prte_oob_tcp_msg_op_t, prte_object_t, NULL, NULL);
 
-PRTE_CLASS_INSTANCE(prte_oob_tcp_conn_op_t, prte_object_t, NULL, NULL);
+static void cop_cons(prte_oob_tcp_conn_op_t *cop)
+{
+    cop->peer = NULL;
+    cop->msg = NULL;
+    cop->cnt = 0;
+}
+static void cop_des(prte_oob_tcp_conn_op_t *cop)
+{
+    if (NULL != cop->msg) {
+        free(cop->msg);
+    }
+}
+PRTE_CLASS_INSTANCE(prte_oob_tcp_conn_op_t, prte_object_t, cop_cons, cop_des);
 
 static void nicaddr_cons(prte_oob_tcp_nicaddr_t *ptr)
 {
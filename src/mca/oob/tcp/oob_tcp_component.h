@@ -40,6 +40,7 @@
 #include "src/event/event-internal.h"
 
 #include "oob_tcp.h"
+#include "src/mca/oob/base/base.h"
 #include "src/mca/oob/oob.h"
 
 /**
@@ -53,6 +54,7 @@ typedef struct {
     prte_list_t events;              /**< events for monitoring connections */
     int peer_limit;                  /**< max size of tcp peer cache */
     prte_list_t peers;               // connection addresses for peers
+    prte_oob_base_peer_index_t peer_index; // the peers, indexed by name
 
     /* Port specifications */
     int tcp_sndbuf;   /**< socket send buffer size */
@@ -82,12 +84,15 @@ typedef struct {
     bool listen_thread_active;
     struct timeval listen_thread_tv; /**< Timeout when using listen thread */
     int stop_thread[2];              /**< pipe used to exit the listen thread */
+    int listen_backlog;              /**< backlog requested for the listening sockets */
+    int accept_batch;                /**< max connections accepted per listener wakeup */
     int keepalive_probes;   /**< number of keepalives that can be missed before declaring error */
     int keepalive_time;     /**< idle time in seconds before starting to send keepalives */
     int keepalive_intvl;    /**< time between keepalives, in seconds */
     int retry_delay;        /**< time to wait before retrying connection */
     int max_recon_attempts; /**< maximum number of times to attempt connect before giving up (-1 for
                                never) */
+    bool verify;            /**< protect message payloads with a CRC32C */
 } prte_oob_tcp_component_t;
 
 PRTE_MODULE_EXPORT extern prte_oob_tcp_component_t prte_oob_tcp_component;
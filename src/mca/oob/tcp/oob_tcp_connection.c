@@ -795,13 +795,8 @@ static bool retry(prte_oob_tcp_peer_t *peer, int sd, bool fatal)
 
 int prte_oob_tcp_peer_recv_connect_ack(prte_oob_tcp_peer_t *pr, int sd, prte_oob_tcp_hdr_t *dhdr)
 {
-    char *msg;
-    char *version;
-    size_t offset = 0;
     prte_oob_tcp_hdr_t hdr;
     prte_oob_tcp_peer_t *peer;
-    uint16_t ack_flag;
-    bool is_new = (NULL == pr);
 
     prte_output_verbose(OOB_TCP_DEBUG_CONNECT, prte_oob_base_framework.framework_output,
                         "%s RECV CONNECT ACK FROM %s ON SOCKET %d",
@@ -839,6 +834,27 @@ int prte_oob_tcp_peer_recv_connect_ack(prte_oob_tcp_peer_t *pr, int sd, prte_oob
 
     /* convert the header */
     MCA_OOB_TCP_HDR_NTOH(&hdr);
+
+    return prte_oob_tcp_peer_process_connect_ack(pr, sd, &hdr, NULL, dhdr);
+}
+
+/*
+ * Process a connect-ack whose header has already been received and
+ * converted to host order. The payload is read from the socket unless
+ * the caller has already staged it in msg, in which case we take
+ * ownership of it.
+ */
+int prte_oob_tcp_peer_process_connect_ack(prte_oob_tcp_peer_t *pr, int sd,
+                                          prte_oob_tcp_hdr_t *rhdr, char *msg,
+                                          prte_oob_tcp_hdr_t *dhdr)
+{
+    char *version;
+    size_t offset = 0;
+    prte_oob_tcp_hdr_t hdr = *rhdr;
+    prte_oob_tcp_peer_t *peer = pr;
+    uint16_t ack_flag;
+    bool is_new = (NULL == pr);
+
     /* if the requestor wanted the header returned, then do so now */
     if (NULL != dhdr) {
         *dhdr = hdr;
@@ -852,11 +868,13 @@ int prte_oob_tcp_peer_recv_connect_ack(prte_oob_tcp_peer_t *pr, int sd, prte_oob
         MCA_OOB_TCP_HDR_HTON(&hdr);
         tcp_peer_send_blocking(sd, &hdr, sizeof(prte_oob_tcp_hdr_t));
         CLOSE_THE_SOCKET(sd);
+        free(msg);
         return PRTE_SUCCESS;
     }
 
     if (hdr.type != MCA_OOB_TCP_IDENT) {
         prte_output(0, "tcp_peer_recv_connect_ack: invalid header type: %d\n", hdr.type);
+        free(msg);
         if (NULL != peer) {
             peer->state = MCA_OOB_TCP_FAILED;
             prte_oob_tcp_peer_close(peer);
@@ -877,6 +895,7 @@ int prte_oob_tcp_peer_recv_connect_ack(prte_oob_tcp_peer_t *pr, int sd, prte_oob
             PMIX_XFER_PROCID(&peer->name, &hdr.origin);
             peer->state = MCA_OOB_TCP_ACCEPTING;
             prte_list_append(&prte_oob_tcp_component.peers, &peer->super);
+            prte_oob_base_peer_index_set(&prte_oob_tcp_component.peer_index, &peer->name, peer);
         }
     } else {
         /* compare the peers name to the expected value */
@@ -888,6 +907,7 @@ int prte_oob_tcp_peer_recv_connect_ack(prte_oob_tcp_peer_t *pr, int sd, prte_oob
                         PRTE_NAME_PRINT(&(peer->name)));
             peer->state = MCA_OOB_TCP_FAILED;
             prte_oob_tcp_peer_close(peer);
+            free(msg);
             return PRTE_ERR_CONNECTION_REFUSED;
         }
     }
@@ -896,13 +916,15 @@ int prte_oob_tcp_peer_recv_connect_ack(prte_oob_tcp_peer_t *pr, int sd, prte_oob
                         "%s connect-ack header from %s is okay", PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                         PRTE_NAME_PRINT(&peer->name));
 
-    /* get the authentication and version payload */
-    if (NULL == (msg = (char *) malloc(hdr.nbytes))) {
+    /* get the authentication and version payload, if the caller
+     * didn't already collect it */
+    if (NULL != msg) {
+        /* already have it */
+    } else if (NULL == (msg = (char *) malloc(hdr.nbytes))) {
         peer->state = MCA_OOB_TCP_FAILED;
         prte_oob_tcp_peer_close(peer);
         return PRTE_ERR_OUT_OF_RESOURCE;
-    }
-    if (!tcp_peer_recv_blocking(peer, sd, msg, hdr.nbytes)) {
+    } else if (!tcp_peer_recv_blocking(peer, sd, msg, hdr.nbytes)) {
         /* unable to complete the recv but should never happen */
         prte_output_verbose(OOB_TCP_DEBUG_CONNECT, prte_oob_base_framework.framework_output,
                             "%s unable to complete recv of connect-ack from %s ON SOCKET %d",
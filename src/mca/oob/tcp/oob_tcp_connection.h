@@ -44,6 +44,10 @@ typedef struct {
     prte_object_t super;
     prte_oob_tcp_peer_t *peer;
     prte_event_t ev;
+    /* handshake staged from an accepted socket */
+    prte_oob_tcp_hdr_t hdr;
+    char *msg;
+    size_t cnt;
 } prte_oob_tcp_conn_op_t;
 PRTE_CLASS_DECLARATION(prte_oob_tcp_conn_op_t);
 
@@ -93,6 +97,9 @@ PRTE_MODULE_EXPORT bool prte_oob_tcp_peer_accept(prte_oob_tcp_peer_t *peer);
 PRTE_MODULE_EXPORT void prte_oob_tcp_peer_complete_connect(prte_oob_tcp_peer_t *peer);
 PRTE_MODULE_EXPORT int prte_oob_tcp_peer_recv_connect_ack(prte_oob_tcp_peer_t *peer, int sd,
                                                           prte_oob_tcp_hdr_t *dhdr);
+PRTE_MODULE_EXPORT int prte_oob_tcp_peer_process_connect_ack(prte_oob_tcp_peer_t *peer, int sd,
+                                                             prte_oob_tcp_hdr_t *hdr, char *msg,
+                                                             prte_oob_tcp_hdr_t *dhdr);
 PRTE_MODULE_EXPORT void prte_oob_tcp_peer_close(prte_oob_tcp_peer_t *peer);
 
 #endif /* _MCA_OOB_TCP_CONNECTION_H_ */
@@ -42,6 +42,9 @@ typedef uint8_t prte_oob_tcp_msg_type_t;
 #define MCA_OOB_TCP_PING  3
 #define MCA_OOB_TCP_USER  4
 
+/* header flags */
+#define MCA_OOB_TCP_FLAG_CRC 0x01 /* hdr carries a CRC32C of the payload */
+
 #define PRTE_MAX_RTD_SIZE 31
 
 /* header for tcp msgs */
@@ -63,8 +66,12 @@ typedef struct {
     uint32_t seq_num;
     /* number of bytes in message */
     uint32_t nbytes;
+    /* CRC32C of the payload - only valid if MCA_OOB_TCP_FLAG_CRC is set */
+    uint32_t crc;
     /* type of message */
     prte_oob_tcp_msg_type_t type;
+    /* MCA_OOB_TCP_FLAG_* bits */
+    uint8_t flags;
     /* routed module to be used */
     char routed[PRTE_MAX_RTD_SIZE + 1];
 } prte_oob_tcp_hdr_t;
@@ -75,7 +82,8 @@ typedef struct {
     (h)->origin.rank = ntohl((h)->origin.rank); \
     (h)->dst.rank = ntohl((h)->dst.rank);       \
     (h)->tag = PRTE_RML_TAG_NTOH((h)->tag);     \
-    (h)->nbytes = ntohl((h)->nbytes);
+    (h)->nbytes = ntohl((h)->nbytes);           \
+    (h)->crc = ntohl((h)->crc);
 
 /**
  * Convert the message header to network byte order
@@ -84,6 +92,7 @@ typedef struct {
     (h)->origin.rank = htonl((h)->origin.rank); \
     (h)->dst.rank = htonl((h)->dst.rank);       \
     (h)->tag = PRTE_RML_TAG_HTON((h)->tag);     \
-    (h)->nbytes = htonl((h)->nbytes);
+    (h)->nbytes = htonl((h)->nbytes);           \
+    (h)->crc = htonl((h)->crc);
 
 #endif /* _MCA_OOB_TCP_HDR_H_ */
@@ -84,6 +84,34 @@ static int create_listen6(void);
 static void connection_handler(int sd, short flags, void *cbdata);
 static void connection_event_handler(int sd, short flags, void *cbdata);
 
+/*
+ * Accept a pending connection, returning the new socket already
+ * non-blocking and close-on-exec so that its handshake can be collected
+ * thru the event library instead of with blocking reads.
+ */
+static int accept_nonblocking(int sd, struct sockaddr *addr, prte_socklen_t *addrlen)
+{
+    int fd, flags;
+
+#ifdef HAVE_ACCEPT4
+    fd = accept4(sd, addr, addrlen, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (0 <= fd || ENOSYS != prte_socket_errno) {
+        return fd;
+    }
+#endif
+    fd = accept(sd, addr, addrlen);
+    if (fd < 0) {
+        return fd;
+    }
+    prte_fd_set_cloexec(fd);
+    if ((flags = fcntl(fd, F_GETFL, 0)) < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+        prte_output(0, "%s accept_nonblocking: fcntl failed: %s (%d)",
+                    PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), strerror(prte_socket_errno),
+                    prte_socket_errno);
+    }
+    return fd;
+}
+
 /*
  * Component initialization - create a module for each available
  * TCP interface and initialize the static resources associated
@@ -314,8 +342,8 @@ static int create_listen(void)
             return PRTE_ERROR;
         }
 
-        /* setup listen backlog to maximum allowed by kernel */
-        if (listen(sd, SOMAXCONN) < 0) {
+        /* setup listen backlog - the kernel caps it at its own maximum */
+        if (listen(sd, prte_oob_tcp_component.listen_backlog) < 0) {
             prte_output(0, "prte_oob_tcp_component_init: listen(): %s (%d)",
                         strerror(prte_socket_errno), prte_socket_errno);
             CLOSE_THE_SOCKET(sd);
@@ -522,8 +550,8 @@ static int create_listen6(void)
             return PRTE_ERROR;
         }
 
-        /* setup listen backlog to maximum allowed by kernel */
-        if (listen(sd, SOMAXCONN) < 0) {
+        /* setup listen backlog - the kernel caps it at its own maximum */
+        if (listen(sd, prte_oob_tcp_component.listen_backlog) < 0) {
             prte_output(0, "prte_oob_tcp_component_init: listen(): %s (%d)",
                         strerror(prte_socket_errno), prte_socket_errno);
             return PRTE_ERROR;
@@ -662,8 +690,11 @@ static void *listen_thread(prte_object_t *obj)
                 prte_event_set(prte_event_base, &pending_connection->ev, -1, PRTE_EV_WRITE,
                                connection_handler, pending_connection);
                 prte_event_set_priority(&pending_connection->ev, PRTE_MSG_PRI);
-                pending_connection->fd = accept(sd, (struct sockaddr *) &(pending_connection->addr),
-                                                &addrlen);
+                addrlen = sizeof(struct sockaddr_storage);
+                pending_connection->fd = accept_nonblocking(sd,
+                                                            (struct sockaddr *) &(
+                                                                pending_connection->addr),
+                                                            &addrlen);
 
                 /* check for < 0 as indicating an error upon accept */
                 if (pending_connection->fd < 0) {
@@ -788,23 +819,33 @@ static void connection_handler(int sd, short flags, void *cbdata)
 }
 
 /*
- * Handler for accepting connections from the event library
+ * Handler for accepting connections from the event library. When many
+ * peers call in at once, draining up to accept_batch pending connections
+ * per wakeup avoids a trip thru the event loop for each of them.
  */
 static void connection_event_handler(int incoming_sd, short flags, void *cbdata)
 {
-    struct sockaddr addr;
-    prte_socklen_t addrlen = sizeof(struct sockaddr);
-    int sd;
+    struct sockaddr_storage addr;
+    prte_socklen_t addrlen;
+    int sd, n, max;
 
-    sd = accept(incoming_sd, (struct sockaddr *) &addr, &addrlen);
-    prte_output_verbose(OOB_TCP_DEBUG_CONNECT, prte_oob_base_framework.framework_output,
-                        "%s connection_event_handler: working connection "
-                        "(%d, %d) %s:%d\n",
-                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), sd, prte_socket_errno,
-                        prte_net_get_hostname((struct sockaddr *) &addr),
-                        prte_net_get_port((struct sockaddr *) &addr));
-    if (sd < 0) {
-        /* Non-fatal errors */
+    max = (0 < prte_oob_tcp_component.accept_batch) ? prte_oob_tcp_component.accept_batch : 1;
+    for (n = 0; n < max; n++) {
+        addrlen = sizeof(addr);
+        sd = accept_nonblocking(incoming_sd, (struct sockaddr *) &addr, &addrlen);
+        if (0 <= sd) {
+            prte_output_verbose(OOB_TCP_DEBUG_CONNECT, prte_oob_base_framework.framework_output,
+                                "%s connection_event_handler: working connection "
+                                "(%d) %s:%d\n",
+                                PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), sd,
+                                prte_net_get_hostname((struct sockaddr *) &addr),
+                                prte_net_get_port((struct sockaddr *) &addr));
+            /* process the connection */
+            prte_oob_tcp_module.accept_connection(sd, (struct sockaddr *) &addr);
+            continue;
+        }
+
+        /* Non-fatal errors - includes having drained the backlog */
         if (EINTR == prte_socket_errno || EAGAIN == prte_socket_errno
             || EWOULDBLOCK == prte_socket_errno) {
             return;
@@ -833,9 +874,6 @@ static void connection_event_handler(int incoming_sd, short flags, void *cbdata)
             return;
         }
     }
-
-    /* process the connection */
-    prte_oob_tcp_module.accept_connection(sd, &addr);
 }
 
 static void tcp_ev_cons(prte_oob_tcp_listener_t *event)
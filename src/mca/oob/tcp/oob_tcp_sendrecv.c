@@ -61,6 +61,7 @@
 #include "src/util/error.h"
 #include "src/util/net.h"
 #include "src/util/output.h"
+#include "src/util/show_help.h"
 #include "types.h"
 
 #include "src/mca/errmgr/errmgr.h"
@@ -71,6 +72,7 @@
 #include "src/runtime/prte_wait.h"
 #include "src/threads/threads.h"
 #include "src/util/name_fns.h"
+#include "src/util/proc_info.h"
 
 #include "oob_tcp.h"
 #include "src/mca/oob/tcp/oob_tcp_common.h"
@@ -507,6 +509,23 @@ void prte_oob_tcp_recv_handler(int sd, short flags, void *cbdata)
                     PRTE_NAME_PRINT(&peer->recv_msg->hdr.origin), (int) peer->recv_msg->hdr.nbytes,
                     PRTE_NAME_PRINT(&peer->recv_msg->hdr.dst), peer->recv_msg->hdr.tag);
 
+                /* if the sender protected the payload, check it */
+                if ((MCA_OOB_TCP_FLAG_CRC & peer->recv_msg->hdr.flags)
+                    && peer->recv_msg->hdr.crc
+                           != prte_crc32c(peer->recv_msg->data, peer->recv_msg->hdr.nbytes)) {
+                    prte_show_help("help-oob-tcp.txt", "crc-mismatch", true,
+                                   prte_process_info.nodename, PRTE_NAME_PRINT(&peer->name),
+                                   PRTE_NAME_PRINT(&peer->recv_msg->hdr.origin),
+                                   (int) peer->recv_msg->hdr.tag,
+                                   (int) peer->recv_msg->hdr.nbytes);
+                    PRTE_RELEASE(peer->recv_msg);
+                    peer->recv_msg = NULL;
+                    /* turn off the recv event */
+                    prte_event_del(&peer->recv_event);
+                    PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_COMM_FAILED);
+                    return;
+                }
+
                 /* am I the intended recipient (header was already converted back to host order)? */
                 if (PMIX_CHECK_PROCID(&peer->recv_msg->hdr.dst, PRTE_PROC_MY_NAME)) {
                     /* yes - post it to the RML for delivery */
@@ -29,9 +29,11 @@
 #include "prte_config.h"
 
 #include "src/class/prte_list.h"
+#include "src/util/crc.h"
 #include "src/util/string_copy.h"
 
 #include "oob_tcp.h"
+#include "oob_tcp_component.h"
 #include "oob_tcp_hdr.h"
 #include "src/mca/rml/base/base.h"
 #include "src/threads/threads.h"
@@ -66,6 +68,22 @@ typedef struct {
 } prte_oob_tcp_recv_t;
 PRTE_CLASS_DECLARATION(prte_oob_tcp_recv_t);
 
+/* if requested, protect the payload of an outbound
+ * message with a CRC32C - must be called before
+ * the header is converted to network byte order
+ *
+ * h => pointer to prte_oob_tcp_hdr_t
+ * d => pointer to the payload
+ * n => number of bytes in the payload
+ */
+#define MCA_OOB_TCP_HDR_SET_CRC(h, d, n)                \
+    do {                                                \
+        if (prte_oob_tcp_component.verify) {            \
+            (h)->flags |= MCA_OOB_TCP_FLAG_CRC;         \
+            (h)->crc = prte_crc32c((d), (n));           \
+        }                                               \
+    } while (0)
+
 /* Queue a message to be sent to a specified peer. The macro
  * checks to see if a message is already in position to be
  * sent - if it is, then the message provided is simply added
@@ -112,6 +130,7 @@ PRTE_CLASS_DECLARATION(prte_oob_tcp_recv_t);
         _s->msg = (m);                                                                         \
         /* set the total number of bytes to be sent */                                         \
         _s->hdr.nbytes = (m)->dbuf.bytes_used;                                                 \
+        MCA_OOB_TCP_HDR_SET_CRC(&_s->hdr, (m)->dbuf.base_ptr, (m)->dbuf.bytes_used);           \
         /* prep header for xmission */                                                         \
         MCA_OOB_TCP_HDR_HTON(&_s->hdr);                                                        \
         /* start the send with the header */                                                   \
@@ -144,6 +163,7 @@ PRTE_CLASS_DECLARATION(prte_oob_tcp_recv_t);
         _s->msg = (m);                                                                            \
         /* set the total number of bytes to be sent */                                            \
         _s->hdr.nbytes = (m)->dbuf.bytes_used;                                                    \
+        MCA_OOB_TCP_HDR_SET_CRC(&_s->hdr, (m)->dbuf.base_ptr, (m)->dbuf.bytes_used);              \
         /* prep header for xmission */                                                            \
         MCA_OOB_TCP_HDR_HTON(&_s->hdr);                                                           \
         /* start the send with the header */                                                      \
@@ -176,6 +196,9 @@ PRTE_CLASS_DECLARATION(prte_oob_tcp_recv_t);
         _s->data = (m)->data;                                                                   \
         /* set the total number of bytes to be sent */                                          \
         _s->hdr.nbytes = (m)->hdr.nbytes;                                                       \
+        /* the payload is unchanged, so just carry its checksum along */                        \
+        _s->hdr.flags = (m)->hdr.flags;                                                         \
+        _s->hdr.crc = (m)->hdr.crc;                                                             \
         /* prep header for xmission */                                                          \
         MCA_OOB_TCP_HDR_HTON(&_s->hdr);                                                         \
         /* start the send with the header */                                                    \
@@ -63,6 +63,30 @@ static int mca_plm_base_register(prte_mca_base_register_flag_t flags)
         PRTE_MCA_BASE_VAR_TYPE_SIZE_T, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_INTERNAL, PRTE_INFO_LVL_9,
         PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_plm_globals.node_regex_threshold);
 
+    prte_plm_globals.launch_planner = false;
+    (void) prte_mca_base_framework_var_register(
+        &prte_plm_base_framework, "launch_planner",
+        "When tree-spawning daemons, launch them along a tree planned for the shortest time "
+        "until all daemons are up instead of along the routing tree",
+        PRTE_MCA_BASE_VAR_TYPE_BOOL, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_5,
+        PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_plm_globals.launch_planner);
+
+    prte_plm_globals.launch_latency = 1000;
+    (void) prte_mca_base_framework_var_register(
+        &prte_plm_base_framework, "launch_latency",
+        "Msec from starting the launch of a daemon until it can launch others, as used by the "
+        "launch planner (the measured value is reported at plm verbosity 1)",
+        PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_5,
+        PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_plm_globals.launch_latency);
+
+    prte_plm_globals.launch_cost = 20;
+    (void) prte_mca_base_framework_var_register(
+        &prte_plm_base_framework, "launch_cost",
+        "Msec a daemon spends starting each launch before it can start the next, as used by "
+        "the launch planner",
+        PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_5,
+        PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_plm_globals.launch_cost);
+
     /* Note that we break abstraction rules here by listing a
      specific PLM here in the base.  This is necessary, however,
      due to extraordinary circumstances:
@@ -123,6 +147,15 @@ static int prte_plm_base_open(prte_mca_base_open_flag_t flags)
     /* default to assigning daemons to nodes at launch */
     prte_plm_globals.daemon_nodes_assigned_at_launch = true;
 
+    /* the launch planner can't use negative times */
+    if (0 > prte_plm_globals.launch_latency) {
+        prte_plm_globals.launch_latency = 0;
+    }
+    if (0 > prte_plm_globals.launch_cost) {
+        prte_plm_globals.launch_cost = 0;
+    }
+    prte_plm_globals.launch_ndaemons = 0;
+
     /* Open up all available components */
     return prte_mca_base_framework_components_open(&prte_plm_base_framework, flags);
 }
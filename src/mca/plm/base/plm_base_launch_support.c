@@ -43,6 +43,7 @@
 #include "src/pmix/pmix-internal.h"
 #include "src/prted/pmix/pmix_server.h"
 
+#include "src/mca/base/base.h"
 #include "src/mca/errmgr/errmgr.h"
 #include "src/mca/ess/ess.h"
 #include "src/mca/filem/base/base.h"
@@ -77,6 +78,7 @@
 #include "src/util/prte_environ.h"
 #include "src/util/session_dir.h"
 #include "src/util/show_help.h"
+#include "src/util/trace.h"
 
 #include "src/mca/plm/base/base.h"
 #include "src/mca/plm/base/plm_private.h"
@@ -825,6 +827,33 @@ static void stack_trace_timeout(int sd, short args, void *cbdata)
     PRTE_RELEASE(jdata);
 }
 
+/* have every daemon write out its trace events */
+static void dump_traces(void)
+{
+    prte_daemon_cmd_flag_t command = PRTE_DAEMON_DUMP_TRACE_CMD;
+    pmix_data_buffer_t buffer;
+    prte_grpcomm_signature_t *sig;
+    int rc;
+
+    PMIX_DATA_BUFFER_CONSTRUCT(&buffer);
+    rc = PMIx_Data_pack(NULL, &buffer, &command, 1, PMIX_UINT8);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        PMIX_DATA_BUFFER_DESTRUCT(&buffer);
+        return;
+    }
+    /* goes to all daemons, including us */
+    sig = PRTE_NEW(prte_grpcomm_signature_t);
+    sig->signature = (pmix_proc_t *) malloc(sizeof(pmix_proc_t));
+    PMIX_LOAD_PROCID(&sig->signature[0], PRTE_PROC_MY_NAME->nspace, PMIX_RANK_WILDCARD);
+    sig->sz = 1;
+    if (PRTE_SUCCESS != (rc = prte_grpcomm.xcast(sig, PRTE_RML_TAG_DAEMON, &buffer))) {
+        PRTE_ERROR_LOG(rc);
+    }
+    PMIX_DATA_BUFFER_DESTRUCT(&buffer);
+    PRTE_RELEASE(sig);
+}
+
 /* catch job execution timeout */
 static void timeout_cb(int fd, short event, void *cbdata)
 {
@@ -869,6 +898,11 @@ static void timeout_cb(int fd, short event, void *cbdata)
         fprintf(stderr, "\n");
     }
 
+    /* if we are tracing, capture what led up to the timeout */
+    if (prte_trace_enabled) {
+        dump_traces();
+    }
+
     /* see if they want stacktraces */
     if (prte_get_attribute(&jdata->attributes, PRTE_JOB_STACKTRACES, NULL, PMIX_BOOL)) {
         /* if they asked for stack_traces, attempt to get them, but timeout
@@ -973,6 +1007,10 @@ void prte_plm_base_post_launch(int fd, short args, void *cbdata)
     /* update job state */
     caddy->jdata->state = caddy->job_state;
 
+    /* our own procs are up as well, so go get whatever
+     * data they told us they will need */
+    pmix_server_prefetch(jdata);
+
     /* complete wiring up the iof */
     PRTE_OUTPUT_VERBOSE((5, prte_plm_base_framework.framework_output,
                          "%s plm:base:launch wiring up iof for job %s",
@@ -1147,6 +1185,8 @@ void prte_plm_base_daemon_topology(int status, pmix_proc_t *sender, pmix_data_bu
     topo = ptopo.topology;
     ptopo.topology = NULL;
     PMIX_TOPOLOGY_DESTRUCT(&ptopo);
+    /* save it for the next time we see this signature */
+    prte_hwloc_base_cache_topology(sig, topo);
     /* Apply any CPU filters (not preserved by the XML) */
     prte_hwloc_base_filter_cpus(topo);
     /* record the final topology */
@@ -1228,6 +1268,7 @@ CLEANUP:
                              jdatorted->num_procs));
         if (jdatorted->num_procs == jdatorted->num_reported) {
             bool dvm = true;
+            prte_plm_base_launch_tree_report();
             jdatorted->state = PRTE_JOB_STATE_DAEMONS_REPORTED;
             /* activate the daemons_reported state for all jobs
              * whose daemons were launched
@@ -1646,8 +1687,22 @@ void prte_plm_base_daemon_callback(int status, pmix_proc_t *sender, pmix_data_bu
             t->index = prte_pointer_array_add(prte_node_topologies, t);
             daemon->node->topology = t;
             if (NULL != topo) {
+                /* save it for the next time we see this signature */
+                prte_hwloc_base_cache_topology(sig, topo);
+                /* Apply any CPU filters (not preserved by the XML) */
+                prte_hwloc_base_filter_cpus(topo);
+                t->topo = topo;
+            } else if (NULL != (topo = prte_hwloc_base_get_cached_topology(sig))) {
+                /* we have seen this signature before - no need to ask for it */
+                PRTE_OUTPUT_VERBOSE((5, prte_plm_base_framework.framework_output,
+                                     "%s USING CACHED TOPOLOGY FOR %s",
+                                     PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_NAME_PRINT(&dname)));
                 /* Apply any CPU filters (not preserved by the XML) */
                 prte_hwloc_base_filter_cpus(topo);
+                root = hwloc_get_root_obj(topo);
+                root->userdata = (void *) PRTE_NEW(prte_hwloc_topo_data_t);
+                sum = (prte_hwloc_topo_data_t *) root->userdata;
+                sum->available = prte_hwloc_base_setup_summary(topo);
                 t->topo = topo;
             } else {
                 PRTE_OUTPUT_VERBOSE((5, prte_plm_base_framework.framework_output,
@@ -1701,6 +1756,7 @@ void prte_plm_base_daemon_callback(int status, pmix_proc_t *sender, pmix_data_bu
                  jdatorted->num_reported, jdatorted->num_procs));
             if (jdatorted->num_procs == jdatorted->num_reported) {
                 bool dvm = true;
+                prte_plm_base_launch_tree_report();
                 jdatorted->state = PRTE_JOB_STATE_DAEMONS_REPORTED;
                 /* activate the daemons_reported state for all jobs
                  * whose daemons were launched
@@ -1889,6 +1945,13 @@ int prte_plm_base_prted_append_basic_args(int *argc, char ***argv, char *ess, in
         prte_argv_append(argc, argv, prte_xterm);
     }
 
+    /* if we have a component cache, point the daemons at it */
+    if (NULL != prte_mca_base_component_cache) {
+        prte_argv_append(argc, argv, "--prtemca");
+        prte_argv_append(argc, argv, "mca_base_component_cache");
+        prte_argv_append(argc, argv, prte_mca_base_component_cache);
+    }
+
     /* pass along any cmd line MCA params provided to mpirun,
      * being sure to "purge" any that would cause problems
      * on backend nodes and ignoring all duplicates
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2021      Nanook Consulting.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+/** @file
+ *
+ * Launch tree planner for tree-spawning launchers.
+ *
+ * The routing tree has a fixed radix chosen for message relay, which
+ * is rarely the best fan-out for launching daemons - a remote launch
+ * costs the launching daemon a little time (fork/exec of the agent)
+ * and then takes much longer before the new daemon is up and able to
+ * launch others. The planner models exactly that: each launch costs
+ * its parent plm_base_launch_cost msec, and the child can start its
+ * own launches plm_base_launch_latency msec later. Every new daemon is
+ * assigned to whichever already-running daemon can start a launch
+ * soonest, which minimizes the time until the last daemon is up under
+ * this model. A parent is never given more than max_children children
+ * since, when tree-spawning, each launch holds an agent session open.
+ *
+ * The plan only depends on the number of daemons and the parameters,
+ * so every daemon computes the same tree and can find its own children
+ * without any extra communication.
+ */
+
+#include "prte_config.h"
+#include "constants.h"
+
+#include <stdlib.h>
+#ifdef HAVE_SYS_TIME_H
+#    include <sys/time.h>
+#endif
+
+#include "src/mca/errmgr/errmgr.h"
+#include "src/runtime/prte_globals.h"
+#include "src/util/name_fns.h"
+#include "src/util/output.h"
+
+#include "src/mca/plm/base/base.h"
+#include "src/mca/plm/base/plm_private.h"
+
+typedef struct {
+    uint64_t ready; /* usec at which the daemon can start its next launch */
+    pmix_rank_t rank;
+} launcher_t;
+
+static bool launcher_before(launcher_t *a, launcher_t *b)
+{
+    /* ties go to the lowest rank so that all daemons agree on the plan */
+    return a->ready < b->ready || (a->ready == b->ready && a->rank < b->rank);
+}
+
+static void heap_push(launcher_t *heap, int *n, uint64_t ready, pmix_rank_t rank)
+{
+    launcher_t tmp;
+    int i = (*n)++, p;
+
+    heap[i].ready = ready;
+    heap[i].rank = rank;
+    while (0 < i) {
+        p = (i - 1) / 2;
+        if (!launcher_before(&heap[i], &heap[p])) {
+            break;
+        }
+        tmp = heap[p];
+        heap[p] = heap[i];
+        heap[i] = tmp;
+        i = p;
+    }
+}
+
+static launcher_t heap_pop(launcher_t *heap, int *n)
+{
+    launcher_t top = heap[0], tmp;
+    int i = 0, c;
+
+    heap[0] = heap[--(*n)];
+    while (1) {
+        c = 2 * i + 1;
+        if (c >= *n) {
+            break;
+        }
+        if (c + 1 < *n && launcher_before(&heap[c + 1], &heap[c])) {
+            ++c;
+        }
+        if (!launcher_before(&heap[c], &heap[i])) {
+            break;
+        }
+        tmp = heap[c];
+        heap[c] = heap[i];
+        heap[i] = tmp;
+        i = c;
+    }
+    return top;
+}
+
+/* compute the parent of every daemon and return the predicted
+ * time in usec until the last one is up */
+static int plan(pmix_rank_t ndaemons, int max_children, uint64_t latency, uint64_t cost,
+                pmix_rank_t *parents, uint64_t *makespan)
+{
+    launcher_t *heap, l;
+    int *nchildren, n = 0;
+    pmix_rank_t v;
+    uint64_t up;
+
+    *makespan = 0;
+    heap = (launcher_t *) malloc(ndaemons * sizeof(launcher_t));
+    nchildren = (int *) calloc(ndaemons, sizeof(int));
+    if (NULL == heap || NULL == nchildren) {
+        free(heap);
+        free(nchildren);
+        return PRTE_ERR_OUT_OF_RESOURCE;
+    }
+
+    heap_push(heap, &n, 0, 0);
+    for (v = 1; v < ndaemons; v++) {
+        l = heap_pop(heap, &n);
+        if (NULL != parents) {
+            parents[v] = l.rank;
+        }
+        up = l.ready + cost + latency;
+        if (up > *makespan) {
+            *makespan = up;
+        }
+        if (++nchildren[l.rank] < max_children) {
+            heap_push(heap, &n, l.ready + cost, l.rank);
+        }
+        heap_push(heap, &n, up, v);
+    }
+
+    free(heap);
+    free(nchildren);
+    return PRTE_SUCCESS;
+}
+
+int prte_plm_base_launch_tree_children(pmix_rank_t ndaemons, int max_children, prte_list_t *coll)
+{
+    pmix_rank_t *parents, v;
+    prte_namelist_t *nm;
+    uint64_t makespan;
+    int rc;
+
+    if (1 > max_children) {
+        max_children = 1;
+    }
+    if (1 >= ndaemons) {
+        return PRTE_SUCCESS;
+    }
+    parents = (pmix_rank_t *) malloc(ndaemons * sizeof(pmix_rank_t));
+    if (NULL == parents) {
+        PRTE_ERROR_LOG(PRTE_ERR_OUT_OF_RESOURCE);
+        return PRTE_ERR_OUT_OF_RESOURCE;
+    }
+    rc = plan(ndaemons, max_children, 1000 * (uint64_t) prte_plm_globals.launch_latency,
+              1000 * (uint64_t) prte_plm_globals.launch_cost, parents, &makespan);
+    if (PRTE_SUCCESS != rc) {
+        PRTE_ERROR_LOG(rc);
+        free(parents);
+        return rc;
+    }
+
+    for (v = 1; v < ndaemons; v++) {
+        if (parents[v] == PRTE_PROC_MY_NAME->rank) {
+            nm = PRTE_NEW(prte_namelist_t);
+            PMIX_LOAD_PROCID(&nm->name, PRTE_PROC_MY_NAME->nspace, v);
+            prte_list_append(coll, &nm->super);
+        }
+    }
+    free(parents);
+
+    PRTE_OUTPUT_VERBOSE((1, prte_plm_base_framework.framework_output,
+                         "%s plm:base:launch_tree %d children of %u daemons - predicted "
+                         "%lu msec until all are up",
+                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), (int) prte_list_get_size(coll),
+                         ndaemons, (unsigned long) (makespan / 1000)));
+
+    if (PRTE_PROC_IS_MASTER) {
+        /* remember what we predicted so we can compare once they report */
+        prte_plm_globals.launch_ndaemons = ndaemons;
+        prte_plm_globals.launch_max_children = max_children;
+        prte_plm_globals.launch_predicted = makespan;
+        gettimeofday(&prte_plm_globals.daemonlaunchstart, NULL);
+    }
+    return PRTE_SUCCESS;
+}
+
+void prte_plm_base_launch_tree_report(void)
+{
+    struct timeval now;
+    uint64_t measured, predicted, lo, hi, mid;
+
+    if (0 == prte_plm_globals.launch_ndaemons) {
+        return;
+    }
+    gettimeofday(&now, NULL);
+    measured = (uint64_t)(now.tv_sec - prte_plm_globals.daemonlaunchstart.tv_sec) * 1000000
+               + now.tv_usec - prte_plm_globals.daemonlaunchstart.tv_usec;
+
+    /* find the per-hop latency that would have predicted what we
+     * measured, so the user can feed it back in next time */
+    lo = 0;
+    hi = measured;
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if (PRTE_SUCCESS
+            != plan(prte_plm_globals.launch_ndaemons, prte_plm_globals.launch_max_children, mid,
+                    1000 * (uint64_t) prte_plm_globals.launch_cost, NULL, &predicted)) {
+            break;
+        }
+        if (predicted < measured) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    prte_output_verbose(1, prte_plm_base_framework.framework_output,
+                        "%s plm:base:launch_tree %u daemons reported after %lu msec "
+                        "(predicted %lu msec) - measured per-hop latency %lu msec",
+                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), prte_plm_globals.launch_ndaemons,
+                        (unsigned long) (measured / 1000),
+                        (unsigned long) (prte_plm_globals.launch_predicted / 1000),
+                        (unsigned long) (lo / 1000));
+    prte_plm_globals.launch_ndaemons = 0;
+}
@@ -50,6 +50,7 @@
 #include "src/mca/rml/rml.h"
 #include "src/mca/rml/rml_types.h"
 #include "src/mca/routed/routed.h"
+#include "src/mca/state/base/state_private.h"
 #include "src/mca/state/state.h"
 #include "src/pmix/pmix-internal.h"
 #include "src/runtime/prte_globals.h"
@@ -110,6 +111,158 @@ int prte_plm_base_comm_stop(void)
     return PRTE_SUCCESS;
 }
 
+/* procs reported in the same state are activated as a single batch */
+typedef struct {
+    pmix_proc_t *procs;
+    size_t nprocs;
+    size_t size;
+    prte_proc_state_t state;
+} plm_state_batch_t;
+
+static void flush_state_batch(plm_state_batch_t *batch)
+{
+    if (0 < batch->nprocs) {
+        PRTE_ACTIVATE_PROC_STATE_BATCH(batch->procs, batch->nprocs, batch->state);
+        batch->nprocs = 0;
+    }
+}
+
+static void add_to_state_batch(plm_state_batch_t *batch, pmix_proc_t *name,
+                               prte_proc_state_t state)
+{
+    pmix_proc_t *tmp;
+
+    if (0 < batch->nprocs && state != batch->state) {
+        flush_state_batch(batch);
+    }
+    if (batch->nprocs == batch->size) {
+        tmp = (pmix_proc_t *) realloc(batch->procs, (batch->size + 32) * sizeof(pmix_proc_t));
+        if (NULL == tmp) {
+            /* fall back to activating this proc on its own */
+            flush_state_batch(batch);
+            PRTE_ACTIVATE_PROC_STATE(name, state);
+            return;
+        }
+        batch->procs = tmp;
+        batch->size += 32;
+    }
+    PMIX_XFER_PROCID(&batch->procs[batch->nprocs], name);
+    batch->nprocs++;
+    batch->state = state;
+}
+
+/* unpack one job's record from a PRTE_PLM_PROC_STATE_BATCH_CMD
+ * message - see state_base_report.c for the layout */
+static int unpack_state_batch(pmix_data_buffer_t *buffer, plm_state_batch_t *batch)
+{
+    pmix_nspace_t job;
+    pmix_proc_t name;
+    prte_job_t *jdata;
+    prte_proc_t *proc;
+    int32_t n, i, count;
+    uint8_t flags;
+    pmix_rank_t *ranks = NULL;
+    pid_t *pids = NULL;
+    prte_proc_state_t *states = NULL;
+    prte_exit_code_t *codes = NULL;
+    int rc;
+
+    count = 1;
+    rc = PMIx_Data_unpack(NULL, buffer, &job, &count, PMIX_PROC_NSPACE);
+    if (PMIX_SUCCESS != rc) {
+        /* end of the message is reported to the caller */
+        return rc;
+    }
+    count = 1;
+    rc = PMIx_Data_unpack(NULL, buffer, &n, &count, PMIX_INT32);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return rc;
+    }
+    count = 1;
+    rc = PMIx_Data_unpack(NULL, buffer, &flags, &count, PMIX_UINT8);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return rc;
+    }
+    PRTE_OUTPUT_VERBOSE((5, prte_plm_base_framework.framework_output,
+                         "%s plm:base:receive got state batch of %d procs for job %s",
+                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), (int) n, PRTE_JOBID_PRINT(job)));
+    if (0 >= n) {
+        return PMIX_SUCCESS;
+    }
+
+    ranks = (pmix_rank_t *) malloc(n * sizeof(pmix_rank_t));
+    pids = (pid_t *) malloc(n * sizeof(pid_t));
+    states = (prte_proc_state_t *) malloc(n * sizeof(prte_proc_state_t));
+    codes = (prte_exit_code_t *) malloc(n * sizeof(prte_exit_code_t));
+    if (NULL == ranks || NULL == pids || NULL == states || NULL == codes) {
+        rc = PMIX_ERR_NOMEM;
+        goto cleanup;
+    }
+    count = n;
+    rc = PMIx_Data_unpack(NULL, buffer, ranks, &count, PMIX_PROC_RANK);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        goto cleanup;
+    }
+    count = n;
+    rc = PMIx_Data_unpack(NULL, buffer, pids, &count, PMIX_PID);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        goto cleanup;
+    }
+    count = (flags & PRTE_STATE_REPORT_UNIFORM_STATE) ? 1 : n;
+    rc = PMIx_Data_unpack(NULL, buffer, states, &count, PMIX_UINT32);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        goto cleanup;
+    }
+    count = (flags & PRTE_STATE_REPORT_UNIFORM_EXIT) ? 1 : n;
+    rc = PMIx_Data_unpack(NULL, buffer, codes, &count, PMIX_INT32);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        goto cleanup;
+    }
+
+    if (NULL == (jdata = prte_get_job_data_object(job))) {
+        /* job already gone - nothing to update */
+        goto cleanup;
+    }
+    PMIX_LOAD_NSPACE(name.nspace, job);
+    for (i = 0; i < n; i++) {
+        proc = (prte_proc_t *) prte_pointer_array_get_item(jdata->procs, ranks[i]);
+        if (NULL == proc) {
+            PRTE_ERROR_LOG(PRTE_ERR_NOT_FOUND);
+            PRTE_ACTIVATE_JOB_STATE(jdata, PRTE_JOB_STATE_FORCED_EXIT);
+            rc = PMIX_ERR_NOT_FOUND;
+            goto cleanup;
+        }
+        /* as with UPDATE_PROC_STATE, leave the proc state itself
+         * for the state machine to update */
+        proc->pid = pids[i];
+        proc->exit_code = codes[(flags & PRTE_STATE_REPORT_UNIFORM_EXIT) ? 0 : i];
+        name.rank = ranks[i];
+        add_to_state_batch(batch, &name, states[(flags & PRTE_STATE_REPORT_UNIFORM_STATE) ? 0 : i]);
+    }
+    flush_state_batch(batch);
+
+cleanup:
+    if (NULL != ranks) {
+        free(ranks);
+    }
+    if (NULL != pids) {
+        free(pids);
+    }
+    if (NULL != states) {
+        free(states);
+    }
+    if (NULL != codes) {
+        free(codes);
+    }
+    return rc;
+}
+
 /* process incoming messages in order of receipt */
 void prte_plm_base_recv(int status, pmix_proc_t *sender, pmix_data_buffer_t *buffer,
                         prte_rml_tag_t tag, void *cbdata)
@@ -132,6 +285,7 @@ void prte_plm_base_recv(int status, pmix_proc_t *sender, pmix_data_buffer_t *buf
     char **env;
     char *prefix_dir, *tmp;
     pmix_rank_t tgt, *tptr;
+    plm_state_batch_t batch = {NULL, 0, 0, 0};
 
     PRTE_OUTPUT_VERBOSE((5, prte_plm_base_framework.framework_output,
                          "%s plm:base:receive processing msg", PRTE_NAME_PRINT(PRTE_PROC_MY_NAME)));
@@ -414,11 +568,12 @@ void prte_plm_base_recv(int status, pmix_proc_t *sender, pmix_data_buffer_t *buf
                      * state against the prior proc state */
                     proc->pid = pid;
                     proc->exit_code = exit_code;
-                    PRTE_ACTIVATE_PROC_STATE(&name, state);
+                    add_to_state_batch(&batch, &name, state);
                 }
                 /* get entry from next rank */
                 rc = PMIx_Data_unpack(NULL, buffer, &vpid, &count, PMIX_PROC_RANK);
             }
+            flush_state_batch(&batch);
             /* prepare for next job */
             count = 1;
             rc = PMIx_Data_unpack(NULL, buffer, &job, &count, PMIX_PROC_NSPACE);
@@ -431,6 +586,20 @@ void prte_plm_base_recv(int status, pmix_proc_t *sender, pmix_data_buffer_t *buf
         }
         break;
 
+    case PRTE_PLM_PROC_STATE_BATCH_CMD:
+        PRTE_OUTPUT_VERBOSE((5, prte_plm_base_framework.framework_output,
+                             "%s plm:base:receive proc state batch from %s",
+                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_NAME_PRINT(sender)));
+        do {
+            rc = unpack_state_batch(buffer, &batch);
+        } while (PMIX_SUCCESS == rc);
+        if (PMIX_ERR_UNPACK_READ_PAST_END_OF_BUFFER != rc) {
+            rc = prte_pmix_convert_status(rc);
+            goto CLEANUP;
+        }
+        rc = PRTE_SUCCESS;
+        break;
+
     case PRTE_PLM_READY_FOR_DEBUG_CMD:
             PRTE_OUTPUT_VERBOSE((5, prte_plm_base_framework.framework_output,
                             "%s plm:base:receive ready for debug command from %s",
@@ -630,6 +799,12 @@ void prte_plm_base_recv(int status, pmix_proc_t *sender, pmix_data_buffer_t *buf
     }
 
 CLEANUP:
+    /* activate anything we collected before an error */
+    flush_state_batch(&batch);
+    if (NULL != batch.procs) {
+        free(batch.procs);
+    }
+
     /* see if an error occurred - if so, wakeup the HNP so we can exit */
     if (PRTE_PROC_IS_MASTER && PRTE_SUCCESS != rc) {
         jdata = NULL;
@@ -64,6 +64,13 @@ typedef struct {
     /* daemon nodes assigned at launch */
     bool daemon_nodes_assigned_at_launch;
     size_t node_regex_threshold;
+    /* launch tree planner */
+    bool launch_planner;
+    int launch_latency;
+    int launch_cost;
+    pmix_rank_t launch_ndaemons;
+    int launch_max_children;
+    uint64_t launch_predicted;
 } prte_plm_globals_t;
 /**
  * Global instance of PLM framework data
@@ -95,6 +102,17 @@ PRTE_EXPORT int prte_plm_base_setup_prted_cmd(int *argc, char ***argv);
 PRTE_EXPORT void prte_plm_base_check_all_complete(int fd, short args, void *cbdata);
 PRTE_EXPORT int prte_plm_base_setup_virtual_machine(prte_job_t *jdata);
 
+/**
+ * Add the daemons this daemon should launch in the planned launch
+ * tree of ndaemons to coll (as prte_namelist_t)
+ */
+PRTE_EXPORT int prte_plm_base_launch_tree_children(pmix_rank_t ndaemons, int max_children,
+                                                   prte_list_t *coll);
+/**
+ * Compare the time the planned launch took with the prediction
+ */
+PRTE_EXPORT void prte_plm_base_launch_tree_report(void);
+
 /**
  * Utilities for plm components that use proxy daemons
  */
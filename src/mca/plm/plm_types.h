@@ -228,6 +228,7 @@ typedef uint8_t prte_plm_cmd_flag_t;
 #define PRTE_PLM_ALLOC_JOBID_CMD        4
 #define PRTE_PLM_READY_FOR_DEBUG_CMD    5
 #define PRTE_PLM_LOCAL_LAUNCH_COMP_CMD  6
+#define PRTE_PLM_PROC_STATE_BATCH_CMD   7
 
 END_C_DECLS
 
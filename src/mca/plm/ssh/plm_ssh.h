@@ -70,6 +70,10 @@ struct prte_plm_ssh_component_t {
     char *ssh_args;
     char *pass_libpath;
     char *chdir;
+    char *shell_cache;
+    bool multiplex;
+    char *control_path;
+    int control_persist;
 };
 typedef struct prte_plm_ssh_component_t prte_plm_ssh_component_t;
 
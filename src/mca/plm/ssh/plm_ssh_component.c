@@ -219,6 +219,38 @@ static int ssh_component_register(void)
         c, "chdir", "Change working directory after ssh, but before exec of prted",
         PRTE_MCA_BASE_VAR_TYPE_STRING, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_2,
         PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_plm_ssh_component.chdir);
+
+    prte_plm_ssh_component.shell_cache = NULL;
+    (void) prte_mca_base_component_var_register(
+        c, "shell_cache",
+        "File in which to remember the remote shell found by probing each node, so that "
+        "relaunching the DVM or adding hosts to it does not probe the same nodes again "
+        "(only used when assume_same_shell is false)",
+        PRTE_MCA_BASE_VAR_TYPE_STRING, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_5,
+        PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_plm_ssh_component.shell_cache);
+
+    prte_plm_ssh_component.multiplex = false;
+    (void) prte_mca_base_component_var_register(
+        c, "multiplex",
+        "If set to true and the agent is ssh, share one persistent connection per node between "
+        "the shell probe, daemon launches and later relaunches (ssh ControlMaster)",
+        PRTE_MCA_BASE_VAR_TYPE_BOOL, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_5,
+        PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_plm_ssh_component.multiplex);
+
+    prte_plm_ssh_component.control_path = NULL;
+    (void) prte_mca_base_component_var_register(
+        c, "control_path",
+        "ssh ControlPath used for multiplexed connections [default: <tmpdir>/prte-ssh-%C]",
+        PRTE_MCA_BASE_VAR_TYPE_STRING, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_5,
+        PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_plm_ssh_component.control_path);
+
+    prte_plm_ssh_component.control_persist = 60;
+    (void) prte_mca_base_component_var_register(
+        c, "control_persist",
+        "Seconds a multiplexed ssh connection is kept open after its last session ends "
+        "(0 = close it with the last session)",
+        PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_5,
+        PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_plm_ssh_component.control_persist);
     return PRTE_SUCCESS;
 }
 
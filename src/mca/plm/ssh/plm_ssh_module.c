@@ -65,6 +65,7 @@
 #    include <pwd.h>
 #endif
 
+#include "src/class/prte_hash_table.h"
 #include "src/class/prte_pointer_array.h"
 #include "src/event/event-internal.h"
 #include "src/mca/base/base.h"
@@ -163,6 +164,9 @@ static prte_plm_ssh_shell_t find_shell(char *shell);
 static int launch_agent_setup(const char *agent, char *path);
 static void ssh_child(int argc, char **argv) __prte_attribute_noreturn__;
 static int ssh_probe(char *nodename, prte_plm_ssh_shell_t *shell);
+static int lookup_shell(char *nodename, prte_plm_ssh_shell_t *shell);
+static void load_shell_cache(void);
+static void add_multiplex_args(char ***argv);
 static int setup_shell(prte_plm_ssh_shell_t *sshell, prte_plm_ssh_shell_t *lshell, char *nodename,
                        int *argc, char ***argv);
 static void launch_daemons(int fd, short args, void *cbdata);
@@ -174,6 +178,9 @@ static prte_list_t launch_list;
 static prte_event_t launch_event;
 static char *ssh_agent_path = NULL;
 static char **ssh_agent_argv = NULL;
+/* remote shell of each node probed so far, keyed by nodename */
+static prte_hash_table_t shell_cache;
+static bool shell_cache_active = false;
 
 /**
  * Init the module
@@ -245,6 +252,13 @@ static int ssh_init(void)
     /* we assign daemon nodes at launch */
     prte_plm_globals.daemon_nodes_assigned_at_launch = true;
 
+    if (!prte_plm_ssh_component.assume_same_shell) {
+        PRTE_CONSTRUCT(&shell_cache, prte_hash_table_t);
+        prte_hash_table_init(&shell_cache, 128);
+        shell_cache_active = true;
+        load_shell_cache();
+    }
+
     return rc;
 }
 
@@ -332,6 +346,21 @@ static void ssh_wait_daemon(int sd, short flags, void *cbdata)
     PRTE_RELEASE(t2);
 }
 
+static void append_mca_param(int *argc, char ***argv, const char *name, const char *value)
+{
+    int i;
+
+    for (i = 0; NULL != (*argv)[i]; i++) {
+        if (0 == strcmp((*argv)[i], name)) {
+            /* already given */
+            return;
+        }
+    }
+    prte_argv_append(argc, argv, "--prtemca");
+    prte_argv_append(argc, argv, name);
+    prte_argv_append(argc, argv, value);
+}
+
 static int setup_launch(int *argcptr, char ***argvptr, char *nodename, int *node_name_index1,
                         int *proc_vpid_index, char *prefix_dir)
 {
@@ -628,6 +657,19 @@ static int setup_launch(int *argcptr, char ***argvptr, char *nodename, int *node
         prte_argv_append(&argc, &argv, "prte_parent_uri");
         prte_argv_append(&argc, &argv, param);
         free(param);
+        if (prte_plm_globals.launch_planner) {
+            /* every daemon has to plan the same launch tree */
+            append_mca_param(&argc, &argv, "plm_base_launch_planner", "1");
+            prte_asprintf(&param, "%d", prte_plm_globals.launch_latency);
+            append_mca_param(&argc, &argv, "plm_base_launch_latency", param);
+            free(param);
+            prte_asprintf(&param, "%d", prte_plm_globals.launch_cost);
+            append_mca_param(&argc, &argv, "plm_base_launch_cost", param);
+            free(param);
+            prte_asprintf(&param, "%d", prte_plm_ssh_component.num_concurrent);
+            append_mca_param(&argc, &argv, "plm_ssh_num_concurrent", param);
+            free(param);
+        }
     }
 
     /* unless told otherwise... */
@@ -778,9 +820,18 @@ static int remote_spawn(void)
         prefix = NULL;
     }
 
-    /* get the updated routing list */
+    /* get our children in the launch tree */
     PRTE_CONSTRUCT(&coll, prte_list_t);
-    prte_routed.get_routing_list(&coll);
+    if (prte_plm_globals.launch_planner) {
+        rc = prte_plm_base_launch_tree_children(prte_process_info.num_daemons,
+                                                prte_plm_ssh_component.num_concurrent, &coll);
+        if (PRTE_SUCCESS != rc) {
+            PRTE_LIST_DESTRUCT(&coll);
+            goto cleanup;
+        }
+    } else {
+        prte_routed.get_routing_list(&coll);
+    }
 
     /* if I have no children, just return */
     if (0 == prte_list_get_size(&coll)) {
@@ -1130,9 +1181,18 @@ static void launch_daemons(int fd, short args, void *cbdata)
 
     /* if we are tree launching, find our children and create the launch cmd */
     if (!prte_plm_ssh_component.no_tree_spawn) {
-        /* get the updated routing list */
         PRTE_CONSTRUCT(&coll, prte_list_t);
-        prte_routed.get_routing_list(&coll);
+        if (prte_plm_globals.launch_planner) {
+            rc = prte_plm_base_launch_tree_children(daemons->num_procs,
+                                                    prte_plm_ssh_component.num_concurrent, &coll);
+            if (PRTE_SUCCESS != rc) {
+                PRTE_LIST_DESTRUCT(&coll);
+                goto cleanup;
+            }
+        } else {
+            /* get the updated routing list */
+            prte_routed.get_routing_list(&coll);
+        }
     }
 
     /* setup the launch */
@@ -1316,6 +1376,10 @@ static int ssh_finalize(void)
     free(ssh_agent_path);
     prte_argv_free(prte_plm_ssh_component.agent_argv);
     prte_argv_free(ssh_agent_argv);
+    if (shell_cache_active) {
+        PRTE_DESTRUCT(&shell_cache);
+        shell_cache_active = false;
+    }
 
     return rc;
 }
@@ -1410,6 +1474,9 @@ static int launch_agent_setup(const char *agent, char *path)
                 prte_argv_append_nosize(&ssh_agent_argv, "-x");
             }
         }
+        if (prte_plm_ssh_component.multiplex) {
+            add_multiplex_args(&ssh_agent_argv);
+        }
     }
     if (NULL != bname) {
         free(bname);
@@ -1424,7 +1491,7 @@ static int launch_agent_setup(const char *agent, char *path)
  */
 static int ssh_probe(char *nodename, prte_plm_ssh_shell_t *shell)
 {
-    char **argv;
+    char **argv, *bname;
     int argc, rc = PRTE_SUCCESS, i;
     int fd[2];
     pid_t pid;
@@ -1456,6 +1523,16 @@ static int ssh_probe(char *nodename, prte_plm_ssh_shell_t *shell)
         /* Build argv array */
         argv = prte_argv_copy(prte_plm_ssh_component.agent_argv);
         argc = prte_argv_count(prte_plm_ssh_component.agent_argv);
+        /* the agent may be given by its path, e.g. /usr/bin/ssh */
+        bname = prte_basename(argv[0]);
+        if (prte_plm_ssh_component.multiplex && NULL != bname && 0 == strcmp(bname, "ssh")) {
+            /* share the connection the daemon launch will use */
+            add_multiplex_args(&argv);
+            argc = prte_argv_count(argv);
+        }
+        if (NULL != bname) {
+            free(bname);
+        }
         prte_argv_append(&argc, &argv, nodename);
         prte_argv_append(&argc, &argv, "echo $SHELL");
 
@@ -1519,6 +1596,107 @@ static int ssh_probe(char *nodename, prte_plm_ssh_shell_t *shell)
     return rc;
 }
 
+/**
+ * Get the remote shell of a node, only probing it if we haven't
+ * already done so during this run or a previous one
+ */
+static int lookup_shell(char *nodename, prte_plm_ssh_shell_t *shell)
+{
+    void *value;
+    FILE *fp;
+    int rc;
+
+    if (PRTE_SUCCESS
+        == prte_hash_table_get_value_ptr(&shell_cache, nodename, strlen(nodename), &value)) {
+        *shell = (prte_plm_ssh_shell_t)(uintptr_t) value;
+        PRTE_OUTPUT_VERBOSE((1, prte_plm_base_framework.framework_output,
+                             "%s plm:ssh: using cached SHELL %s for node %s",
+                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), prte_plm_ssh_shell_name[*shell],
+                             nodename));
+        return PRTE_SUCCESS;
+    }
+
+    if (PRTE_SUCCESS != (rc = ssh_probe(nodename, shell))) {
+        return rc;
+    }
+    if (PRTE_PLM_SSH_SHELL_UNKNOWN == *shell) {
+        /* don't remember failures - the next launch may do better */
+        return PRTE_SUCCESS;
+    }
+    prte_hash_table_set_value_ptr(&shell_cache, nodename, strlen(nodename),
+                                  (void *) (uintptr_t) *shell);
+    if (NULL != prte_plm_ssh_component.shell_cache
+        && NULL != (fp = fopen(prte_plm_ssh_component.shell_cache, "a"))) {
+        fprintf(fp, "%s %s\n", nodename, prte_plm_ssh_shell_name[*shell]);
+        fclose(fp);
+    }
+    return PRTE_SUCCESS;
+}
+
+/**
+ * Read the "nodename shell" lines saved by previous runs
+ */
+static void load_shell_cache(void)
+{
+    FILE *fp;
+    char line[1024], *node, *sh, *save;
+    int i, n = 0;
+
+    if (NULL == prte_plm_ssh_component.shell_cache
+        || NULL == (fp = fopen(prte_plm_ssh_component.shell_cache, "r"))) {
+        return;
+    }
+    while (NULL != fgets(line, sizeof(line), fp)) {
+        if (NULL == (node = strtok_r(line, " \t\n", &save))
+            || NULL == (sh = strtok_r(NULL, " \t\n", &save))) {
+            continue;
+        }
+        for (i = 0; i < PRTE_PLM_SSH_SHELL_UNKNOWN; i++) {
+            if (0 == strcmp(sh, prte_plm_ssh_shell_name[i])) {
+                /* later lines override earlier ones */
+                prte_hash_table_set_value_ptr(&shell_cache, node, strlen(node),
+                                              (void *) (uintptr_t) i);
+                ++n;
+                break;
+            }
+        }
+    }
+    fclose(fp);
+
+    PRTE_OUTPUT_VERBOSE((1, prte_plm_base_framework.framework_output,
+                         "%s plm:ssh: read %d cached shells from %s",
+                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), n,
+                         prte_plm_ssh_component.shell_cache));
+}
+
+/**
+ * Have ssh share one master connection per node, kept alive for a
+ * while after its last session so a relaunch can reuse it
+ */
+static void add_multiplex_args(char ***argv)
+{
+    char *param;
+
+    prte_argv_append_nosize(argv, "-o");
+    prte_argv_append_nosize(argv, "ControlMaster=auto");
+    prte_argv_append_nosize(argv, "-o");
+    if (NULL != prte_plm_ssh_component.control_path) {
+        prte_asprintf(&param, "ControlPath=%s", prte_plm_ssh_component.control_path);
+    } else {
+        prte_asprintf(&param, "ControlPath=%s/prte-ssh-%%C", prte_tmp_directory());
+    }
+    prte_argv_append_nosize(argv, param);
+    free(param);
+    prte_argv_append_nosize(argv, "-o");
+    if (0 < prte_plm_ssh_component.control_persist) {
+        prte_asprintf(&param, "ControlPersist=%d", prte_plm_ssh_component.control_persist);
+    } else {
+        param = strdup("ControlPersist=no");
+    }
+    prte_argv_append_nosize(argv, param);
+    free(param);
+}
+
 static int setup_shell(prte_plm_ssh_shell_t *sshell, prte_plm_ssh_shell_t *lshell, char *nodename,
                        int *argc, char ***argv)
 {
@@ -1565,7 +1743,7 @@ static int setup_shell(prte_plm_ssh_shell_t *sshell, prte_plm_ssh_shell_t *lshel
                              "%s plm:ssh: assuming same remote shell as local shell",
                              PRTE_NAME_PRINT(PRTE_PROC_MY_NAME)));
     } else {
-        rc = ssh_probe(nodename, &remote_shell);
+        rc = lookup_shell(nodename, &remote_shell);
 
         if (PRTE_SUCCESS != rc) {
             PRTE_ERROR_LOG(rc);
@@ -24,6 +24,7 @@
 #include <pmix.h>
 #include <pmix_server.h>
 
+#include "src/class/prte_bitmap.h"
 #include "src/util/output.h"
 
 #include "src/mca/ess/ess.h"
@@ -64,6 +65,22 @@
 prte_list_t prte_error_procs = {{0}};
 
 static int prte_propagate_error_cb_type = -1;
+static int prte_propagate_failset_cb_type = -1;
+
+/* Daemon failures are propagated as failure sets. A failure detected
+ * here is held back for prte_propagate_prperror_batch_delay msec so that
+ * the failures of a burst (e.g., a rack losing power) go out together
+ * in one rbcast carrying every daemon failure we know of. Receivers only
+ * forward a set that told them something new. */
+static prte_bitmap_t failed_daemons;
+static int nfailed_daemons = 0;
+static prte_event_t failset_event;
+static bool failset_pending = false;
+static prte_proc_state_t failset_state;
+static uint32_t failset_epoch = 0;
+static uint64_t failset_sent = 0;
+static uint64_t failset_recvd = 0;
+static uint64_t failset_dups = 0;
 
 static int init(void);
 static int finalize(void);
@@ -72,6 +89,8 @@ static int prte_propagate_prperror(const pmix_nspace_t job, const pmix_proc_t *s
                                    const pmix_proc_t *errorproc, prte_proc_state_t state);
 
 static int prte_propagate_prperror_recv(pmix_data_buffer_t *buffer);
+static int prte_propagate_prperror_failset_recv(pmix_data_buffer_t *buffer);
+static void failset_flush(int fd, short args, void *cbdata);
 
 /* flag use to register callback for grpcomm rbcast forward */
 int enable_callback_register_flag = 1;
@@ -100,6 +119,8 @@ static void flush_error_list(size_t evhdlr_registration_id, pmix_status_t status
 static int init(void)
 {
     PRTE_CONSTRUCT(&prte_error_procs, prte_list_t);
+    PRTE_CONSTRUCT(&failed_daemons, prte_bitmap_t);
+    prte_event_evtimer_set(prte_event_base, &failset_event, failset_flush, NULL);
     pmix_status_t pcode1 = PMIX_EVENT_JOB_END;
     PMIx_Register_event_handler(&pcode1, 1, NULL, 0, flush_error_list, NULL, NULL);
     return PRTE_SUCCESS;
@@ -112,10 +133,13 @@ static int register_prp_callback(void)
         if (prte_grpcomm.register_cb != NULL) {
             ret = prte_grpcomm.register_cb((prte_grpcomm_rbcast_cb_t) prte_propagate_prperror_recv);
             prte_propagate_error_cb_type = ret;
+            ret = prte_grpcomm.register_cb(
+                (prte_grpcomm_rbcast_cb_t) prte_propagate_prperror_failset_recv);
+            prte_propagate_failset_cb_type = ret;
             PRTE_OUTPUT_VERBOSE(
                 (5, prte_propagate_base_framework.framework_output,
-                 "propagate: prperror: daemon register grpcomm callback %d at start",
-                 prte_propagate_error_cb_type));
+                 "propagate: prperror: daemon register grpcomm callbacks %d and %d at start",
+                 prte_propagate_error_cb_type, prte_propagate_failset_cb_type));
             enable_callback_register_flag = 0;
         }
     }
@@ -125,6 +149,20 @@ static int register_prp_callback(void)
 static int finalize(void)
 {
     int ret = 0;
+
+    if (failset_pending) {
+        prte_event_evtimer_del(&failset_event);
+        failset_pending = false;
+    }
+    if (0 < failset_sent || 0 < failset_recvd) {
+        prte_output_verbose(1, prte_propagate_base_framework.framework_output,
+                            "%s propagate: prperror: %d daemon failures - sent %lu failure sets, "
+                            "received %lu (%lu with nothing new)",
+                            PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), nfailed_daemons,
+                            (unsigned long) failset_sent, (unsigned long) failset_recvd,
+                            (unsigned long) failset_dups);
+    }
+    PRTE_DESTRUCT(&failed_daemons);
     if (-1 == prte_propagate_error_cb_type) {
         return PRTE_SUCCESS;
     }
@@ -180,17 +218,7 @@ static int prte_propagate_prperror(const pmix_nspace_t job, const pmix_proc_t *s
     status = state;
 
     /* register callback for rbcast for forwarding */
-    int ret;
-    if (enable_callback_register_flag) {
-        if (prte_grpcomm.register_cb != NULL) {
-            ret = prte_grpcomm.register_cb((prte_grpcomm_rbcast_cb_t) prte_propagate_prperror_recv);
-            prte_propagate_error_cb_type = ret;
-            PRTE_OUTPUT_VERBOSE((5, prte_propagate_base_framework.framework_output,
-                                 "propagate: prperror: daemon register grpcomm callback %d",
-                                 prte_propagate_error_cb_type));
-            enable_callback_register_flag = 0;
-        }
-    }
+    register_prp_callback();
 
     /* change the error daemon state*/
     PRTE_OUTPUT_VERBOSE((5, prte_propagate_base_framework.framework_output,
@@ -366,13 +394,32 @@ static int prte_propagate_prperror(const pmix_nspace_t job, const pmix_proc_t *s
         }
     }
 
-    /* goes to all daemons */
-    sig = PRTE_NEW(prte_grpcomm_signature_t);
-    sig->signature = (pmix_proc_t *) malloc(sizeof(pmix_proc_t));
-    sig->sz = 1;
-    PMIX_LOAD_PROCID(&sig->signature[0], PRTE_PROC_MY_NAME->nspace, PMIX_RANK_WILDCARD);
-    if (PRTE_SUCCESS != (rc = prte_grpcomm_API_rbcast(sig, PRTE_RML_TAG_PROPAGATE, &prperror_buffer))) {
-        PRTE_ERROR_LOG(rc);
+    if (daemon_error_flag) {
+        /* the daemon failure goes out with the next failure set */
+        if (!prte_bitmap_is_set_bit(&failed_daemons, errorproc->rank)
+            && PRTE_SUCCESS == prte_bitmap_set_bit(&failed_daemons, errorproc->rank)) {
+            ++nfailed_daemons;
+            failset_state = state;
+            if (!failset_pending) {
+                struct timeval tv;
+
+                failset_pending = true;
+                tv.tv_sec = prte_propagate_prperror_batch_delay / 1000;
+                tv.tv_usec = (prte_propagate_prperror_batch_delay % 1000) * 1000;
+                prte_event_evtimer_add(&failset_event, &tv);
+            }
+        }
+    } else {
+        /* goes to all daemons */
+        sig = PRTE_NEW(prte_grpcomm_signature_t);
+        sig->signature = (pmix_proc_t *) malloc(sizeof(pmix_proc_t));
+        sig->sz = 1;
+        PMIX_LOAD_PROCID(&sig->signature[0], PRTE_PROC_MY_NAME->nspace, PMIX_RANK_WILDCARD);
+        if (PRTE_SUCCESS
+            != (rc = prte_grpcomm_API_rbcast(sig, PRTE_RML_TAG_PROPAGATE, &prperror_buffer))) {
+            PRTE_ERROR_LOG(rc);
+        }
+        PRTE_RELEASE(sig);
     }
     /* notify this error locally, only from rbcast dont have a source id */
     if (source == NULL) {
@@ -384,7 +431,6 @@ static int prte_propagate_prperror(const pmix_nspace_t job, const pmix_proc_t *s
     }
     PMIX_DATA_BUFFER_DESTRUCT(&prperror_buffer);
     PMIX_INFO_FREE(pinfo, pcnt);
-    PRTE_RELEASE(sig);
     /* we're done! */
     return PRTE_SUCCESS;
 }
@@ -499,3 +545,229 @@ static int prte_propagate_prperror_recv(pmix_data_buffer_t *buffer)
     return _prte_propagate_prperror(prte_process_info.myproc.nspace, NULL, &errorproc, state, buffer,
                                     &rly);
 }
+
+/*
+ * Failure sets travel as
+ * ------------------------------------------------------
+ * | cb_type | status | origin | epoch | nwords | bitmap |
+ * ------------------------------------------------------
+ */
+int prte_propagate_prperror_pack_failset(pmix_data_buffer_t *buffer, int cbtype,
+                                         prte_proc_state_t state, pmix_rank_t origin,
+                                         uint32_t epoch, prte_bitmap_t *failed)
+{
+    int32_t nwords = failed->array_size;
+    pmix_status_t rc;
+
+    rc = PMIx_Data_pack(NULL, buffer, &cbtype, 1, PMIX_INT);
+    if (PMIX_SUCCESS != rc) {
+        return prte_pmix_convert_status(rc);
+    }
+    rc = PMIx_Data_pack(NULL, buffer, &state, 1, PMIX_INT);
+    if (PMIX_SUCCESS != rc) {
+        return prte_pmix_convert_status(rc);
+    }
+    rc = PMIx_Data_pack(NULL, buffer, &origin, 1, PMIX_PROC_RANK);
+    if (PMIX_SUCCESS != rc) {
+        return prte_pmix_convert_status(rc);
+    }
+    rc = PMIx_Data_pack(NULL, buffer, &epoch, 1, PMIX_UINT32);
+    if (PMIX_SUCCESS != rc) {
+        return prte_pmix_convert_status(rc);
+    }
+    rc = PMIx_Data_pack(NULL, buffer, &nwords, 1, PMIX_INT32);
+    if (PMIX_SUCCESS != rc) {
+        return prte_pmix_convert_status(rc);
+    }
+    if (0 < nwords) {
+        rc = PMIx_Data_pack(NULL, buffer, failed->bitmap, nwords, PMIX_UINT64);
+        if (PMIX_SUCCESS != rc) {
+            return prte_pmix_convert_status(rc);
+        }
+    }
+    return PRTE_SUCCESS;
+}
+
+int prte_propagate_prperror_unpack_failset(pmix_data_buffer_t *buffer, int *cbtype, int *state,
+                                           pmix_rank_t *origin, uint32_t *epoch,
+                                           uint64_t **words, int32_t *nwords)
+{
+    pmix_status_t rc;
+    int32_t cnt;
+
+    *words = NULL;
+    *nwords = 0;
+    cnt = 1;
+    rc = PMIx_Data_unpack(NULL, buffer, cbtype, &cnt, PMIX_INT);
+    if (PMIX_SUCCESS != rc) {
+        return prte_pmix_convert_status(rc);
+    }
+    cnt = 1;
+    rc = PMIx_Data_unpack(NULL, buffer, state, &cnt, PMIX_INT);
+    if (PMIX_SUCCESS != rc) {
+        return prte_pmix_convert_status(rc);
+    }
+    cnt = 1;
+    rc = PMIx_Data_unpack(NULL, buffer, origin, &cnt, PMIX_PROC_RANK);
+    if (PMIX_SUCCESS != rc) {
+        return prte_pmix_convert_status(rc);
+    }
+    cnt = 1;
+    rc = PMIx_Data_unpack(NULL, buffer, epoch, &cnt, PMIX_UINT32);
+    if (PMIX_SUCCESS != rc) {
+        return prte_pmix_convert_status(rc);
+    }
+    cnt = 1;
+    rc = PMIx_Data_unpack(NULL, buffer, nwords, &cnt, PMIX_INT32);
+    if (PMIX_SUCCESS != rc) {
+        return prte_pmix_convert_status(rc);
+    }
+    if (0 >= *nwords) {
+        *nwords = 0;
+        return PRTE_SUCCESS;
+    }
+    if (NULL == (*words = (uint64_t *) malloc(*nwords * sizeof(uint64_t)))) {
+        *nwords = 0;
+        return PRTE_ERR_OUT_OF_RESOURCE;
+    }
+    /* PMIx hands back fewer words than asked for if that is all
+     * the buffer holds, so a short set must be caught here */
+    cnt = *nwords;
+    rc = PMIx_Data_unpack(NULL, buffer, *words, &cnt, PMIX_UINT64);
+    if (PMIX_SUCCESS != rc || cnt != *nwords) {
+        free(*words);
+        *words = NULL;
+        *nwords = 0;
+        return (PMIX_SUCCESS != rc) ? prte_pmix_convert_status(rc)
+                                    : PRTE_ERR_UNPACK_READ_PAST_END_OF_BUFFER;
+    }
+    return PRTE_SUCCESS;
+}
+
+/*
+ * send every daemon failure we know of in one rbcast
+ */
+static void failset_flush(int fd, short args, void *cbdata)
+{
+    pmix_data_buffer_t buffer;
+    prte_grpcomm_signature_t *sig;
+    int rc;
+
+    failset_pending = false;
+    ++failset_epoch;
+
+    PMIX_DATA_BUFFER_CONSTRUCT(&buffer);
+    rc = prte_propagate_prperror_pack_failset(&buffer, prte_propagate_failset_cb_type,
+                                              failset_state, PRTE_PROC_MY_NAME->rank,
+                                              failset_epoch, &failed_daemons);
+    if (PRTE_SUCCESS != rc) {
+        PRTE_ERROR_LOG(rc);
+        PMIX_DATA_BUFFER_DESTRUCT(&buffer);
+        return;
+    }
+
+    PRTE_OUTPUT_VERBOSE((5, prte_propagate_base_framework.framework_output,
+                         "%s propagate: prperror: rbcast failure set epoch %u with %d daemons",
+                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), failset_epoch, nfailed_daemons));
+
+    /* goes to all daemons */
+    sig = PRTE_NEW(prte_grpcomm_signature_t);
+    sig->signature = (pmix_proc_t *) malloc(sizeof(pmix_proc_t));
+    sig->sz = 1;
+    PMIX_LOAD_PROCID(&sig->signature[0], PRTE_PROC_MY_NAME->nspace, PMIX_RANK_WILDCARD);
+    if (PRTE_SUCCESS != (rc = prte_grpcomm_API_rbcast(sig, PRTE_RML_TAG_PROPAGATE, &buffer))) {
+        PRTE_ERROR_LOG(rc);
+    }
+    PRTE_RELEASE(sig);
+    ++failset_sent;
+    PMIX_DATA_BUFFER_DESTRUCT(&buffer);
+}
+
+/* notify the local procs that a daemon, and the procs on its node, are gone */
+static void notify_daemon_failure(pmix_proc_t *errorproc, prte_proc_state_t state)
+{
+    prte_node_t *node;
+    prte_proc_t *pptr;
+    pmix_info_t *pinfo;
+    size_t pcnt, n;
+    int i;
+
+    node = (prte_node_t *) prte_pointer_array_get_item(prte_node_pool, errorproc->rank);
+    pcnt = 1;
+    if (NULL != node) {
+        pcnt += node->num_procs;
+    }
+    PMIX_INFO_CREATE(pinfo, pcnt);
+    PMIX_INFO_LOAD(&pinfo[0], PMIX_EVENT_AFFECTED_PROC, errorproc, PMIX_PROC);
+    n = 1;
+    if (NULL != node) {
+        for (i = 0; i < node->procs->size && n < pcnt; i++) {
+            if (NULL != (pptr = (prte_proc_t *) prte_pointer_array_get_item(node->procs, i))) {
+                PMIX_INFO_LOAD(&pinfo[n], PMIX_EVENT_AFFECTED_PROC, &pptr->name, PMIX_PROC);
+                ++n;
+            }
+        }
+    }
+    PMIx_Notify_event(prte_pmix_convert_rc(state), NULL, PMIX_RANGE_LOCAL, pinfo, n, NULL, NULL);
+    PMIX_INFO_FREE(pinfo, pcnt);
+}
+
+static int prte_propagate_prperror_failset_recv(pmix_data_buffer_t *buffer)
+{
+    int rc, cbtype, state, w, bit, nnew = 0, nset = 0;
+    pmix_rank_t origin;
+    uint32_t epoch;
+    int32_t nwords;
+    uint64_t *words, word;
+    pmix_proc_t errorproc;
+    prte_namelist_t *nm;
+
+    rc = prte_propagate_prperror_unpack_failset(buffer, &cbtype, &state, &origin, &epoch, &words,
+                                                &nwords);
+    if (PRTE_SUCCESS != rc) {
+        PRTE_ERROR_LOG(rc);
+        return false;
+    }
+    if (0 == nwords) {
+        return false;
+    }
+    ++failset_recvd;
+
+    for (w = 0; w < nwords; w++) {
+        for (word = words[w], bit = 0; 0 != word; word >>= 1, bit++) {
+            if (0 == (word & 1)) {
+                continue;
+            }
+            ++nset;
+            if (prte_bitmap_is_set_bit(&failed_daemons, w * 64 + bit)
+                || PRTE_SUCCESS != prte_bitmap_set_bit(&failed_daemons, w * 64 + bit)) {
+                continue;
+            }
+            ++nfailed_daemons;
+            ++nnew;
+            PMIX_LOAD_PROCID(&errorproc, PRTE_PROC_MY_NAME->nspace, w * 64 + bit);
+            nm = PRTE_NEW(prte_namelist_t);
+            PMIX_XFER_PROCID(&nm->name, &errorproc);
+            prte_list_append(&prte_error_procs, &nm->super);
+            notify_daemon_failure(&errorproc, state);
+        }
+    }
+    free(words);
+
+    PRTE_OUTPUT_VERBOSE((5, prte_propagate_base_framework.framework_output,
+                         "%s propagate: prperror: received failure set epoch %u from %u with %d "
+                         "daemons - %d new",
+                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), epoch, origin, nset, nnew));
+
+    if (failset_pending && nset == nfailed_daemons) {
+        /* this set already carries everything we were going to send */
+        prte_event_evtimer_del(&failset_event);
+        failset_pending = false;
+    }
+    if (0 == nnew) {
+        /* nothing new - everyone we would forward to has it already */
+        ++failset_dups;
+        return false;
+    }
+    return true;
+}
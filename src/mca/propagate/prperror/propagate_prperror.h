@@ -20,7 +20,9 @@
 
 #include "prte_config.h"
 
+#include "src/class/prte_bitmap.h"
 #include "src/mca/propagate/propagate.h"
+#include "src/pmix/pmix-internal.h"
 
 BEGIN_C_DECLS
 
@@ -34,6 +36,23 @@ PRTE_EXPORT extern prte_propagate_base_module_t prte_propagate_prperror_module;
 
 PRTE_EXPORT extern prte_list_t prte_error_procs;
 
+/* msec to hold back a daemon failure so it can be sent with others */
+PRTE_EXPORT extern int prte_propagate_prperror_batch_delay;
+
+/* pack a failure set - the rbcast callback type, the state of the
+ * failed daemons, the daemon sending the set, its epoch and the
+ * bitmap of failed daemon ranks */
+PRTE_EXPORT int prte_propagate_prperror_pack_failset(pmix_data_buffer_t *buffer, int cbtype,
+                                                     prte_proc_state_t state, pmix_rank_t origin,
+                                                     uint32_t epoch, prte_bitmap_t *failed);
+
+/* unpack a failure set. The bitmap comes back as nwords 64-bit words,
+ * which the caller must free - words is NULL if nwords is 0 */
+PRTE_EXPORT int prte_propagate_prperror_unpack_failset(pmix_data_buffer_t *buffer, int *cbtype,
+                                                       int *state, pmix_rank_t *origin,
+                                                       uint32_t *epoch, uint64_t **words,
+                                                       int32_t *nwords);
+
 END_C_DECLS
 
 #endif /* MCA_PROPAGATE_PRPERROR_EXPORT_H */
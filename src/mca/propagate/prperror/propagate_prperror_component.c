@@ -61,6 +61,7 @@ prte_propagate_base_component_t prte_propagate_prperror_component = {
 };
 
 static int my_priority;
+int prte_propagate_prperror_batch_delay = 10;
 
 static int propagate_prperror_register(void)
 {
@@ -73,6 +74,17 @@ static int propagate_prperror_register(void)
                                                 PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
                                                 PRTE_MCA_BASE_VAR_SCOPE_READONLY, &my_priority);
 
+    prte_propagate_prperror_batch_delay = 10;
+    (void) prte_mca_base_component_var_register(
+        c, "batch_delay",
+        "Time (msec) to wait after detecting a daemon failure before propagating it, so that "
+        "failures detected together are propagated in a single broadcast (0 = no wait)",
+        PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
+        PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_propagate_prperror_batch_delay);
+    if (0 > prte_propagate_prperror_batch_delay) {
+        prte_propagate_prperror_batch_delay = 0;
+    }
+
     return PRTE_SUCCESS;
 }
 
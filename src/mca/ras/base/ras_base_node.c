@@ -208,6 +208,8 @@ int prte_ras_base_node_insert(prte_list_t *nodes, prte_job_t *jdata)
             }
         }
     }
+    /* slot counts may have changed, so every node is a candidate again */
+    prte_rmaps_base_free_index_reset();
 
     return PRTE_SUCCESS;
 }
@@ -33,6 +33,7 @@
 #include "prte_config.h"
 #include "types.h"
 
+#include "src/class/prte_bitmap.h"
 #include "src/class/prte_list.h"
 #include "src/mca/mca.h"
 #include "src/util/printf.h"
@@ -74,6 +75,12 @@ typedef struct {
     /* default file for use in sequential and rankfile mapping
      * when the directive comes thru MCA param */
     char *file;
+    /* number of threads for per-node binding and ranking passes */
+    int threads;
+    /* free-slot index over the daemons' nodes */
+    bool free_index_active;
+    prte_bitmap_t free_slots;
+    int free_nranks;
 } prte_rmaps_base_t;
 
 /**
@@ -121,6 +128,11 @@ PRTE_EXPORT int prte_rmaps_base_set_ranking_policy(prte_job_t *jdata, char *spec
 
 PRTE_EXPORT void prte_rmaps_base_display_map(prte_job_t *jdata);
 
+/* free-slot index maintenance - mark a node whose slots were
+ * released, or mark all nodes after the allocation changed */
+PRTE_EXPORT void prte_rmaps_base_free_index_mark(prte_node_t *node);
+PRTE_EXPORT void prte_rmaps_base_free_index_reset(void);
+
 END_C_DECLS
 
 #endif
@@ -137,21 +137,57 @@ static void unbind_procs(prte_job_t *jdata)
     }
 }
 
-static int bind_generic(prte_job_t *jdata, prte_node_t *node, int target_depth)
+/* usage is tracked in a private array indexed by the logical index of
+ * the objects at the target depth rather than in the topology userdata,
+ * so that nodes sharing a topology can be bound concurrently. Only
+ * other jobs' procs bound at the target depth can affect the choice */
+static unsigned int *count_usage(prte_node_t *node, pmix_nspace_t jobid, int target_depth)
 {
     int j;
+    prte_proc_t *proc;
+    hwloc_obj_t bound;
+    unsigned int *usage, nobjs;
+
+    nobjs = hwloc_get_nbobjs_by_depth(node->topology->topo, target_depth);
+    usage = (unsigned int *) calloc((0 == nobjs) ? 1 : nobjs, sizeof(unsigned int));
+    if (NULL == usage) {
+        return NULL;
+    }
+    for (j = 0; j < node->procs->size; j++) {
+        if (NULL == (proc = (prte_proc_t *) prte_pointer_array_get_item(node->procs, j))) {
+            continue;
+        }
+        /* ignore procs from this job */
+        if (PMIX_CHECK_NSPACE(proc->name.nspace, jobid)) {
+            continue;
+        }
+        bound = NULL;
+        if (!prte_get_attribute(&proc->attributes, PRTE_PROC_HWLOC_BOUND, (void **) &bound,
+                                PMIX_POINTER)
+            || NULL == bound || bound->depth != target_depth || nobjs <= bound->logical_index) {
+            continue;
+        }
+        usage[bound->logical_index]++;
+    }
+    return usage;
+}
+
+/* when quiet is set (concurrent binding), errors are returned without
+ * reporting them and without touching any job-level state - the caller
+ * then recomputes serially to produce the proper diagnostics */
+static int bind_generic(prte_job_t *jdata, prte_node_t *node, int target_depth, bool quiet)
+{
+    int j, rc = PRTE_SUCCESS;
     prte_job_map_t *map;
     prte_proc_t *proc;
     hwloc_obj_t trg_obj, tmp_obj, nxt_obj;
-    unsigned int ncpus;
-    prte_hwloc_obj_data_t *data;
+    unsigned int ncpus, *usage;
     int total_cpus, cpus_per_rank;
     hwloc_cpuset_t totalcpuset, available, mycpus;
     hwloc_obj_t locale;
     char *cpu_bitmap, *job_cpuset;
     unsigned min_bound;
     bool dobind, use_hwthread_cpus;
-    struct hwloc_topology_support *support;
     hwloc_obj_t root;
     prte_hwloc_topo_data_t *rdata;
     uint16_t u16, *u16ptr = &u16;
@@ -162,7 +198,6 @@ static int bind_generic(prte_job_t *jdata, prte_node_t *node, int target_depth)
                         prte_hwloc_base_print_binding(jdata->map->binding));
     /* initialize */
     map = jdata->map;
-    totalcpuset = hwloc_bitmap_alloc();
 
     dobind = false;
     if (prte_get_attribute(&jdata->attributes, PRTE_JOB_DO_NOT_LAUNCH, NULL, PMIX_BOOL)
@@ -170,8 +205,6 @@ static int bind_generic(prte_job_t *jdata, prte_node_t *node, int target_depth)
         || prte_get_attribute(&jdata->attributes, PRTE_JOB_DISPLAY_DEVEL_MAP, NULL, PMIX_BOOL)) {
         dobind = true;
     }
-    /* reset usage */
-    reset_usage(node, jdata->nspace);
 
     /* get the available processors on this node */
     root = hwloc_get_root_obj(node->topology->topo);
@@ -181,6 +214,13 @@ static int bind_generic(prte_job_t *jdata, prte_node_t *node, int target_depth)
         return PRTE_ERR_BAD_PARAM;
     }
     rdata = (prte_hwloc_topo_data_t *) root->userdata;
+
+    /* count the usage by other jobs */
+    if (NULL == (usage = count_usage(node, jdata->nspace, target_depth))) {
+        PRTE_ERROR_LOG(PRTE_ERR_OUT_OF_RESOURCE);
+        return PRTE_ERR_OUT_OF_RESOURCE;
+    }
+    totalcpuset = hwloc_bitmap_alloc();
     available = hwloc_bitmap_dup(rdata->available);
 
     /* see if they want multiple cpus/rank */
@@ -208,7 +248,8 @@ static int bind_generic(prte_job_t *jdata, prte_node_t *node, int target_depth)
         hwloc_bitmap_free(mycpus);
     }
 
-    /* cycle thru the procs */
+    /* cycle thru the procs - the caller has already checked that
+     * the node supports the requested binding */
     for (j = 0; j < node->procs->size; j++) {
         if (NULL == (proc = (prte_proc_t *) prte_pointer_array_get_item(node->procs, j))) {
             continue;
@@ -221,73 +262,17 @@ static int bind_generic(prte_job_t *jdata, prte_node_t *node, int target_depth)
             continue;
         }
 
-        if (!prte_get_attribute(&jdata->attributes, PRTE_JOB_DO_NOT_LAUNCH, NULL, PMIX_BOOL)) {
-            /* if we don't want to launch, then we are just testing the system,
-             * so ignore questions about support capabilities
-             */
-            support = (struct hwloc_topology_support *) hwloc_topology_get_support(
-                node->topology->topo);
-            /* check if topology supports cpubind - have to be careful here
-             * as Linux doesn't currently support thread-level binding. This
-             * may change in the future, though, and it isn't clear how hwloc
-             * interprets the current behavior. So check both flags to be sure.
-             */
-            if (!support->cpubind->set_thisproc_cpubind
-                && !support->cpubind->set_thisthread_cpubind) {
-                if (!PRTE_BINDING_REQUIRED(map->binding)
-                    || !PRTE_BINDING_POLICY_IS_SET(map->binding)) {
-                    /* we are not required to bind, so ignore this */
-                    continue;
-                }
-                prte_show_help("help-prte-rmaps-base.txt", "rmaps:cpubind-not-supported", true,
-                               node->name);
-                hwloc_bitmap_free(totalcpuset);
-                hwloc_bitmap_free(available);
-                if (NULL != job_cpuset) {
-                    free(job_cpuset);
-                }
-                return PRTE_ERR_SILENT;
-            }
-            /* check if topology supports membind - have to be careful here
-             * as hwloc treats this differently than I (at least) would have
-             * expected. Per hwloc, Linux memory binding is at the thread,
-             * and not process, level. Thus, hwloc sets the "thisproc" flag
-             * to "false" on all Linux systems, and uses the "thisthread" flag
-             * to indicate binding capability - don't warn if the user didn't
-             * specifically request binding
-             */
-            if (!support->membind->set_thisproc_membind && !support->membind->set_thisthread_membind
-                && PRTE_BINDING_POLICY_IS_SET(map->binding)) {
-                if (PRTE_HWLOC_BASE_MBFA_WARN == prte_hwloc_base_mbfa && !membind_warned) {
-                    prte_show_help("help-prte-rmaps-base.txt", "rmaps:membind-not-supported", true,
-                                   node->name);
-                    membind_warned = true;
-                } else if (PRTE_HWLOC_BASE_MBFA_ERROR == prte_hwloc_base_mbfa) {
-                    prte_show_help("help-prte-rmaps-base.txt", "rmaps:membind-not-supported-fatal",
-                                   true, node->name);
-                    hwloc_bitmap_free(totalcpuset);
-                    hwloc_bitmap_free(available);
-                    if (NULL != job_cpuset) {
-                        free(job_cpuset);
-                    }
-                    return PRTE_ERR_SILENT;
-                }
-            }
-        }
-
         /* bozo check */
         locale = NULL;
         if (!prte_get_attribute(&proc->attributes, PRTE_PROC_HWLOC_LOCALE, (void **) &locale,
                                 PMIX_POINTER)
             || NULL == locale) {
-            prte_show_help("help-prte-rmaps-base.txt", "rmaps:no-locale", true,
-                           PRTE_NAME_PRINT(&proc->name));
-            hwloc_bitmap_free(totalcpuset);
-            hwloc_bitmap_free(available);
-            if (NULL != job_cpuset) {
-                free(job_cpuset);
+            if (!quiet) {
+                prte_show_help("help-prte-rmaps-base.txt", "rmaps:no-locale", true,
+                               PRTE_NAME_PRINT(&proc->name));
             }
-            return PRTE_ERR_SILENT;
+            rc = PRTE_ERR_SILENT;
+            goto cleanup;
         }
 
         /* use the min_bound object that intersects locale->cpuset at target_depth */
@@ -304,25 +289,19 @@ static int bind_generic(prte_job_t *jdata, prte_node_t *node, int target_depth)
             if (!hwloc_bitmap_intersects(available, tmp_obj->cpuset))
                 continue;
 
-            data = (prte_hwloc_obj_data_t *) tmp_obj->userdata;
-            if (NULL == data) {
-                data = PRTE_NEW(prte_hwloc_obj_data_t);
-                tmp_obj->userdata = data;
-            }
-            if (data->num_bound < min_bound) {
-                min_bound = data->num_bound;
+            if (usage[tmp_obj->logical_index] < min_bound) {
+                min_bound = usage[tmp_obj->logical_index];
                 trg_obj = tmp_obj;
             }
         }
         if (NULL == trg_obj) {
             /* there aren't any such targets under this object */
-            prte_show_help("help-prte-rmaps-base.txt", "rmaps:no-available-cpus", true, node->name);
-            hwloc_bitmap_free(totalcpuset);
-            hwloc_bitmap_free(available);
-            if (NULL != job_cpuset) {
-                free(job_cpuset);
+            if (!quiet) {
+                prte_show_help("help-prte-rmaps-base.txt", "rmaps:no-available-cpus", true,
+                               node->name);
             }
-            return PRTE_ERR_SILENT;
+            rc = PRTE_ERR_SILENT;
+            goto cleanup;
         }
         /* record the location */
         prte_set_attribute(&proc->attributes, PRTE_PROC_HWLOC_BOUND, PRTE_ATTR_LOCAL, trg_obj,
@@ -335,29 +314,29 @@ static int bind_generic(prte_job_t *jdata, prte_node_t *node, int target_depth)
         do {
             if (NULL == nxt_obj) {
                 /* could not find enough cpus to meet request */
-                prte_show_help("help-prte-rmaps-base.txt", "rmaps:no-available-cpus", true,
-                               node->name);
-                hwloc_bitmap_free(totalcpuset);
-                hwloc_bitmap_free(available);
-                if (NULL != job_cpuset) {
-                    free(job_cpuset);
+                if (!quiet) {
+                    prte_show_help("help-prte-rmaps-base.txt", "rmaps:no-available-cpus", true,
+                                   node->name);
                 }
-                return PRTE_ERR_SILENT;
+                rc = PRTE_ERR_SILENT;
+                goto cleanup;
             }
             trg_obj = nxt_obj;
             /* get the number of available cpus under this location */
             ncpus = prte_hwloc_base_get_npus(node->topology->topo, use_hwthread_cpus, available,
                                              trg_obj);
             /* track the number bound */
-            if (NULL == (data = (prte_hwloc_obj_data_t *) trg_obj->userdata)) {
-                data = PRTE_NEW(prte_hwloc_obj_data_t);
-                trg_obj->userdata = data;
-            }
-            data->num_bound++;
+            usage[trg_obj->logical_index]++;
             /* error out if adding a proc would cause overload and that wasn't allowed,
              * and it wasn't a default binding policy (i.e., the user requested it)
              */
-            if (ncpus < data->num_bound && !PRTE_BIND_OVERLOAD_ALLOWED(jdata->map->binding)) {
+            if (ncpus < usage[trg_obj->logical_index]
+                && !PRTE_BIND_OVERLOAD_ALLOWED(jdata->map->binding)) {
+                if (quiet) {
+                    /* let the serial pass sort it out */
+                    rc = PRTE_ERR_TAKE_NEXT_OPTION;
+                    goto cleanup;
+                }
                 if (PRTE_BINDING_POLICY_IS_SET(jdata->map->binding)) {
                     /* if the user specified a binding policy, then we cannot meet
                      * it since overload isn't allowed, so error out - have the
@@ -365,13 +344,9 @@ static int bind_generic(prte_job_t *jdata, prte_node_t *node, int target_depth)
                      * this restriction */
                     prte_show_help("help-prte-rmaps-base.txt", "rmaps:binding-overload", true,
                                    prte_hwloc_base_print_binding(map->binding), node->name,
-                                   data->num_bound, ncpus);
-                    hwloc_bitmap_free(totalcpuset);
-                    hwloc_bitmap_free(available);
-                    if (NULL != job_cpuset) {
-                        free(job_cpuset);
-                    }
-                    return PRTE_ERR_SILENT;
+                                   usage[trg_obj->logical_index], ncpus);
+                    rc = PRTE_ERR_SILENT;
+                    goto cleanup;
                 } else if (1 < cpus_per_rank) {
                     /* if the user specified cpus/proc, then we weren't able
                      * to meet that request - this constitutes an error that
@@ -383,11 +358,8 @@ static int bind_generic(prte_job_t *jdata, prte_node_t *node, int target_depth)
                                        ? "FULL"
                                        : prte_hwloc_default_cpu_list,
                                    cpus_per_rank);
-                    hwloc_bitmap_free(available);
-                    if (NULL != job_cpuset) {
-                        free(job_cpuset);
-                    }
-                    return PRTE_ERR_SILENT;
+                    rc = PRTE_ERR_SILENT;
+                    goto cleanup;
                 } else {
                     /* if we have the default binding policy, then just don't bind */
                     prte_output_verbose(5, prte_rmaps_base_framework.framework_output,
@@ -396,12 +368,8 @@ static int bind_generic(prte_job_t *jdata, prte_node_t *node, int target_depth)
                                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME));
                     PRTE_SET_BINDING_POLICY(map->binding, PRTE_BIND_TO_NONE);
                     unbind_procs(jdata);
-                    hwloc_bitmap_free(totalcpuset);
-                    hwloc_bitmap_free(available);
-                    if (NULL != job_cpuset) {
-                        free(job_cpuset);
-                    }
-                    return PRTE_SUCCESS;
+                    rc = PRTE_SUCCESS;
+                    goto cleanup;
                 }
             }
             /* bind the proc here */
@@ -429,13 +397,16 @@ static int bind_generic(prte_job_t *jdata, prte_node_t *node, int target_depth)
             free(tmp1);
         }
     }
+
+cleanup:
     hwloc_bitmap_free(totalcpuset);
     hwloc_bitmap_free(available);
+    free(usage);
     if (NULL != job_cpuset) {
         free(job_cpuset);
     }
 
-    return PRTE_SUCCESS;
+    return rc;
 }
 
 static int bind_in_place(prte_job_t *jdata, hwloc_obj_type_t target, unsigned cache_level)
@@ -949,17 +920,31 @@ static int bind_to_cpuset(prte_job_t *jdata)
     return PRTE_SUCCESS;
 }
 
+typedef struct {
+    prte_job_t *jdata;
+    int *depths;
+    bool quiet;
+} bind_caddy_t;
+
+static int bind_node(prte_node_t *node, int idx, void *cbdata)
+{
+    bind_caddy_t *cd = (bind_caddy_t *) cbdata;
+
+    return bind_generic(cd->jdata, node, cd->depths[idx], cd->quiet);
+}
+
 int prte_rmaps_base_compute_bindings(prte_job_t *jdata)
 {
     hwloc_obj_type_t hwb;
     unsigned clvl = 0;
     prte_binding_policy_t bind;
     prte_mapping_policy_t map;
-    prte_node_t *node;
-    int i, rc;
+    prte_node_t *node, **nodes = NULL;
+    int i, rc, nnodes = 0;
     struct hwloc_topology_support *support;
     int bind_depth;
     bool dobind;
+    bind_caddy_t cd;
 
     prte_output_verbose(5, prte_rmaps_base_framework.framework_output,
                         "mca:rmaps: compute bindings for job %s with policy %s[%x]",
@@ -1058,6 +1043,20 @@ execute:
         dobind = true;
     }
 
+    /* check each node and find its binding depth, then bind the procs
+     * on all the nodes at once - binding a node only depends on the
+     * procs on that node, so this can be spread across threads */
+    cd.jdata = jdata;
+    cd.quiet = false;
+    i = (dobind && 0 < jdata->map->nodes->size) ? jdata->map->nodes->size : 1;
+    nodes = (prte_node_t **) malloc(i * sizeof(prte_node_t *));
+    cd.depths = (int *) malloc(i * sizeof(int));
+    if (NULL == nodes || NULL == cd.depths) {
+        rc = PRTE_ERR_OUT_OF_RESOURCE;
+        PRTE_ERROR_LOG(rc);
+        goto done;
+    }
+
     for (i = 0; i < jdata->map->nodes->size; i++) {
         if (NULL == (node = (prte_node_t *) prte_pointer_array_get_item(jdata->map->nodes, i))) {
             continue;
@@ -1085,7 +1084,8 @@ execute:
                 }
                 prte_show_help("help-prte-rmaps-base.txt", "rmaps:cpubind-not-supported", true,
                                node->name);
-                return PRTE_ERR_SILENT;
+                rc = PRTE_ERR_SILENT;
+                goto done;
             }
             /* check if topology supports membind - have to be careful here
              * as hwloc treats this differently than I (at least) would have
@@ -1104,7 +1104,8 @@ execute:
                 } else if (PRTE_HWLOC_BASE_MBFA_ERROR == prte_hwloc_base_mbfa) {
                     prte_show_help("help-prte-rmaps-base.txt", "rmaps:membind-not-supported-fatal",
                                    true, node->name);
-                    return PRTE_ERR_SILENT;
+                    rc = PRTE_ERR_SILENT;
+                    goto done;
                 }
             }
         }
@@ -1143,15 +1144,44 @@ execute:
             /* didn't find such an object */
             prte_show_help("help-prte-rmaps-base.txt", "prte-rmaps-base:no-objects", true,
                            hwloc_obj_type_string(hwb), node->name);
-            return PRTE_ERR_SILENT;
+            rc = PRTE_ERR_SILENT;
+            goto done;
         }
         prte_output_verbose(5, prte_rmaps_base_framework.framework_output, "%s bind_depth: %d",
                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), bind_depth);
-        if (PRTE_SUCCESS != (rc = bind_generic(jdata, node, bind_depth))) {
+        nodes[nnodes] = node;
+        cd.depths[nnodes] = bind_depth;
+        ++nnodes;
+    }
+
+    if (1 < nnodes && 1 < prte_rmaps_base.threads) {
+        /* errors are left for a serial pass to report so that the
+         * diagnostics are the same as without threads */
+        cd.quiet = true;
+        rc = prte_rmaps_base_foreach_node(nodes, nnodes, bind_node, &cd);
+        cd.quiet = false;
+        if (PRTE_SUCCESS == rc) {
+            goto done;
+        }
+    }
+    for (i = 0; i < nnodes; i++) {
+        if (PRTE_SUCCESS != (rc = bind_generic(jdata, nodes[i], cd.depths[i], false))) {
             PRTE_ERROR_LOG(rc);
-            return rc;
+            goto done;
+        }
+        if (PRTE_BIND_TO_NONE == PRTE_GET_BINDING_POLICY(jdata->map->binding)) {
+            /* we reverted to not binding */
+            break;
         }
     }
+    rc = PRTE_SUCCESS;
 
-    return PRTE_SUCCESS;
+done:
+    if (NULL != nodes) {
+        free(nodes);
+    }
+    if (NULL != cd.depths) {
+        free(cd.depths);
+    }
+    return rc;
 }
@@ -59,6 +59,8 @@ prte_rmaps_base_t prte_rmaps_base = {{{0}}};
 static char *rmaps_base_mapping_policy = NULL;
 static char *rmaps_base_ranking_policy = NULL;
 static bool rmaps_base_inherit = false;
+static bool rmaps_base_free_index = true;
+static int rmaps_base_threads = 1;
 
 static int prte_rmaps_base_register(prte_mca_base_register_flag_t flags)
 {
@@ -93,6 +95,24 @@ static int prte_rmaps_base_register(prte_mca_base_register_flag_t flags)
                                       PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
                                       PRTE_MCA_BASE_VAR_SCOPE_READONLY, &rmaps_base_inherit);
 
+    rmaps_base_free_index = true;
+    (void) prte_mca_base_var_register("prte", "rmaps", "base", "free_index",
+                                      "Track which nodes have free slots so that jobs mapped by "
+                                      "slot or by object only examine the nodes they need",
+                                      PRTE_MCA_BASE_VAR_TYPE_BOOL, NULL, 0,
+                                      PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
+                                      PRTE_MCA_BASE_VAR_SCOPE_READONLY, &rmaps_base_free_index);
+
+    rmaps_base_threads = 1;
+    (void) prte_mca_base_var_register("prte", "rmaps", "base", "threads",
+                                      "Number of threads used to compute bindings and "
+                                      "object-based rankings for large maps (default: 1 - "
+                                      "computed serially; always 1 with hwloc versions "
+                                      "before 2.0)",
+                                      PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0,
+                                      PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
+                                      PRTE_MCA_BASE_VAR_SCOPE_READONLY, &rmaps_base_threads);
+
     return PRTE_SUCCESS;
 }
 
@@ -105,6 +125,10 @@ static int prte_rmaps_base_close(void)
         PRTE_RELEASE(item);
     }
     PRTE_DESTRUCT(&prte_rmaps_base.selected_modules);
+    if (prte_rmaps_base.free_index_active) {
+        prte_rmaps_base.free_index_active = false;
+        PRTE_DESTRUCT(&prte_rmaps_base.free_slots);
+    }
 
     return prte_mca_base_framework_components_close(&prte_rmaps_base_framework, NULL);
 }
@@ -123,6 +147,28 @@ static int prte_rmaps_base_open(prte_mca_base_open_flag_t flags)
     prte_rmaps_base.ranking = 0;
     prte_rmaps_base.inherit = rmaps_base_inherit;
     prte_rmaps_base.hwthread_cpus = false;
+#if HWLOC_API_VERSION < 0x20000
+    /* hwloc 1.x object counts (e.g., of caches) are filled into the
+     * shared topology's root userdata on first use, so threads working
+     * on nodes with the same topology would race to fill them */
+    if (1 < rmaps_base_threads) {
+        prte_output_verbose(1, prte_rmaps_base_framework.framework_output,
+                            "rmaps:base threads requires hwloc 2.0 or later - "
+                            "computing bindings serially");
+    }
+    prte_rmaps_base.threads = 1;
+#else
+    prte_rmaps_base.threads = (1 < rmaps_base_threads) ? rmaps_base_threads : 1;
+#endif
+    if (rmaps_base_free_index) {
+        PRTE_CONSTRUCT(&prte_rmaps_base.free_slots, prte_bitmap_t);
+        if (PRTE_SUCCESS != (rc = prte_bitmap_init(&prte_rmaps_base.free_slots, 64))) {
+            PRTE_DESTRUCT(&prte_rmaps_base.free_slots);
+            return rc;
+        }
+        prte_rmaps_base.free_nranks = 0;
+        prte_rmaps_base.free_index_active = true;
+    }
     if (NULL == prte_set_slots) {
         prte_set_slots = strdup("core");
     }
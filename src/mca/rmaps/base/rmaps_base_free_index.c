@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2021      Nanook Consulting.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+/** @file
+ *
+ * Free-slot index for mapping small jobs in a large DVM.
+ *
+ * The index is a bitmap over daemon ranks. A set bit means the node
+ * hosting that daemon may have free slots; a clear bit means the node
+ * was found to be full and none of its slots have been released since.
+ * Bits are only ever cleared by a query that finds the node full, and
+ * are set again whenever slots on the node are released - so a stale
+ * set bit costs one extra check, but a clear bit is always accurate.
+ *
+ * Mappers that fill nodes in daemon order (byslot and the by-object
+ * policies without SPAN) only ever look at the first nodes that have
+ * enough free slots for the job. For those, the index hands back just
+ * those nodes instead of every node in the allocation, so mapping a job
+ * that needs k nodes no longer touches every node in the DVM.
+ */
+
+#include "prte_config.h"
+#include "constants.h"
+
+#include "src/class/prte_bitmap.h"
+#include "src/mca/errmgr/errmgr.h"
+#include "src/runtime/prte_globals.h"
+#include "src/util/name_fns.h"
+#include "src/util/output.h"
+
+#include "src/mca/rmaps/base/base.h"
+#include "src/mca/rmaps/base/rmaps_private.h"
+
+void prte_rmaps_base_free_index_mark(prte_node_t *node)
+{
+    if (!prte_rmaps_base.free_index_active || NULL == node->daemon
+        || (int) node->daemon->name.rank >= prte_rmaps_base.free_nranks) {
+        /* ranks beyond the indexed range are picked up on the next query */
+        return;
+    }
+    prte_bitmap_set_bit(&prte_rmaps_base.free_slots, node->daemon->name.rank);
+}
+
+void prte_rmaps_base_free_index_reset(void)
+{
+    int n;
+
+    if (!prte_rmaps_base.free_index_active) {
+        return;
+    }
+    for (n = 0; n < prte_rmaps_base.free_nranks; n++) {
+        prte_bitmap_set_bit(&prte_rmaps_base.free_slots, n);
+    }
+}
+
+static bool fills_in_order(prte_mapping_policy_t policy)
+{
+    if (PRTE_MAPPING_SPAN & PRTE_GET_MAPPING_DIRECTIVE(policy)) {
+        return false;
+    }
+    switch (PRTE_GET_MAPPING_POLICY(policy)) {
+    case PRTE_MAPPING_BYSLOT:
+    case PRTE_MAPPING_BYHWTHREAD:
+    case PRTE_MAPPING_BYCORE:
+    case PRTE_MAPPING_BYL1CACHE:
+    case PRTE_MAPPING_BYL2CACHE:
+    case PRTE_MAPPING_BYL3CACHE:
+    case PRTE_MAPPING_BYPACKAGE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+int prte_rmaps_base_get_free_nodes(prte_list_t *node_list, int32_t *total_num_slots,
+                                   prte_app_context_t *app, prte_mapping_policy_t policy,
+                                   bool initial_map)
+{
+    prte_job_t *daemons;
+    prte_proc_t *dmn;
+    prte_node_t *node;
+    prte_list_item_t *item;
+    uint64_t word;
+    int32_t num_slots = 0, s;
+    int w, bit, rank, nchecked = 0;
+    bool skip_hnp;
+
+    *total_num_slots = 0;
+
+    /* the index can only answer requests for a known number of procs
+     * from the whole allocation - anything that filters the node list
+     * or needs every node goes thru the full search */
+    if (!prte_rmaps_base.free_index_active || 0 == app->num_procs
+        || PRTE_FLAG_TEST(app, PRTE_APP_DEBUGGER_DAEMON) || !fills_in_order(policy)
+        || prte_get_attribute(&app->attributes, PRTE_APP_DASH_HOST, NULL, PMIX_STRING)
+        || prte_get_attribute(&app->attributes, PRTE_APP_HOSTFILE, NULL, PMIX_STRING)
+        || prte_get_attribute(&app->attributes, PRTE_APP_ADD_HOST, NULL, PMIX_STRING)
+        || prte_get_attribute(&app->attributes, PRTE_APP_ADD_HOSTFILE, NULL, PMIX_STRING)) {
+        return PRTE_ERR_TAKE_NEXT_OPTION;
+    }
+    daemons = prte_get_job_data_object(PRTE_PROC_MY_NAME->nspace);
+    if (NULL == daemons
+        || prte_get_attribute(&daemons->attributes, PRTE_JOB_NO_VM, NULL, PMIX_BOOL)) {
+        return PRTE_ERR_TAKE_NEXT_OPTION;
+    }
+
+    /* any daemons added since the last query start out as candidates */
+    for (rank = prte_rmaps_base.free_nranks; rank < (int) daemons->num_procs; rank++) {
+        prte_bitmap_set_bit(&prte_rmaps_base.free_slots, rank);
+    }
+    prte_rmaps_base.free_nranks = daemons->num_procs;
+
+    skip_hnp = !prte_hnp_is_allocated
+               || (PRTE_GET_MAPPING_DIRECTIVE(policy) & PRTE_MAPPING_NO_USE_LOCAL);
+
+    for (w = 0; w < prte_rmaps_base.free_slots.array_size && num_slots < (int32_t) app->num_procs;
+         w++) {
+        word = prte_rmaps_base.free_slots.bitmap[w];
+        for (bit = 0; 0 != word && bit < 64 && num_slots < (int32_t) app->num_procs; bit++) {
+            if (0 == (word & ((uint64_t) 1 << bit))) {
+                continue;
+            }
+            word &= ~((uint64_t) 1 << bit);
+            rank = w * 64 + bit;
+            if (rank >= prte_rmaps_base.free_nranks) {
+                break;
+            }
+            ++nchecked;
+            dmn = (prte_proc_t *) prte_pointer_array_get_item(daemons->procs, rank);
+            if (NULL == dmn || NULL == (node = dmn->node)) {
+                continue;
+            }
+            if (skip_hnp && 0 == node->index) {
+                continue;
+            }
+            if (PRTE_FLAG_TEST(node, PRTE_NODE_NON_USABLE) || PRTE_NODE_STATE_DOWN == node->state
+                || PRTE_NODE_STATE_NOT_INCLUDED == node->state) {
+                continue;
+            }
+            if (PRTE_NODE_STATE_DO_NOT_USE == node->state
+                || (0 != node->slots_max && node->slots_max < node->slots)) {
+                /* the full search resets do-not-use and knows how
+                 * to cap nodes at their max slots */
+                goto fallback;
+            }
+            if (node->slots <= node->slots_inuse) {
+                /* full - drop it until some of its slots are released */
+                prte_bitmap_clear_bit(&prte_rmaps_base.free_slots, rank);
+                continue;
+            }
+            s = node->slots - node->slots_inuse;
+            PRTE_RETAIN(node);
+            if (initial_map) {
+                PRTE_FLAG_UNSET(node, PRTE_NODE_FLAG_MAPPED);
+            }
+            node->slots_available = s;
+            prte_list_append(node_list, &node->super);
+            num_slots += s;
+        }
+    }
+
+    if (num_slots < (int32_t) app->num_procs) {
+        /* not enough free slots - let the full search deal with
+         * oversubscription and error reporting */
+        goto fallback;
+    }
+
+    PRTE_OUTPUT_VERBOSE((5, prte_rmaps_base_framework.framework_output,
+                         "%s free index found %d slots on %d nodes after checking %d of %d",
+                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), num_slots,
+                         (int) prte_list_get_size(node_list), nchecked,
+                         prte_rmaps_base.free_nranks));
+
+    *total_num_slots = num_slots;
+    return PRTE_SUCCESS;
+
+fallback:
+    while (NULL != (item = prte_list_remove_first(node_list))) {
+        PRTE_RELEASE(item);
+    }
+    return PRTE_ERR_TAKE_NEXT_OPTION;
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2021      Nanook Consulting.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+/** @file
+ *
+ * Execution of independent per-node passes (binding, object-based
+ * ranking) across several threads.
+ *
+ * The nodes are divided into contiguous blocks, one per thread, with
+ * the calling thread taking the first block. Each pass must only
+ * modify state belonging to its own node and its procs, so the result
+ * is the same no matter how many threads are used. Only one thread
+ * is ever used with hwloc versions before 2.0 - see rmaps_base_frame.c.
+ */
+
+#include "prte_config.h"
+#include "constants.h"
+
+#include <stdlib.h>
+
+#include "src/mca/errmgr/errmgr.h"
+#include "src/threads/threads.h"
+#include "src/util/name_fns.h"
+#include "src/util/output.h"
+
+#include "src/mca/rmaps/base/base.h"
+#include "src/mca/rmaps/base/rmaps_private.h"
+
+/* don't bother starting a thread for fewer nodes than this */
+#define PRTE_RMAPS_BASE_MIN_NODES_PER_THREAD 16
+
+typedef struct {
+    prte_thread_t thread;
+    prte_node_t **nodes;
+    int start;
+    int end;
+    prte_rmaps_base_node_fn_t fn;
+    void *cbdata;
+    int rc;
+    bool started;
+} node_block_t;
+
+static void run_block(node_block_t *blk)
+{
+    int n;
+
+    blk->rc = PRTE_SUCCESS;
+    for (n = blk->start; n < blk->end; n++) {
+        if (PRTE_SUCCESS != (blk->rc = blk->fn(blk->nodes[n], n, blk->cbdata))) {
+            break;
+        }
+    }
+}
+
+static void *block_thread(prte_object_t *obj)
+{
+    prte_thread_t *t = (prte_thread_t *) obj;
+
+    run_block((node_block_t *) t->t_arg);
+    return NULL;
+}
+
+int prte_rmaps_base_foreach_node(prte_node_t **nodes, int nnodes, prte_rmaps_base_node_fn_t fn,
+                                 void *cbdata)
+{
+    node_block_t *blks;
+    int nthreads, n, chunk, extra, start, rc;
+
+    nthreads = prte_rmaps_base.threads;
+    if (nthreads > nnodes / PRTE_RMAPS_BASE_MIN_NODES_PER_THREAD) {
+        nthreads = nnodes / PRTE_RMAPS_BASE_MIN_NODES_PER_THREAD;
+    }
+    if (1 >= nthreads) {
+        for (n = 0; n < nnodes; n++) {
+            if (PRTE_SUCCESS != (rc = fn(nodes[n], n, cbdata))) {
+                return rc;
+            }
+        }
+        return PRTE_SUCCESS;
+    }
+
+    blks = (node_block_t *) calloc(nthreads, sizeof(node_block_t));
+    if (NULL == blks) {
+        PRTE_ERROR_LOG(PRTE_ERR_OUT_OF_RESOURCE);
+        return PRTE_ERR_OUT_OF_RESOURCE;
+    }
+
+    prte_output_verbose(5, prte_rmaps_base_framework.framework_output,
+                        "%s rmaps:base processing %d nodes on %d threads",
+                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), nnodes, nthreads);
+
+    chunk = nnodes / nthreads;
+    extra = nnodes % nthreads;
+    start = 0;
+    for (n = 0; n < nthreads; n++) {
+        blks[n].nodes = nodes;
+        blks[n].start = start;
+        blks[n].end = start + chunk + ((n < extra) ? 1 : 0);
+        blks[n].fn = fn;
+        blks[n].cbdata = cbdata;
+        start = blks[n].end;
+        if (0 == n) {
+            /* we run this one ourselves */
+            continue;
+        }
+        PRTE_CONSTRUCT(&blks[n].thread, prte_thread_t);
+        blks[n].thread.t_run = block_thread;
+        blks[n].thread.t_arg = &blks[n];
+        blks[n].started = (PRTE_SUCCESS == prte_thread_start(&blks[n].thread));
+    }
+
+    run_block(&blks[0]);
+    for (n = 1; n < nthreads; n++) {
+        if (blks[n].started) {
+            prte_thread_join(&blks[n].thread, NULL);
+        } else {
+            /* couldn't get a thread - do it here */
+            run_block(&blks[n]);
+        }
+        PRTE_DESTRUCT(&blks[n].thread);
+    }
+
+    /* report the error from the earliest node that failed */
+    rc = PRTE_SUCCESS;
+    for (n = 0; n < nthreads; n++) {
+        if (PRTE_SUCCESS != blks[n].rc) {
+            rc = blks[n].rc;
+            break;
+        }
+    }
+    free(blks);
+    return rc;
+}
@@ -341,20 +341,123 @@ static int rank_fill(prte_job_t *jdata, hwloc_obj_type_t target, unsigned cache_
     return PRTE_SUCCESS;
 }
 
+typedef struct {
+    prte_job_t *jdata;
+    prte_app_context_t *app;
+    hwloc_obj_type_t target;
+    unsigned cache_level;
+    /* per node: positions in node->procs in the order they are ranked */
+    int **order;
+    int *norder;
+} rank_by_caddy_t;
+
+/* cycle across the objects on the node, taking the first unranked
+ * proc on each one, until a pass over all the objects finds nothing
+ * more. This only depends on the procs on the node, so the nodes can
+ * be ordered concurrently and the ranks assigned afterwards */
+static int order_node(prte_node_t *node, int idx, void *cbdata)
+{
+    rank_by_caddy_t *cd = (rank_by_caddy_t *) cbdata;
+    hwloc_obj_t *objs, locale;
+    prte_proc_t *proc;
+    int num_objs, i, j, n = 0, rc = PRTE_SUCCESS;
+    int *order = NULL;
+    bool *taken = NULL, noassign;
+
+    /* get the number of objects - only consider those we can actually use */
+    num_objs = prte_hwloc_base_get_nbobjs_by_type(node->topology->topo, cd->target,
+                                                  cd->cache_level);
+    prte_output_verbose(5, prte_rmaps_base_framework.framework_output,
+                        "mca:rmaps:rank_by: found %d objects on node %s with %d procs", num_objs,
+                        node->name, (int) node->num_procs);
+    if (0 == num_objs) {
+        return PRTE_ERR_NOT_SUPPORTED;
+    }
+    /* collect all the objects */
+    objs = (hwloc_obj_t *) malloc(num_objs * sizeof(hwloc_obj_t));
+    if (0 < node->procs->size) {
+        order = (int *) malloc(node->procs->size * sizeof(int));
+        taken = (bool *) calloc(node->procs->size, sizeof(bool));
+    }
+    if (NULL == objs || (0 < node->procs->size && (NULL == order || NULL == taken))) {
+        rc = PRTE_ERR_OUT_OF_RESOURCE;
+        goto done;
+    }
+    for (i = 0; i < num_objs; i++) {
+        objs[i] = prte_hwloc_base_get_obj_by_type(node->topology->topo, cd->target,
+                                                  cd->cache_level, i);
+    }
+
+    do {
+        noassign = true;
+        for (i = 0; i < num_objs && NULL != objs[i]; i++) {
+            /* find the first unassigned proc that includes this object */
+            for (j = 0; j < node->procs->size; j++) {
+                if (taken[j]
+                    || NULL
+                           == (proc = (prte_proc_t *) prte_pointer_array_get_item(node->procs,
+                                                                                  j))) {
+                    continue;
+                }
+                /* ignore procs from other jobs, procs that are already
+                 * ranked, and procs from other apps - we will get to them */
+                if (!PMIX_CHECK_NSPACE(proc->name.nspace, cd->jdata->nspace)
+                    || PMIX_RANK_INVALID != proc->name.rank || proc->app_idx != cd->app->idx) {
+                    continue;
+                }
+                /* protect against bozo case */
+                locale = NULL;
+                if (!prte_get_attribute(&proc->attributes, PRTE_PROC_HWLOC_LOCALE,
+                                        (void **) &locale, PMIX_POINTER)
+                    || NULL == locale) {
+                    /* all mappers are _required_ to set the locale where the proc
+                     * has been mapped - it is therefore an error for this attribute
+                     * not to be set. Likewise, only a programming error could allow
+                     * the attribute to be set to a NULL value - however, we add that
+                     * conditional here to silence any compiler warnings */
+                    rc = PRTE_ERROR;
+                    goto done;
+                }
+                /* ignore procs not on this object */
+                if (!hwloc_bitmap_intersects(objs[i]->cpuset, locale->cpuset)) {
+                    continue;
+                }
+                taken[j] = true;
+                order[n++] = j;
+                noassign = false;
+                /* move to next object */
+                break;
+            }
+        }
+    } while (!noassign);
+
+done:
+    free(objs);
+    if (NULL != taken) {
+        free(taken);
+    }
+    if (PRTE_SUCCESS != rc) {
+        if (NULL != order) {
+            free(order);
+        }
+        return rc;
+    }
+    cd->order[idx] = order;
+    cd->norder[idx] = n;
+    return PRTE_SUCCESS;
+}
+
 static int rank_by(prte_job_t *jdata, hwloc_obj_type_t target, unsigned cache_level)
 {
     prte_app_context_t *app;
-    hwloc_obj_t obj;
-    int num_objs, i, j, m, n, rc, nn;
+    int i, m, n, rc, nn, nnodes, x;
     pmix_rank_t num_ranked = 0;
-    prte_node_t *node;
+    prte_node_t *node, **nodes;
     prte_proc_t *proc, *pptr;
     pmix_rank_t vpid;
     int cnt;
-    prte_pointer_array_t objs;
-    hwloc_obj_t locale;
     prte_app_idx_t napp;
-    bool noassign;
+    rank_by_caddy_t cd;
 
     if (PRTE_RANKING_SPAN & PRTE_GET_RANKING_DIRECTIVE(jdata->map->ranking)) {
         return rank_span(jdata, target, cache_level);
@@ -373,163 +476,109 @@ static int rank_by(prte_job_t *jdata, hwloc_obj_type_t target, unsigned cache_le
      *     0 2       1 3         8 10      9 11
      *     4 6       5 7        12 14     13 15
      */
+    nodes = (prte_node_t **) malloc(((0 < jdata->map->nodes->size) ? jdata->map->nodes->size : 1)
+                                    * sizeof(prte_node_t *));
+    if (NULL == nodes) {
+        PRTE_ERROR_LOG(PRTE_ERR_OUT_OF_RESOURCE);
+        return PRTE_ERR_OUT_OF_RESOURCE;
+    }
+    for (m = 0, nn = 0; nn < jdata->map->num_nodes && m < jdata->map->nodes->size; m++) {
+        if (NULL != (node = (prte_node_t *) prte_pointer_array_get_item(jdata->map->nodes, m))) {
+            nodes[nn++] = node;
+        }
+    }
+    nnodes = nn;
+    cd.jdata = jdata;
+    cd.target = target;
+    cd.cache_level = cache_level;
+    cd.order = (int **) calloc((0 < nnodes) ? nnodes : 1, sizeof(int *));
+    cd.norder = (int *) calloc((0 < nnodes) ? nnodes : 1, sizeof(int));
+    if (NULL == cd.order || NULL == cd.norder) {
+        rc = PRTE_ERR_OUT_OF_RESOURCE;
+        PRTE_ERROR_LOG(rc);
+        goto cleanup;
+    }
+
     vpid = 0;
     for (n = 0, napp = 0; napp < jdata->num_apps && n < jdata->apps->size; n++) {
         if (NULL == (app = (prte_app_context_t *) prte_pointer_array_get_item(jdata->apps, n))) {
             continue;
         }
         napp++;
-        /* setup the pointer array */
-        PRTE_CONSTRUCT(&objs, prte_pointer_array_t);
-        prte_pointer_array_init(&objs, 2, INT_MAX, 2);
-
-        cnt = 0;
-        for (m = 0, nn = 0; nn < jdata->map->num_nodes && m < jdata->map->nodes->size; m++) {
-            if (NULL
-                == (node = (prte_node_t *) prte_pointer_array_get_item(jdata->map->nodes, m))) {
-                continue;
-            }
-            nn++;
 
-            /* get the number of objects - only consider those we can actually use */
-            num_objs = prte_hwloc_base_get_nbobjs_by_type(node->topology->topo, target,
-                                                          cache_level);
-            prte_output_verbose(5, prte_rmaps_base_framework.framework_output,
-                                "mca:rmaps:rank_by: found %d objects on node %s with %d procs",
-                                num_objs, node->name, (int) node->num_procs);
-            if (0 == num_objs) {
-                PRTE_DESTRUCT(&objs);
-                return PRTE_ERR_NOT_SUPPORTED;
-            }
-            /* collect all the objects */
-            for (i = 0; i < num_objs; i++) {
-                obj = prte_hwloc_base_get_obj_by_type(node->topology->topo, target, cache_level, i);
-                prte_pointer_array_set_item(&objs, i, obj);
+        /* work out the order in which each node's procs get ranked */
+        cd.app = app;
+        rc = prte_rmaps_base_foreach_node(nodes, nnodes, order_node, &cd);
+        if (PRTE_SUCCESS != rc) {
+            if (PRTE_ERR_NOT_SUPPORTED != rc) {
+                PRTE_ERROR_LOG(rc);
             }
+            goto cleanup;
+        }
 
-            /* cycle across the objects, assigning a proc to each one,
-             * until all procs have been assigned - unfortunately, since
-             * more than this job may be mapped onto a node, the number
-             * of procs on the node can't be used to tell us when we
-             * are done. Instead, we have to just keep going until all
-             * procs are ranked - which means we have to make one extra
-             * pass thru the loop. In addition, if we pass thru the entire
-             * loop without assigning anything then we are done
-             *
-             * Perhaps someday someone will come up with a more efficient
-             * algorithm, but this works for now.
-             */
-            while (cnt < app->num_procs) {
-                noassign = true;
-                for (i = 0; i < num_objs && cnt < app->num_procs; i++) {
-                    /* get the next object */
-                    obj = (hwloc_obj_t) prte_pointer_array_get_item(&objs, i);
-                    if (NULL == obj) {
-                        break;
-                    }
-                    /* scan across the procs and find the first unassigned one that includes this
-                     * object */
-                    for (j = 0; j < node->procs->size && cnt < app->num_procs; j++) {
-                        if (NULL
-                            == (proc = (prte_proc_t *) prte_pointer_array_get_item(node->procs,
-                                                                                   j))) {
-                            continue;
-                        }
-                        /* ignore procs from other jobs */
-                        if (!PMIX_CHECK_NSPACE(proc->name.nspace, jdata->nspace)) {
-                            prte_output_verbose(5, prte_rmaps_base_framework.framework_output,
-                                                "mca:rmaps:rank_by skipping proc %s - from another "
-                                                "job, num_ranked %d",
-                                                PRTE_NAME_PRINT(&proc->name), num_ranked);
-                            continue;
-                        }
-                        /* ignore procs that are already ranked */
-                        if (PMIX_RANK_INVALID != proc->name.rank) {
-                            prte_output_verbose(5, prte_rmaps_base_framework.framework_output,
-                                                "mca:rmaps:rank_by skipping proc %s - already "
-                                                "ranked, num_ranked %d",
-                                                PRTE_NAME_PRINT(&proc->name), num_ranked);
-                            continue;
-                        }
-                        /* ignore procs from other apps - we will get to them */
-                        if (proc->app_idx != app->idx) {
-                            prte_output_verbose(5, prte_rmaps_base_framework.framework_output,
-                                                "mca:rmaps:rank_by skipping proc %s - from another "
-                                                "app, num_ranked %d",
-                                                PRTE_NAME_PRINT(&proc->name), num_ranked);
-                            continue;
-                        }
-                        /* tie proc to its job */
-                        proc->job = jdata;
-                        /* protect against bozo case */
-                        locale = NULL;
-                        if (!prte_get_attribute(&proc->attributes, PRTE_PROC_HWLOC_LOCALE,
-                                                (void **) &locale, PMIX_POINTER)
-                            || NULL == locale) {
-                            /* all mappers are _required_ to set the locale where the proc
-                             * has been mapped - it is therefore an error for this attribute
-                             * not to be set. Likewise, only a programming error could allow
-                             * the attribute to be set to a NULL value - however, we add that
-                             * conditional here to silence any compiler warnings */
-                            PRTE_ERROR_LOG(PRTE_ERROR);
-                            return PRTE_ERROR;
-                        }
-                        /* ignore procs not on this object */
-                        if (!hwloc_bitmap_intersects(obj->cpuset, locale->cpuset)) {
-                            prte_output_verbose(
-                                5, prte_rmaps_base_framework.framework_output,
-                                "mca:rmaps:rank_by: proc at position %d is not on object %d", j, i);
-                            continue;
-                        }
-                        /* assign the vpid */
-                        proc->name.rank = vpid;
-                        proc->rank = vpid++;
-                        if (0 == cnt) {
-                            app->first_rank = proc->name.rank;
-                        }
-                        cnt++;
-                        noassign = false;
-                        prte_output_verbose(5, prte_rmaps_base_framework.framework_output,
-                                            "mca:rmaps:rank_by: proc in position %d is on object "
-                                            "%d assigned rank %s",
-                                            j, i, PRTE_VPID_PRINT(proc->name.rank));
-                        /* insert the proc into the jdata array */
-                        if (NULL
-                            != (pptr = (prte_proc_t *)
-                                    prte_pointer_array_get_item(jdata->procs, proc->name.rank))) {
-                            PRTE_RELEASE(pptr);
-                        }
-                        PRTE_RETAIN(proc);
-                        if (PRTE_SUCCESS
-                            != (rc = prte_pointer_array_set_item(jdata->procs, proc->name.rank,
-                                                                 proc))) {
-                            PRTE_ERROR_LOG(rc);
-                            PRTE_DESTRUCT(&objs);
-                            return rc;
-                        }
-                        num_ranked++;
-                        /* track where the highest vpid landed - this is our
-                         * new bookmark
-                         */
-                        jdata->bookmark = node;
-                        /* move to next object */
-                        break;
-                    }
+        /* now assign the vpids in node order */
+        cnt = 0;
+        for (i = 0; i < nnodes; i++) {
+            node = nodes[i];
+            for (x = 0; x < cd.norder[i] && cnt < app->num_procs; x++) {
+                proc = (prte_proc_t *) prte_pointer_array_get_item(node->procs, cd.order[i][x]);
+                /* tie proc to its job */
+                proc->job = jdata;
+                /* assign the vpid */
+                proc->name.rank = vpid;
+                proc->rank = vpid++;
+                if (0 == cnt) {
+                    app->first_rank = proc->name.rank;
+                }
+                cnt++;
+                prte_output_verbose(5, prte_rmaps_base_framework.framework_output,
+                                    "mca:rmaps:rank_by: proc in position %d on node %s "
+                                    "assigned rank %s",
+                                    cd.order[i][x], node->name, PRTE_VPID_PRINT(proc->name.rank));
+                /* insert the proc into the jdata array */
+                if (NULL
+                    != (pptr = (prte_proc_t *) prte_pointer_array_get_item(jdata->procs,
+                                                                           proc->name.rank))) {
+                    PRTE_RELEASE(pptr);
                 }
-                if (noassign) {
-                    break;
+                PRTE_RETAIN(proc);
+                if (PRTE_SUCCESS
+                    != (rc = prte_pointer_array_set_item(jdata->procs, proc->name.rank, proc))) {
+                    PRTE_ERROR_LOG(rc);
+                    goto cleanup;
                 }
+                num_ranked++;
+                /* track where the highest vpid landed - this is our
+                 * new bookmark
+                 */
+                jdata->bookmark = node;
             }
+            free(cd.order[i]);
+            cd.order[i] = NULL;
         }
-        /* cleanup */
-        PRTE_DESTRUCT(&objs);
 
         /* Are all the procs ranked? we don't want to crash on INVALID ranks */
         if (cnt < app->num_procs) {
-            return PRTE_ERR_FAILED_TO_MAP;
+            rc = PRTE_ERR_FAILED_TO_MAP;
+            goto cleanup;
         }
     }
-    return PRTE_SUCCESS;
+    rc = PRTE_SUCCESS;
+
+cleanup:
+    if (NULL != cd.order) {
+        for (i = 0; i < nnodes; i++) {
+            if (NULL != cd.order[i]) {
+                free(cd.order[i]);
+            }
+        }
+        free(cd.order);
+    }
+    if (NULL != cd.norder) {
+        free(cd.norder);
+    }
+    free(nodes);
+    return rc;
 }
 
 int prte_rmaps_base_compute_vpids(prte_job_t *jdata)
@@ -49,12 +49,23 @@ PRTE_EXPORT int prte_rmaps_base_get_target_nodes(prte_list_t *node_list, int32_t
                                                  prte_mapping_policy_t policy, bool initial_map,
                                                  bool silent);
 
+PRTE_EXPORT int prte_rmaps_base_get_free_nodes(prte_list_t *node_list, int32_t *total_num_slots,
+                                               prte_app_context_t *app,
+                                               prte_mapping_policy_t policy, bool initial_map);
+
 PRTE_EXPORT prte_proc_t *prte_rmaps_base_setup_proc(prte_job_t *jdata, prte_node_t *node,
                                                     prte_app_idx_t idx);
 
 PRTE_EXPORT prte_node_t *prte_rmaps_base_get_starting_point(prte_list_t *node_list,
                                                             prte_job_t *jdata);
 
+/* run fn on each node, spreading the nodes across rmaps_base_threads
+ * threads - fn must only modify its own node and that node's procs.
+ * Returns the error from the lowest-numbered node that failed */
+typedef int (*prte_rmaps_base_node_fn_t)(prte_node_t *node, int idx, void *cbdata);
+PRTE_EXPORT int prte_rmaps_base_foreach_node(prte_node_t **nodes, int nnodes,
+                                             prte_rmaps_base_node_fn_t fn, void *cbdata);
+
 PRTE_EXPORT int prte_rmaps_base_compute_vpids(prte_job_t *jdata);
 
 PRTE_EXPORT int prte_rmaps_base_compute_local_ranks(prte_job_t *jdata);
@@ -343,6 +343,8 @@ static int ppr_mapper(prte_job_t *jdata)
                 } else {
                     node->slots_inuse = node->slots;
                 }
+                /* pruning may have released slots */
+                prte_rmaps_base_free_index_mark(node);
 
                 /* if no-oversubscribe was specified, check to see if
                  * we have violated the total slot specification - regardless,
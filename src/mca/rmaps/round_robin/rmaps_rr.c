@@ -117,11 +117,16 @@ static int prte_rmaps_rr_map(prte_job_t *jdata)
 
         /* for each app_context, we have to get the list of nodes that it can
          * use since that can now be modified with a hostfile and/or -host
-         * option
+         * option. If we fill nodes in order, see if the free-slot index can
+         * give us just the nodes we need
          */
-        if (PRTE_SUCCESS
-            != (rc = prte_rmaps_base_get_target_nodes(&node_list, &num_slots, app,
-                                                      jdata->map->mapping, initial_map, false))) {
+        rc = prte_rmaps_base_get_free_nodes(&node_list, &num_slots, app, jdata->map->mapping,
+                                            initial_map);
+        if (PRTE_ERR_TAKE_NEXT_OPTION == rc) {
+            rc = prte_rmaps_base_get_target_nodes(&node_list, &num_slots, app,
+                                                  jdata->map->mapping, initial_map, false);
+        }
+        if (PRTE_SUCCESS != rc) {
             PRTE_ERROR_LOG(rc);
             goto error;
         }
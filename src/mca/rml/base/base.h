@@ -65,11 +65,21 @@ PRTE_EXPORT int prte_rml_base_select(void);
  *  globals that might be needed
  */
 
+/* the posted recvs and unmatched messages for a single tag */
+typedef struct {
+    prte_object_t super;
+    prte_list_t recvs;     // posted recvs, in the order they were posted
+    prte_list_t unmatched; // msgs that arrived before a matching recv was posted
+    uint64_t ndelivered;   // msgs delivered to a recv on this tag
+    uint64_t nunmatched;   // msgs that had to wait for a recv to be posted
+} prte_rml_tag_bin_t;
+PRTE_EXPORT PRTE_CLASS_DECLARATION(prte_rml_tag_bin_t);
+
 /* a global struct containing framework-level values */
 typedef struct {
-    prte_list_t posted_recvs;
-    prte_list_t unmatched_msgs;
+    prte_pointer_array_t tags; // prte_rml_tag_bin_t, indexed by tag
     int max_retries;
+    bool tag_stats;
 } prte_rml_base_t;
 PRTE_EXPORT extern prte_rml_base_t prte_rml_base;
 
@@ -116,6 +126,7 @@ typedef struct {
     prte_list_item_t super;
     bool buffer_data;
     pmix_proc_t peer;
+    bool any_peer; // peer is a full wildcard, so every sender matches
     prte_rml_tag_t tag;
     bool persistent;
     prte_rml_buffer_callback_fn_t cbfunc;
@@ -18,6 +18,7 @@
 
 #include "prte_config.h"
 
+#include <limits.h>
 #include <string.h>
 
 #include "src/mca/base/prte_mca_base_component_repository.h"
@@ -51,21 +52,47 @@ static int prte_rml_base_register(prte_mca_base_register_flag_t flags)
                                NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
                                PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_rml_base.max_retries);
 
+    prte_rml_base.tag_stats = false;
+    prte_mca_base_var_register("prte", "rml", "base", "tag_stats",
+                               "Report the number of messages received on each tag at finalize",
+                               PRTE_MCA_BASE_VAR_TYPE_BOOL, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE,
+                               PRTE_INFO_LVL_9, PRTE_MCA_BASE_VAR_SCOPE_READONLY,
+                               &prte_rml_base.tag_stats);
+
     return PRTE_SUCCESS;
 }
 
 static int prte_rml_base_close(void)
 {
-    PRTE_LIST_DESTRUCT(&prte_rml_base.posted_recvs);
+    prte_rml_tag_bin_t *bin;
+    int n;
+
+    for (n = 0; n < prte_rml_base.tags.size; n++) {
+        bin = (prte_rml_tag_bin_t *) prte_pointer_array_get_item(&prte_rml_base.tags, n);
+        if (NULL == bin) {
+            continue;
+        }
+        if (prte_rml_base.tag_stats) {
+            prte_output(0,
+                        "%s rml:base tag %d: %" PRIu64 " msgs delivered, %" PRIu64
+                        " waited for a recv, %d recvs posted, %d msgs unmatched",
+                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), n, bin->ndelivered, bin->nunmatched,
+                        (int) prte_list_get_size(&bin->recvs),
+                        (int) prte_list_get_size(&bin->unmatched));
+        }
+        PRTE_RELEASE(bin);
+    }
+    PRTE_DESTRUCT(&prte_rml_base.tags);
     return prte_mca_base_framework_components_close(&prte_rml_base_framework, NULL);
 }
 
 static int prte_rml_base_open(prte_mca_base_open_flag_t flags)
 {
     /* Initialize globals */
-    /* construct object for holding the active plugin modules */
-    PRTE_CONSTRUCT(&prte_rml_base.posted_recvs, prte_list_t);
-    PRTE_CONSTRUCT(&prte_rml_base.unmatched_msgs, prte_list_t);
+    /* construct the per-tag recv bins - the defined tags are dense
+     * and small, so just index them directly */
+    PRTE_CONSTRUCT(&prte_rml_base.tags, prte_pointer_array_t);
+    prte_pointer_array_init(&prte_rml_base.tags, PRTE_RML_TAG_MAX, INT_MAX, 16);
 
     /* Open up all available components */
     return prte_mca_base_framework_components_open(&prte_rml_base_framework, flags);
@@ -200,10 +227,25 @@ PRTE_CLASS_INSTANCE(prte_rml_recv_cb_t, prte_object_t, rcv_cons, rcv_des);
 
 static void prcv_cons(prte_rml_posted_recv_t *ptr)
 {
+    ptr->any_peer = false;
     ptr->cbdata = NULL;
 }
 PRTE_CLASS_INSTANCE(prte_rml_posted_recv_t, prte_list_item_t, prcv_cons, NULL);
 
+static void tbcon(prte_rml_tag_bin_t *p)
+{
+    PRTE_CONSTRUCT(&p->recvs, prte_list_t);
+    PRTE_CONSTRUCT(&p->unmatched, prte_list_t);
+    p->ndelivered = 0;
+    p->nunmatched = 0;
+}
+static void tbdes(prte_rml_tag_bin_t *p)
+{
+    PRTE_LIST_DESTRUCT(&p->recvs);
+    PRTE_LIST_DESTRUCT(&p->unmatched);
+}
+PRTE_CLASS_INSTANCE(prte_rml_tag_bin_t, prte_object_t, tbcon, tbdes);
+
 static void prq_cons(prte_rml_recv_request_t *ptr)
 {
     ptr->cancel = false;
@@ -32,6 +32,7 @@
  */
 #include "prte_config.h"
 
+#include <limits.h>
 #include <string.h>
 
 #include "constants.h"
@@ -46,17 +47,47 @@
 #include "src/threads/threads.h"
 #include "src/util/name_fns.h"
 #include "src/util/nidmap.h"
+#include "src/util/trace.h"
 
 #include "src/mca/rml/base/base.h"
 #include "src/mca/rml/base/rml_contact.h"
 #include "src/mca/rml/rml.h"
 
-static void msg_match_recv(prte_rml_posted_recv_t *rcv, bool get_all);
+static void msg_match_recv(prte_rml_tag_bin_t *bin, prte_rml_posted_recv_t *rcv, bool get_all);
+
+/* get the recv bin for the given tag, creating it if requested */
+static prte_rml_tag_bin_t *get_bin(prte_rml_tag_t tag, bool create)
+{
+    prte_rml_tag_bin_t *bin;
+
+    if (INT_MAX < tag) {
+        return NULL;
+    }
+    bin = (prte_rml_tag_bin_t *) prte_pointer_array_get_item(&prte_rml_base.tags, tag);
+    if (NULL == bin && create) {
+        bin = PRTE_NEW(prte_rml_tag_bin_t);
+        if (0 > prte_pointer_array_set_item(&prte_rml_base.tags, tag, bin)) {
+            PRTE_RELEASE(bin);
+            return NULL;
+        }
+    }
+    return bin;
+}
+
+static inline bool recv_matches(prte_rml_posted_recv_t *post, pmix_proc_t *sender)
+{
+    /* since names could include wildcards, must use
+     * the more generalized comparison function - but
+     * most recvs are posted for any peer, so avoid
+     * that when we can */
+    return post->any_peer || PMIX_CHECK_PROCID(sender, &post->peer);
+}
 
 void prte_rml_base_post_recv(int sd, short args, void *cbdata)
 {
     prte_rml_recv_request_t *req = (prte_rml_recv_request_t *) cbdata;
     prte_rml_posted_recv_t *post, *recv;
+    prte_rml_tag_bin_t *bin;
 
     PRTE_ACQUIRE_OBJECT(req);
 
@@ -75,15 +106,19 @@ void prte_rml_base_post_recv(int sd, short args, void *cbdata)
      * and remove it from our list
      */
     if (req->cancel) {
-        PRTE_LIST_FOREACH(recv, &prte_rml_base.posted_recvs, prte_rml_posted_recv_t)
+        if (NULL == (bin = get_bin(post->tag, false))) {
+            PRTE_RELEASE(req);
+            return;
+        }
+        PRTE_LIST_FOREACH(recv, &bin->recvs, prte_rml_posted_recv_t)
         {
-            if (PMIX_CHECK_PROCID(&post->peer, &recv->peer) && post->tag == recv->tag) {
+            if (PMIX_CHECK_PROCID(&post->peer, &recv->peer)) {
                 prte_output_verbose(5, prte_rml_base_framework.framework_output,
                                     "%s canceling recv %d for peer %s",
                                     PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), post->tag,
                                     PRTE_NAME_PRINT(&recv->peer));
                 /* got a match - remove it */
-                prte_list_remove_item(&prte_rml_base.posted_recvs, &recv->super);
+                prte_list_remove_item(&bin->recvs, &recv->super);
                 PRTE_RELEASE(recv);
                 break;
             }
@@ -92,10 +127,17 @@ void prte_rml_base_post_recv(int sd, short args, void *cbdata)
         return;
     }
 
+    if (NULL == (bin = get_bin(post->tag, true))) {
+        prte_output(0, "%s CANNOT POST RML RECV ON TAG %u", PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                    post->tag);
+        PRTE_RELEASE(req);
+        return;
+    }
+
     /* bozo check - cannot have two receives for the same peer/tag combination */
-    PRTE_LIST_FOREACH(recv, &prte_rml_base.posted_recvs, prte_rml_posted_recv_t)
+    PRTE_LIST_FOREACH(recv, &bin->recvs, prte_rml_posted_recv_t)
     {
-        if (PMIX_CHECK_PROCID(&post->peer, &recv->peer) && post->tag == recv->tag) {
+        if (PMIX_CHECK_PROCID(&post->peer, &recv->peer)) {
             prte_output(0, "%s TWO RECEIVES WITH SAME PEER %s AND TAG %d - ABORTING",
                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_NAME_PRINT(&post->peer),
                         post->tag);
@@ -108,17 +150,18 @@ void prte_rml_base_post_recv(int sd, short args, void *cbdata)
                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                         (post->persistent) ? "persistent" : "non-persistent", post->tag,
                         PRTE_NAME_PRINT(&post->peer));
+    post->any_peer = (PMIX_RANK_WILDCARD == post->peer.rank && '\0' == post->peer.nspace[0]);
     /* add it to the list of recvs */
-    prte_list_append(&prte_rml_base.posted_recvs, &post->super);
+    prte_list_append(&bin->recvs, &post->super);
     req->post = NULL;
     /* handle any messages that may have already arrived for this recv */
-    msg_match_recv(post, post->persistent);
+    msg_match_recv(bin, post, post->persistent);
 
     /* cleanup */
     PRTE_RELEASE(req);
 }
 
-static void msg_match_recv(prte_rml_posted_recv_t *rcv, bool get_all)
+static void msg_match_recv(prte_rml_tag_bin_t *bin, prte_rml_posted_recv_t *rcv, bool get_all)
 {
     prte_list_item_t *item, *next;
     prte_rml_recv_t *msg;
@@ -127,8 +170,8 @@ static void msg_match_recv(prte_rml_posted_recv_t *rcv, bool get_all)
      * see if any matches this spec - if so, push the first
      * into the recvd msg queue and look no further
      */
-    item = prte_list_get_first(&prte_rml_base.unmatched_msgs);
-    while (item != prte_list_get_end(&prte_rml_base.unmatched_msgs)) {
+    item = prte_list_get_first(&bin->unmatched);
+    while (item != prte_list_get_end(&bin->unmatched)) {
         next = prte_list_get_next(item);
         msg = (prte_rml_recv_t *) item;
         prte_output_verbose(5, prte_rml_base_framework.framework_output,
@@ -136,12 +179,9 @@ static void msg_match_recv(prte_rml_posted_recv_t *rcv, bool get_all)
                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_NAME_PRINT(&rcv->peer),
                             PRTE_NAME_PRINT(&msg->sender));
 
-        /* since names could include wildcards, must use
-         * the more generalized comparison function
-         */
-        if (PMIX_CHECK_PROCID(&msg->sender, &rcv->peer) && msg->tag == rcv->tag) {
+        if (recv_matches(rcv, &msg->sender)) {
             PRTE_RML_ACTIVATE_MESSAGE(msg);
-            prte_list_remove_item(&prte_rml_base.unmatched_msgs, item);
+            prte_list_remove_item(&bin->unmatched, item);
             if (!get_all) {
                 break;
             }
@@ -154,12 +194,14 @@ void prte_rml_base_process_msg(int fd, short flags, void *cbdata)
 {
     prte_rml_recv_t *msg = (prte_rml_recv_t *) cbdata;
     prte_rml_posted_recv_t *post;
+    prte_rml_tag_bin_t *bin;
 
     PRTE_ACQUIRE_OBJECT(msg);
 
     PRTE_OUTPUT_VERBOSE(
         (5, prte_rml_base_framework.framework_output, "%s message received from %s for tag %d",
          PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_NAME_PRINT(&msg->sender), msg->tag));
+    PRTE_TRACE(PRTE_TRACE_RML_RECV, msg->tag, msg->sender.rank);
 
     /* if this message is just to warmup the connection, then drop it */
     if (PRTE_RML_TAG_WARMUP_CONNECTION == msg->tag) {
@@ -189,13 +231,18 @@ void prte_rml_base_process_msg(int fd, short flags, void *cbdata)
         }
     }
 
+    if (NULL == (bin = get_bin(msg->tag, true))) {
+        prte_output(0, "%s CANNOT HOLD RML MSG FROM %s ON TAG %u - DROPPING IT",
+                    PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_NAME_PRINT(&msg->sender), msg->tag);
+        PRTE_RELEASE(msg);
+        return;
+    }
+
     /* see if we have a waiting recv for this message */
-    PRTE_LIST_FOREACH(post, &prte_rml_base.posted_recvs, prte_rml_posted_recv_t)
+    PRTE_LIST_FOREACH(post, &bin->recvs, prte_rml_posted_recv_t)
     {
-        /* since names could include wildcards, must use
-         * the more generalized comparison function
-         */
-        if (PMIX_CHECK_PROCID(&msg->sender, &post->peer) && msg->tag == post->tag) {
+        if (recv_matches(post, &msg->sender)) {
+            ++bin->ndelivered;
             /* deliver the data to this location */
             post->cbfunc(PRTE_SUCCESS, &msg->sender, &msg->dbuf, msg->tag, post->cbdata);
             /* the user must have unloaded the buffer if they wanted
@@ -213,7 +260,7 @@ void prte_rml_base_process_msg(int fd, short flags, void *cbdata)
                                  PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), post->tag));
             /* if the recv is non-persistent, remove it */
             if (!post->persistent) {
-                prte_list_remove_item(&prte_rml_base.posted_recvs, &post->super);
+                prte_list_remove_item(&bin->recvs, &post->super);
                 /*PRTE_OUTPUT_VERBOSE((5, prte_rml_base_framework.framework_output,
                                      "%s non persistent recv %p remove success releasing now",
                                      PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
@@ -230,5 +277,6 @@ void prte_rml_base_process_msg(int fd, short flags, void *cbdata)
         (5, prte_rml_base_framework.framework_output,
          "%s message received bytes from %s for tag %d Not Matched adding to unmatched msgs",
          PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_NAME_PRINT(&msg->sender), msg->tag));
-    prte_list_append(&prte_rml_base.unmatched_msgs, &msg->super);
+    ++bin->nunmatched;
+    prte_list_append(&bin->unmatched, &msg->super);
 }
@@ -33,6 +33,7 @@
 #include "src/runtime/prte_globals.h"
 #include "src/threads/threads.h"
 #include "src/util/name_fns.h"
+#include "src/util/trace.h"
 
 #include "rml_oob.h"
 #include "src/mca/rml/base/base.h"
@@ -71,6 +72,7 @@ int prte_rml_oob_send_buffer_nb(pmix_proc_t *peer, pmix_data_buffer_t *buffer, p
     PRTE_OUTPUT_VERBOSE(
         (1, prte_rml_base_framework.framework_output, "%s rml_send_buffer to peer %s at tag %d",
          PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), (NULL == peer) ? "NULL" : PRTE_NAME_PRINT(peer), tag));
+    PRTE_TRACE(PRTE_TRACE_RML_SEND, tag, (NULL == peer) ? PMIX_RANK_INVALID : peer->rank);
 
     if (PRTE_RML_TAG_INVALID == tag) {
         /* cannot send to an invalid tag */
@@ -36,6 +36,7 @@
 #include "src/mca/grpcomm/grpcomm.h"
 #include "src/mca/iof/base/base.h"
 #include "src/mca/plm/plm.h"
+#include "src/mca/rmaps/base/base.h"
 #include "src/mca/rmaps/rmaps_types.h"
 #include "src/mca/rml/rml.h"
 #include "src/mca/routed/routed.h"
@@ -46,65 +47,224 @@
 #include "src/threads/threads.h"
 #include "src/util/session_dir.h"
 #include "src/util/show_help.h"
+#include "src/util/trace.h"
 
 #include "src/mca/state/base/base.h"
 #include "src/mca/state/base/state_private.h"
 
-void prte_state_base_activate_job_state(prte_job_t *jdata, prte_job_state_t state)
+/* Direct-indexed dispatch tables that mirror the prte_job_states and
+ * prte_proc_states lists. The lists remain the authoritative record of
+ * the state machine (and are what the components construct and tear
+ * down), while the tables let activation find the handler for a state
+ * without walking the list. Each table entry holds its own reference
+ * to the prte_state_t so it remains valid until the table is reset.
+ * States that fall outside the table (e.g., dynamically defined ones)
+ * are still located by searching the list. */
+#define PRTE_STATE_DISPATCH_MAX 256
+
+typedef struct {
+    prte_state_t *states[PRTE_STATE_DISPATCH_MAX];
+    prte_state_t *any;
+    prte_state_t *error;
+} prte_state_dispatch_t;
+
+static prte_state_dispatch_t job_dispatch;
+static prte_state_dispatch_t proc_dispatch;
+
+static void dispatch_store(prte_state_t **slot, prte_state_t *st)
+{
+    if (NULL != st) {
+        PRTE_RETAIN(st);
+    }
+    if (NULL != *slot) {
+        PRTE_RELEASE(*slot);
+    }
+    *slot = st;
+}
+
+static void dispatch_set(prte_state_dispatch_t *table, int state, int anystate, int errstate,
+                         prte_state_t *st)
+{
+    if (anystate == state) {
+        dispatch_store(&table->any, st);
+        return;
+    }
+    if (errstate == state) {
+        dispatch_store(&table->error, st);
+    }
+    if (0 <= state && state < PRTE_STATE_DISPATCH_MAX) {
+        dispatch_store(&table->states[state], st);
+    }
+}
+
+static void dispatch_clear(prte_state_dispatch_t *table)
+{
+    int n;
+
+    for (n = 0; n < PRTE_STATE_DISPATCH_MAX; n++) {
+        dispatch_store(&table->states[n], NULL);
+    }
+    dispatch_store(&table->any, NULL);
+    dispatch_store(&table->error, NULL);
+}
+
+/* find the handler for the given state, falling back to the ERROR
+ * or ANY handlers as documented in state.h */
+static prte_state_t *job_state_lookup(prte_job_state_t state, bool *fallback)
 {
-    prte_list_item_t *itm, *any = NULL, *error = NULL;
     prte_state_t *s;
-    prte_state_caddy_t *caddy;
 
-    for (itm = prte_list_get_first(&prte_job_states); itm != prte_list_get_end(&prte_job_states);
-         itm = prte_list_get_next(itm)) {
-        s = (prte_state_t *) itm;
-        if (s->job_state == PRTE_JOB_STATE_ANY) {
-            /* save this place */
-            any = itm;
-        }
-        if (s->job_state == PRTE_JOB_STATE_ERROR) {
-            error = itm;
+    *fallback = false;
+    if (0 <= state && state < PRTE_STATE_DISPATCH_MAX) {
+        if (NULL != (s = job_dispatch.states[state])) {
+            return s;
         }
-        if (s->job_state == state) {
-            PRTE_REACHING_JOB_STATE(jdata, state, s->priority);
-            if (NULL == s->cbfunc) {
-                PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
-                                     "%s NULL CBFUNC FOR JOB %s STATE %s",
-                                     PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                     (NULL == jdata) ? "ALL" : PRTE_JOBID_PRINT(jdata->nspace),
-                                     prte_job_state_to_str(state)));
-                return;
-            }
-            caddy = PRTE_NEW(prte_state_caddy_t);
-            if (NULL != jdata) {
-                caddy->jdata = jdata;
-                caddy->job_state = state;
-                PRTE_RETAIN(jdata);
+    } else if (PRTE_JOB_STATE_ANY == state) {
+        return job_dispatch.any;
+    } else {
+        PRTE_LIST_FOREACH(s, &prte_job_states, prte_state_t)
+        {
+            if (s->job_state == state) {
+                return s;
             }
-            PRTE_THREADSHIFT(caddy, prte_event_base, s->cbfunc, s->priority);
-            return;
         }
     }
-    /* if we get here, then the state wasn't found, so execute
-     * the default handler if it is defined
-     */
-    if (PRTE_JOB_STATE_ERROR < state && NULL != error) {
-        s = (prte_state_t *) error;
-    } else if (NULL != any) {
-        s = (prte_state_t *) any;
+    *fallback = true;
+    if (PRTE_JOB_STATE_ERROR < state && NULL != job_dispatch.error) {
+        return job_dispatch.error;
+    }
+    return job_dispatch.any;
+}
+
+static prte_state_t *proc_state_lookup(prte_proc_state_t state, bool *fallback)
+{
+    prte_state_t *s;
+
+    *fallback = false;
+    if (state < PRTE_STATE_DISPATCH_MAX) {
+        if (NULL != (s = proc_dispatch.states[state])) {
+            return s;
+        }
+    } else if (PRTE_PROC_STATE_ANY == state) {
+        return proc_dispatch.any;
     } else {
+        PRTE_LIST_FOREACH(s, &prte_proc_states, prte_state_t)
+        {
+            if (s->proc_state == state) {
+                return s;
+            }
+        }
+    }
+    *fallback = true;
+    if (PRTE_PROC_STATE_ERROR < state && NULL != proc_dispatch.error) {
+        return proc_dispatch.error;
+    }
+    return proc_dispatch.any;
+}
+
+void prte_state_base_reset_dispatch(void)
+{
+    dispatch_clear(&job_dispatch);
+    dispatch_clear(&proc_dispatch);
+}
+
+/* Caddies are drawn from (and returned to) a small cache so that the
+ * many proc-state activations made during launch and termination do
+ * not each pay for an allocation. Caddies released with PRTE_RELEASE
+ * instead of PRTE_STATE_CADDY_RELEASE are simply freed. */
+#define PRTE_STATE_CADDY_CACHE_MAX 1024
+
+static prte_state_caddy_t *caddy_cache[PRTE_STATE_CADDY_CACHE_MAX];
+static int caddy_cache_count = 0;
+static prte_mutex_t caddy_cache_lock = PRTE_MUTEX_STATIC_INIT;
+
+prte_state_caddy_t *prte_state_base_get_caddy(void)
+{
+    prte_state_caddy_t *caddy = NULL;
+
+    prte_mutex_lock(&caddy_cache_lock);
+    if (0 < caddy_cache_count) {
+        caddy = caddy_cache[--caddy_cache_count];
+    }
+    prte_mutex_unlock(&caddy_cache_lock);
+
+    if (NULL == caddy) {
+        caddy = PRTE_NEW(prte_state_caddy_t);
+    }
+    return caddy;
+}
+
+void prte_state_base_return_caddy(prte_state_caddy_t *caddy)
+{
+    /* if someone else still holds a reference, just drop ours */
+    if (1 < caddy->super.obj_reference_count) {
+        PRTE_RELEASE(caddy);
+        return;
+    }
+
+    /* do what the destructor would, and return the caddy
+     * to its constructed state */
+    prte_event_del(&caddy->ev);
+    if (NULL != caddy->jdata) {
+        PRTE_RELEASE(caddy->jdata);
+    }
+    memset(&caddy->ev, 0, sizeof(prte_event_t));
+    caddy->jdata = NULL;
+    caddy->job_state = PRTE_JOB_STATE_UNDEF;
+    caddy->proc_state = PRTE_PROC_STATE_UNDEF;
+    PMIX_LOAD_PROCID(&caddy->name, NULL, PMIX_RANK_INVALID);
+
+    prte_mutex_lock(&caddy_cache_lock);
+    if (caddy_cache_count < PRTE_STATE_CADDY_CACHE_MAX) {
+        caddy_cache[caddy_cache_count++] = caddy;
+        caddy = NULL;
+    }
+    prte_mutex_unlock(&caddy_cache_lock);
+
+    if (NULL != caddy) {
+        PRTE_RELEASE(caddy);
+    }
+}
+
+void prte_state_base_purge_caddies(void)
+{
+    prte_mutex_lock(&caddy_cache_lock);
+    while (0 < caddy_cache_count) {
+        PRTE_RELEASE(caddy_cache[--caddy_cache_count]);
+    }
+    prte_mutex_unlock(&caddy_cache_lock);
+}
+
+void prte_state_base_activate_job_state(prte_job_t *jdata, prte_job_state_t state)
+{
+    prte_state_t *s;
+    prte_state_caddy_t *caddy;
+    bool fallback;
+
+    PRTE_TRACE(PRTE_TRACE_JOB_STATE, state,
+               (NULL == jdata) ? -1 : PRTE_LOCAL_JOBID(jdata->nspace));
+    s = job_state_lookup(state, &fallback);
+    if (NULL == s) {
         PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
                              "ACTIVATE: JOB STATE %s NOT REGISTERED",
                              prte_job_state_to_str(state)));
         return;
     }
     if (NULL == s->cbfunc) {
-        PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
-                             "ACTIVATE: ANY STATE HANDLER NOT DEFINED"));
+        if (fallback) {
+            PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
+                                 "ACTIVATE: ANY STATE HANDLER NOT DEFINED"));
+        } else {
+            PRTE_REACHING_JOB_STATE(jdata, state, s->priority);
+            PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
+                                 "%s NULL CBFUNC FOR JOB %s STATE %s",
+                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                                 (NULL == jdata) ? "ALL" : PRTE_JOBID_PRINT(jdata->nspace),
+                                 prte_job_state_to_str(state)));
+        }
         return;
     }
-    caddy = PRTE_NEW(prte_state_caddy_t);
+    caddy = prte_state_base_get_caddy();
     if (NULL != jdata) {
         caddy->jdata = jdata;
         caddy->job_state = state;
@@ -135,6 +295,7 @@ int prte_state_base_add_job_state(prte_job_state_t state, prte_state_cbfunc_t cb
     st->cbfunc = cbfunc;
     st->priority = priority;
     prte_list_append(&prte_job_states, &(st->super));
+    dispatch_set(&job_dispatch, state, PRTE_JOB_STATE_ANY, PRTE_JOB_STATE_ERROR, st);
 
     return PRTE_SUCCESS;
 }
@@ -159,6 +320,7 @@ int prte_state_base_set_job_state_callback(prte_job_state_t state, prte_state_cb
     st->cbfunc = cbfunc;
     st->priority = PRTE_SYS_PRI;
     prte_list_append(&prte_job_states, &(st->super));
+    dispatch_set(&job_dispatch, state, PRTE_JOB_STATE_ANY, PRTE_JOB_STATE_ERROR, st);
 
     return PRTE_SUCCESS;
 }
@@ -188,6 +350,7 @@ int prte_state_base_remove_job_state(prte_job_state_t state)
          item = prte_list_get_next(item)) {
         st = (prte_state_t *) item;
         if (st->job_state == state) {
+            dispatch_set(&job_dispatch, state, PRTE_JOB_STATE_ANY, PRTE_JOB_STATE_ERROR, NULL);
             prte_list_remove_item(&prte_job_states, item);
             PRTE_RELEASE(item);
             return PRTE_SUCCESS;
@@ -213,60 +376,130 @@ void prte_state_base_print_job_state_machine(void)
 /****    PROC STATE MACHINE    ****/
 void prte_state_base_activate_proc_state(pmix_proc_t *proc, prte_proc_state_t state)
 {
-    prte_list_item_t *itm, *any = NULL, *error = NULL;
     prte_state_t *s;
     prte_state_caddy_t *caddy;
+    bool fallback;
 
-    for (itm = prte_list_get_first(&prte_proc_states); itm != prte_list_get_end(&prte_proc_states);
-         itm = prte_list_get_next(itm)) {
-        s = (prte_state_t *) itm;
-        if (s->proc_state == PRTE_PROC_STATE_ANY) {
-            /* save this place */
-            any = itm;
-        }
-        if (s->proc_state == PRTE_PROC_STATE_ERROR) {
-            error = itm;
-        }
-        if (s->proc_state == state) {
-            PRTE_REACHING_PROC_STATE(proc, state, s->priority);
-            if (NULL == s->cbfunc) {
-                PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
-                                     "%s NULL CBFUNC FOR PROC %s STATE %s",
-                                     PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_NAME_PRINT(proc),
-                                     prte_proc_state_to_str(state)));
-                return;
-            }
-            caddy = PRTE_NEW(prte_state_caddy_t);
-            caddy->name = *proc;
-            caddy->proc_state = state;
-            PRTE_THREADSHIFT(caddy, prte_event_base, s->cbfunc, s->priority);
-            return;
-        }
-    }
-    /* if we get here, then the state wasn't found, so execute
-     * the default handler if it is defined
-     */
-    if (PRTE_PROC_STATE_ERROR < state && NULL != error) {
-        s = (prte_state_t *) error;
-    } else if (NULL != any) {
-        s = (prte_state_t *) any;
-    } else {
+    PRTE_TRACE(PRTE_TRACE_PROC_STATE, state, proc->rank);
+    s = proc_state_lookup(state, &fallback);
+    if (NULL == s) {
         PRTE_OUTPUT_VERBOSE(
             (1, prte_state_base_framework.framework_output, "INCREMENT: ANY STATE NOT FOUND"));
         return;
     }
     if (NULL == s->cbfunc) {
-        PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
-                             "ACTIVATE: ANY STATE HANDLER NOT DEFINED"));
+        if (fallback) {
+            PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
+                                 "ACTIVATE: ANY STATE HANDLER NOT DEFINED"));
+        } else {
+            PRTE_REACHING_PROC_STATE(proc, state, s->priority);
+            PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
+                                 "%s NULL CBFUNC FOR PROC %s STATE %s",
+                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_NAME_PRINT(proc),
+                                 prte_proc_state_to_str(state)));
+        }
         return;
     }
-    caddy = PRTE_NEW(prte_state_caddy_t);
+    caddy = prte_state_base_get_caddy();
     caddy->name = *proc;
     caddy->proc_state = state;
     PRTE_REACHING_PROC_STATE(proc, state, s->priority);
     PRTE_THREADSHIFT(caddy, prte_event_base, s->cbfunc, s->priority);
 }
 
+/* a batch of procs that all reached the same state - the handler
+ * for that state is invoked for each of them from a single event */
+typedef struct {
+    prte_object_t super;
+    prte_event_t ev;
+    prte_state_cbfunc_t cbfunc;
+    prte_proc_state_t state;
+    pmix_proc_t *procs;
+    size_t nprocs;
+} prte_state_batch_t;
+static void bcon(prte_state_batch_t *p)
+{
+    p->cbfunc = NULL;
+    p->state = PRTE_PROC_STATE_UNDEF;
+    p->procs = NULL;
+    p->nprocs = 0;
+}
+static void bdes(prte_state_batch_t *p)
+{
+    if (NULL != p->procs) {
+        free(p->procs);
+    }
+}
+static PRTE_CLASS_INSTANCE(prte_state_batch_t, prte_object_t, bcon, bdes);
+
+static void track_procs_batch(pmix_proc_t *procs, size_t nprocs, prte_proc_state_t state);
+
+static void dispatch_batch(int fd, short args, void *cbdata)
+{
+    prte_state_batch_t *batch = (prte_state_batch_t *) cbdata;
+    prte_state_caddy_t *caddy;
+    size_t n;
+
+    PRTE_ACQUIRE_OBJECT(batch);
+
+    /* the base tracker updates the job counters once per batch */
+    if (prte_state_base_track_procs == batch->cbfunc
+        && (PRTE_PROC_STATE_RUNNING == batch->state || PRTE_PROC_STATE_REGISTERED == batch->state
+            || PRTE_PROC_STATE_TERMINATED == batch->state)) {
+        track_procs_batch(batch->procs, batch->nprocs, batch->state);
+        PRTE_RELEASE(batch);
+        return;
+    }
+
+    for (n = 0; n < batch->nprocs; n++) {
+        caddy = prte_state_base_get_caddy();
+        caddy->name = batch->procs[n];
+        caddy->proc_state = batch->state;
+        /* the handler owns the caddy, just as if it had
+         * been delivered by its own event */
+        batch->cbfunc(fd, args, caddy);
+    }
+    PRTE_RELEASE(batch);
+}
+
+void prte_state_base_activate_proc_state_batch(pmix_proc_t *procs, size_t nprocs,
+                                               prte_proc_state_t state)
+{
+    prte_state_t *s;
+    prte_state_batch_t *batch;
+    bool fallback;
+    size_t n;
+
+    if (0 == nprocs) {
+        return;
+    }
+    if (1 == nprocs) {
+        prte_state_base_activate_proc_state(&procs[0], state);
+        return;
+    }
+
+    s = proc_state_lookup(state, &fallback);
+    if (NULL == s || NULL == s->cbfunc) {
+        PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
+                             "%s NO HANDLER FOR BATCH OF %lu PROCS STATE %s",
+                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), (unsigned long) nprocs,
+                             prte_proc_state_to_str(state)));
+        return;
+    }
+    for (n = 0; n < nprocs; n++) {
+        PRTE_TRACE(PRTE_TRACE_PROC_STATE, state, procs[n].rank);
+        PRTE_REACHING_PROC_STATE(&procs[n], state, s->priority);
+    }
+
+    batch = PRTE_NEW(prte_state_batch_t);
+    batch->procs = (pmix_proc_t *) malloc(nprocs * sizeof(pmix_proc_t));
+    memcpy(batch->procs, procs, nprocs * sizeof(pmix_proc_t));
+    batch->nprocs = nprocs;
+    batch->cbfunc = s->cbfunc;
+    batch->state = state;
+    PRTE_THREADSHIFT(batch, prte_event_base, dispatch_batch, s->priority);
+}
+
 int prte_state_base_add_proc_state(prte_proc_state_t state, prte_state_cbfunc_t cbfunc,
                                    int priority)
 {
@@ -289,6 +522,7 @@ int prte_state_base_add_proc_state(prte_proc_state_t state, prte_state_cbfunc_t
     st->cbfunc = cbfunc;
     st->priority = priority;
     prte_list_append(&prte_proc_states, &(st->super));
+    dispatch_set(&proc_dispatch, state, PRTE_PROC_STATE_ANY, PRTE_PROC_STATE_ERROR, st);
 
     return PRTE_SUCCESS;
 }
@@ -334,6 +568,7 @@ int prte_state_base_remove_proc_state(prte_proc_state_t state)
          item != prte_list_get_end(&prte_proc_states); item = prte_list_get_next(item)) {
         st = (prte_state_t *) item;
         if (st->proc_state == state) {
+            dispatch_set(&proc_dispatch, state, PRTE_PROC_STATE_ANY, PRTE_PROC_STATE_ERROR, NULL);
             prte_list_remove_item(&prte_proc_states, item);
             PRTE_RELEASE(item);
             return PRTE_SUCCESS;
@@ -367,7 +602,7 @@ void prte_state_base_local_launch_complete(int fd, short argc, void *cbdata)
             PRTE_ACTIVATE_JOB_STATE(jdata, PRTE_JOB_STATE_REPORT_PROGRESS);
         }
     }
-    PRTE_RELEASE(state);
+    PRTE_STATE_CADDY_RELEASE(state);
 }
 
 void prte_state_base_cleanup_job(int fd, short argc, void *cbdata)
@@ -386,7 +621,7 @@ void prte_state_base_cleanup_job(int fd, short argc, void *cbdata)
     jdata->state = PRTE_JOB_STATE_NOTIFIED;
     /* send us back thru job complete */
     PRTE_ACTIVATE_JOB_STATE(jdata, PRTE_JOB_STATE_TERMINATED);
-    PRTE_RELEASE(caddy);
+    PRTE_STATE_CADDY_RELEASE(caddy);
 }
 
 void prte_state_base_report_progress(int fd, short argc, void *cbdata)
@@ -401,7 +636,7 @@ void prte_state_base_report_progress(int fd, short argc, void *cbdata)
                 "App launch reported: %d (out of %d) daemons - %d (out of %d) procs",
                 (int) jdata->num_daemons_reported, (int) prte_process_info.num_daemons,
                 (int) jdata->num_launched, (int) jdata->num_procs);
-    PRTE_RELEASE(caddy);
+    PRTE_STATE_CADDY_RELEASE(caddy);
 }
 
 void prte_state_base_notify_data_server(pmix_proc_t *target)
@@ -555,6 +790,70 @@ static void opcbfunc(pmix_status_t status, void *cbdata)
     PRTE_PMIX_WAKEUP_THREAD(lock);
 }
 
+/* mark a proc terminated and, if it was ours, release what
+ * we held for it */
+static void terminate_proc(prte_job_t *jdata, prte_app_context_t *app, prte_proc_t *pdata)
+{
+    prte_pmix_lock_t lock;
+
+    PRTE_FLAG_UNSET(pdata, PRTE_PROC_FLAG_ALIVE);
+    if (pdata->state < PRTE_PROC_STATE_TERMINATED) {
+        pdata->state = PRTE_PROC_STATE_TERMINATED;
+    }
+    if (PRTE_FLAG_TEST(pdata, PRTE_PROC_FLAG_LOCAL)) {
+        PRTE_PMIX_CONSTRUCT_LOCK(&lock);
+        PMIx_server_deregister_client(&pdata->name, opcbfunc, &lock);
+        PRTE_PMIX_WAIT_THREAD(&lock);
+        PRTE_PMIX_DESTRUCT_LOCK(&lock);
+
+        /* Clean up the session directory as if we were the process
+         * itself.  This covers the case where the process died abnormally
+         * and didn't cleanup its own session directory.
+         */
+        if (!PRTE_FLAG_TEST(app, PRTE_APP_DEBUGGER_DAEMON)  &&
+            !PRTE_FLAG_TEST(jdata, PRTE_JOB_FLAG_TOOL)) {
+            prte_session_dir_finalize(&pdata->name);
+        }
+    }
+}
+
+/* exit once no local procs remain (might be some from another job) */
+static void check_routes_gone(void)
+{
+    prte_proc_t *pdata;
+    int i;
+
+    for (i = 0; i < prte_local_children->size; i++) {
+        if (NULL != (pdata = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children, i))
+            && PRTE_FLAG_TEST(pdata, PRTE_PROC_FLAG_ALIVE)) {
+            /* at least one is still alive */
+            return;
+        }
+    }
+    /* call our appropriate exit procedure */
+    PRTE_OUTPUT_VERBOSE((5, prte_state_base_framework.framework_output,
+                         "%s state:base all routes and children gone - exiting",
+                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME)));
+    PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_DAEMONS_TERMINATED);
+}
+
+static void job_terminated(prte_job_t *jdata)
+{
+    pmix_proc_t target;
+
+    /* if requested, check fd status for leaks */
+    if (prte_state_base_run_fdcheck) {
+        prte_state_base_check_fds(jdata);
+    }
+    /* if ompi-server is around, then notify it to purge
+     * any session-related info */
+    if (NULL != prte_data_server_uri) {
+        PMIX_LOAD_PROCID(&target, jdata->nspace, PMIX_RANK_WILDCARD);
+        prte_state_base_notify_data_server(&target);
+    }
+    PRTE_ACTIVATE_JOB_STATE(jdata, PRTE_JOB_STATE_TERMINATED);
+}
+
 void prte_state_base_track_procs(int fd, short argc, void *cbdata)
 {
     prte_state_caddy_t *caddy = (prte_state_caddy_t *) cbdata;
@@ -563,9 +862,7 @@ void prte_state_base_track_procs(int fd, short argc, void *cbdata)
     prte_proc_state_t state;
     prte_job_t *jdata;
     prte_proc_t *pdata;
-    int i;
-    pmix_proc_t parent, target;
-    prte_pmix_lock_t lock;
+    pmix_proc_t parent;
     pmix_rank_t threshold;
     prte_app_context_t *app;
 
@@ -671,61 +968,19 @@ void prte_state_base_track_procs(int fd, short argc, void *cbdata)
             goto cleanup;
         }
 
-        /* update the proc state */
-        PRTE_FLAG_UNSET(pdata, PRTE_PROC_FLAG_ALIVE);
-        if (pdata->state < PRTE_PROC_STATE_TERMINATED) {
-            pdata->state = state;
-        }
-        if (PRTE_FLAG_TEST(pdata, PRTE_PROC_FLAG_LOCAL)) {
-            PRTE_PMIX_CONSTRUCT_LOCK(&lock);
-            PMIx_server_deregister_client(proc, opcbfunc, &lock);
-            PRTE_PMIX_WAIT_THREAD(&lock);
-            PRTE_PMIX_DESTRUCT_LOCK(&lock);
-
-            /* Clean up the session directory as if we were the process
-             * itself.  This covers the case where the process died abnormally
-             * and didn't cleanup its own session directory.
-             */
-            if (!PRTE_FLAG_TEST(app, PRTE_APP_DEBUGGER_DAEMON)  &&
-                !PRTE_FLAG_TEST(jdata, PRTE_JOB_FLAG_TOOL)) {
-                prte_session_dir_finalize(proc);
-            }
-        }
+        terminate_proc(jdata, app, pdata);
         /* if we are trying to terminate and our routes are
          * gone, then terminate ourselves IF no local procs
          * remain (might be some from another job)
          */
         if (prte_prteds_term_ordered && 0 == prte_routed.num_routes()) {
-            for (i = 0; i < prte_local_children->size; i++) {
-                if (NULL
-                        != (pdata = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children,
-                                                                                i))
-                    && PRTE_FLAG_TEST(pdata, PRTE_PROC_FLAG_ALIVE)) {
-                    /* at least one is still alive */
-                    goto cleanup;
-                }
-            }
-            /* call our appropriate exit procedure */
-            PRTE_OUTPUT_VERBOSE((5, prte_state_base_framework.framework_output,
-                                 "%s state:base all routes and children gone - exiting",
-                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME)));
-            PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_DAEMONS_TERMINATED);
+            check_routes_gone();
             goto cleanup;
         }
         /* track job status */
         jdata->num_terminated++;
         if (jdata->num_terminated == jdata->num_procs) {
-            /* if requested, check fd status for leaks */
-            if (prte_state_base_run_fdcheck) {
-                prte_state_base_check_fds(jdata);
-            }
-            /* if ompi-server is around, then notify it to purge
-             * any session-related info */
-            if (NULL != prte_data_server_uri) {
-                PMIX_LOAD_PROCID(&target, jdata->nspace, PMIX_RANK_WILDCARD);
-                prte_state_base_notify_data_server(&target);
-            }
-            PRTE_ACTIVATE_JOB_STATE(jdata, PRTE_JOB_STATE_TERMINATED);
+            job_terminated(jdata);
         } else if (PRTE_PROC_STATE_TERMINATED < pdata->state && !prte_job_term_ordered) {
             /* if this was an abnormal term, notify the other procs of the termination */
             PMIX_LOAD_PROCID(&parent, jdata->nspace, PMIX_RANK_WILDCARD);
@@ -739,7 +994,98 @@ void prte_state_base_track_procs(int fd, short argc, void *cbdata)
     }
 
 cleanup:
-    PRTE_RELEASE(caddy);
+    PRTE_STATE_CADDY_RELEASE(caddy);
+}
+
+/* apply one run of same-job procs from a batch, then update the
+ * job counters and check their thresholds once for the whole run */
+static void track_job_run(prte_job_t *jdata, pmix_proc_t *procs, size_t nprocs,
+                          prte_proc_state_t state)
+{
+    prte_proc_t *pdata;
+    prte_app_context_t *app;
+    pmix_proc_t parent;
+    pmix_rank_t count = 0, prior;
+    size_t n;
+
+    for (n = 0; n < nprocs; n++) {
+        pdata = (prte_proc_t *) prte_pointer_array_get_item(jdata->procs, procs[n].rank);
+        if (NULL == pdata) {
+            continue;
+        }
+        if (PRTE_PROC_STATE_TERMINATED == state) {
+            if (pdata->state == state) {
+                /* already counted */
+                continue;
+            }
+            app = (prte_app_context_t *) prte_pointer_array_get_item(jdata->apps, pdata->app_idx);
+            terminate_proc(jdata, app, pdata);
+        } else if (pdata->state < PRTE_PROC_STATE_TERMINATED) {
+            pdata->state = state;
+        }
+        count++;
+    }
+    if (0 == count) {
+        return;
+    }
+
+    if (PRTE_PROC_STATE_RUNNING == state) {
+        prior = jdata->num_launched;
+        jdata->num_launched += count;
+        if (0 == prior) {
+            PRTE_ACTIVATE_JOB_STATE(jdata, PRTE_JOB_STATE_STARTED);
+        }
+        if (prior < jdata->num_procs && jdata->num_launched >= jdata->num_procs) {
+            PRTE_ACTIVATE_JOB_STATE(jdata, PRTE_JOB_STATE_RUNNING);
+        }
+    } else if (PRTE_PROC_STATE_REGISTERED == state) {
+        prior = jdata->num_reported;
+        jdata->num_reported += count;
+        if (prior < jdata->num_procs && jdata->num_reported >= jdata->num_procs) {
+            PRTE_ACTIVATE_JOB_STATE(jdata, PRTE_JOB_STATE_REGISTERED);
+        }
+    } else {
+        if (prte_prteds_term_ordered && 0 == prte_routed.num_routes()) {
+            check_routes_gone();
+            return;
+        }
+        prior = jdata->num_terminated;
+        jdata->num_terminated += count;
+        if (prior < jdata->num_procs && jdata->num_terminated >= jdata->num_procs) {
+            job_terminated(jdata);
+        } else if (!prte_job_term_ordered && !prte_enable_ft) {
+            /* notify the other procs of any abnormal terms - if ft prte
+             * is enabled, a PMIx event has already been produced */
+            PMIX_LOAD_PROCID(&parent, jdata->nspace, PMIX_RANK_WILDCARD);
+            for (n = 0; n < nprocs; n++) {
+                pdata = (prte_proc_t *) prte_pointer_array_get_item(jdata->procs, procs[n].rank);
+                if (NULL != pdata && PRTE_PROC_STATE_TERMINATED < pdata->state) {
+                    _send_notification(PRTE_ERR_PROC_ABORTED, pdata->state, &pdata->name,
+                                       &parent);
+                }
+            }
+        }
+    }
+}
+
+static void track_procs_batch(pmix_proc_t *procs, size_t nprocs, prte_proc_state_t state)
+{
+    prte_job_t *jdata;
+    size_t start, n;
+
+    prte_output_verbose(5, prte_state_base_framework.framework_output,
+                        "%s state:base:track_procs called for batch of %lu procs state %s",
+                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), (unsigned long) nprocs,
+                        prte_proc_state_to_str(state));
+
+    for (start = 0; start < nprocs; start = n) {
+        for (n = start + 1; n < nprocs && PMIX_CHECK_NSPACE(procs[n].nspace, procs[start].nspace);
+             n++) {
+        }
+        if (NULL != (jdata = prte_get_job_data_object(procs[start].nspace))) {
+            track_job_run(jdata, &procs[start], n - start, state);
+        }
+    }
 }
 
 void prte_state_base_check_all_complete(int fd, short args, void *cbdata)
@@ -850,10 +1196,10 @@ CHECK_DAEMONS:
                 jdata = prte_get_job_data_object(PRTE_PROC_MY_NAME->nspace);
             }
             PRTE_ACTIVATE_JOB_STATE(jdata, PRTE_JOB_STATE_DAEMONS_TERMINATED);
-            PRTE_RELEASE(caddy);
+            PRTE_STATE_CADDY_RELEASE(caddy);
             return;
         }
-        PRTE_RELEASE(caddy);
+        PRTE_STATE_CADDY_RELEASE(caddy);
         return;
     }
 
@@ -900,6 +1246,8 @@ CHECK_DAEMONS:
                 /* release the proc once for the map entry */
                 PRTE_RELEASE(proc);
             }
+            /* its slots are available again */
+            prte_rmaps_base_free_index_mark(node);
             /* set the node location to NULL */
             prte_pointer_array_set_item(map->nodes, index, NULL);
             /* maintain accounting */
@@ -990,7 +1338,7 @@ CHECK_ALIVE:
         PRTE_OUTPUT_VERBOSE((2, prte_state_base_framework.framework_output,
                              "%s state:base:check_job_completed at least one job is not terminated",
                              PRTE_NAME_PRINT(PRTE_PROC_MY_NAME)));
-        PRTE_RELEASE(caddy);
+        PRTE_STATE_CADDY_RELEASE(caddy);
         return;
     }
     /* if we get here, then all jobs are done, so terminate */
@@ -1015,7 +1363,7 @@ CHECK_ALIVE:
      */
     prte_plm.terminate_orteds();
 
-    PRTE_RELEASE(caddy);
+    PRTE_STATE_CADDY_RELEASE(caddy);
 }
 
 void prte_state_base_check_fds(prte_job_t *jdata)
@@ -46,6 +46,8 @@ prte_state_base_module_t prte_state = {0};
 bool prte_state_base_run_fdcheck = false;
 int prte_state_base_parent_fd = -1;
 bool prte_state_base_ready_msg = true;
+int prte_state_base_report_delay = 0;
+int prte_state_base_report_batch = 4096;
 
 static int prte_state_base_register(prte_mca_base_register_flag_t flags)
 {
@@ -56,6 +58,24 @@ static int prte_state_base_register(prte_mca_base_register_flag_t flags)
                                PRTE_INFO_LVL_9, PRTE_MCA_BASE_VAR_SCOPE_READONLY,
                                &prte_state_base_run_fdcheck);
 
+    prte_state_base_report_delay = 0;
+    prte_mca_base_var_register("prte", "state", "base", "report_delay",
+                               "Time (in milliseconds) a daemon may hold the proc-state report for "
+                               "a completed job so it can be combined with the reports for other "
+                               "jobs into a single message to the DVM master (0 = send immediately). "
+                               "Reports of abnormal terminations are always sent immediately",
+                               PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE,
+                               PRTE_INFO_LVL_9, PRTE_MCA_BASE_VAR_SCOPE_READONLY,
+                               &prte_state_base_report_delay);
+
+    prte_state_base_report_batch = 4096;
+    prte_mca_base_var_register("prte", "state", "base", "report_batch",
+                               "Number of proc states held by a daemon after which its pending "
+                               "report is sent without waiting for the report delay to expire",
+                               PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE,
+                               PRTE_INFO_LVL_9, PRTE_MCA_BASE_VAR_SCOPE_READONLY,
+                               &prte_state_base_report_batch);
+
     return PRTE_SUCCESS;
 }
 
@@ -65,6 +85,8 @@ static int prte_state_base_close(void)
     if (NULL != prte_state.finalize) {
         prte_state.finalize();
     }
+    prte_state_base_reset_dispatch();
+    prte_state_base_purge_caddies();
 
     return prte_mca_base_framework_components_close(&prte_state_base_framework, NULL);
 }
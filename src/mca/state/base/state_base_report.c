@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2021      Nanook Consulting.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+/** @file
+ *
+ * Aggregation of the proc-state reports a daemon sends to the DVM
+ * master when all of its local procs for a job have terminated.
+ *
+ * Each job's report is encoded as one compact record:
+ *
+ *     nspace
+ *     int32    number of procs
+ *     uint8    flags (PRTE_STATE_REPORT_UNIFORM_*)
+ *     rank[n]  pid[n]
+ *     state[n]     - or a single state if all are the same
+ *     exitcode[n]  - or a single exit code if all are the same
+ *
+ * with each array packed by a single call. Records for different
+ * jobs are appended to a pending buffer that is sent to the master
+ * as one PRTE_PLM_PROC_STATE_BATCH_CMD message, either immediately
+ * (the default) or once the report delay expires or the number of
+ * pending procs reaches the configured batch size. A record that
+ * includes an abnormal termination is always sent at once.
+ */
+
+#include "prte_config.h"
+#include "constants.h"
+
+#include <string.h>
+
+#include "src/pmix/pmix-internal.h"
+#include "src/mca/errmgr/errmgr.h"
+#include "src/mca/plm/plm_types.h"
+#include "src/mca/rml/rml.h"
+#include "src/runtime/prte_globals.h"
+#include "src/threads/threads.h"
+#include "src/util/name_fns.h"
+#include "src/util/proc_info.h"
+
+#include "src/mca/state/base/base.h"
+#include "src/mca/state/base/state_private.h"
+
+static pmix_data_buffer_t *pending = NULL;
+static int pending_nprocs = 0;
+static bool timer_active = false;
+static prte_event_t timer_ev;
+
+static void timer_fired(int fd, short args, void *cbdata)
+{
+    timer_active = false;
+    prte_state_base_flush_proc_states();
+}
+
+int prte_state_base_pack_proc_states(pmix_data_buffer_t *buf, prte_job_t *jdata)
+{
+    prte_proc_t *child;
+    pmix_rank_t *ranks = NULL;
+    pid_t *pids = NULL;
+    prte_proc_state_t *states = NULL;
+    prte_exit_code_t *codes = NULL;
+    int32_t n = 0, i;
+    uint8_t flags = PRTE_STATE_REPORT_UNIFORM_STATE | PRTE_STATE_REPORT_UNIFORM_EXIT;
+    int rc = PRTE_SUCCESS;
+
+    rc = PMIx_Data_pack(NULL, buf, &jdata->nspace, 1, PMIX_PROC_NSPACE);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return prte_pmix_convert_status(rc);
+    }
+
+    /* collect the columns for this job's local children */
+    if (0 < prte_local_children->size) {
+        ranks = (pmix_rank_t *) malloc(prte_local_children->size * sizeof(pmix_rank_t));
+        pids = (pid_t *) malloc(prte_local_children->size * sizeof(pid_t));
+        states = (prte_proc_state_t *) malloc(prte_local_children->size
+                                              * sizeof(prte_proc_state_t));
+        codes = (prte_exit_code_t *) malloc(prte_local_children->size
+                                            * sizeof(prte_exit_code_t));
+        if (NULL == ranks || NULL == pids || NULL == states || NULL == codes) {
+            rc = PRTE_ERR_OUT_OF_RESOURCE;
+            goto cleanup;
+        }
+    }
+    for (i = 0; i < prte_local_children->size; i++) {
+        child = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children, i);
+        if (NULL == child || !PMIX_CHECK_NSPACE(child->name.nspace, jdata->nspace)) {
+            continue;
+        }
+        ranks[n] = child->name.rank;
+        pids[n] = child->pid;
+        states[n] = child->state;
+        codes[n] = child->exit_code;
+        if (0 < n && states[n] != states[0]) {
+            flags &= ~PRTE_STATE_REPORT_UNIFORM_STATE;
+        }
+        if (0 < n && codes[n] != codes[0]) {
+            flags &= ~PRTE_STATE_REPORT_UNIFORM_EXIT;
+        }
+        n++;
+    }
+
+    rc = PMIx_Data_pack(NULL, buf, &n, 1, PMIX_INT32);
+    if (PMIX_SUCCESS != rc) {
+        goto pmixerr;
+    }
+    rc = PMIx_Data_pack(NULL, buf, &flags, 1, PMIX_UINT8);
+    if (PMIX_SUCCESS != rc) {
+        goto pmixerr;
+    }
+    if (0 < n) {
+        rc = PMIx_Data_pack(NULL, buf, ranks, n, PMIX_PROC_RANK);
+        if (PMIX_SUCCESS != rc) {
+            goto pmixerr;
+        }
+        rc = PMIx_Data_pack(NULL, buf, pids, n, PMIX_PID);
+        if (PMIX_SUCCESS != rc) {
+            goto pmixerr;
+        }
+        rc = PMIx_Data_pack(NULL, buf, states,
+                            (flags & PRTE_STATE_REPORT_UNIFORM_STATE) ? 1 : n, PMIX_UINT32);
+        if (PMIX_SUCCESS != rc) {
+            goto pmixerr;
+        }
+        rc = PMIx_Data_pack(NULL, buf, codes,
+                            (flags & PRTE_STATE_REPORT_UNIFORM_EXIT) ? 1 : n, PMIX_INT32);
+        if (PMIX_SUCCESS != rc) {
+            goto pmixerr;
+        }
+    }
+    rc = PRTE_SUCCESS;
+    goto cleanup;
+
+pmixerr:
+    PMIX_ERROR_LOG(rc);
+    rc = prte_pmix_convert_status(rc);
+
+cleanup:
+    if (NULL != ranks) {
+        free(ranks);
+    }
+    if (NULL != pids) {
+        free(pids);
+    }
+    if (NULL != states) {
+        free(states);
+    }
+    if (NULL != codes) {
+        free(codes);
+    }
+    return rc;
+}
+
+/* true if any of the job's local procs terminated abnormally */
+static bool abnormal_exit(prte_job_t *jdata)
+{
+    prte_proc_t *child;
+    int i;
+
+    for (i = 0; i < prte_local_children->size; i++) {
+        child = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children, i);
+        if (NULL != child && PMIX_CHECK_NSPACE(child->name.nspace, jdata->nspace)
+            && PRTE_PROC_STATE_ERROR <= child->state) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int prte_state_base_report_proc_states(prte_job_t *jdata)
+{
+    prte_plm_cmd_flag_t cmd = PRTE_PLM_PROC_STATE_BATCH_CMD;
+    struct timeval tv;
+    int rc;
+
+    if (NULL == pending) {
+        PMIX_DATA_BUFFER_CREATE(pending);
+        rc = PMIx_Data_pack(NULL, pending, &cmd, 1, PMIX_UINT8);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            PMIX_DATA_BUFFER_RELEASE(pending);
+            return prte_pmix_convert_status(rc);
+        }
+        pending_nprocs = 0;
+    }
+    if (PRTE_SUCCESS != (rc = prte_state_base_pack_proc_states(pending, jdata))) {
+        PRTE_ERROR_LOG(rc);
+        return rc;
+    }
+    pending_nprocs += jdata->num_local_procs;
+
+    PRTE_OUTPUT_VERBOSE((5, prte_state_base_framework.framework_output,
+                         "%s state:base:report queued proc states for job %s (%d pending)",
+                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_JOBID_PRINT(jdata->nspace),
+                         pending_nprocs));
+
+    /* failures are never held back */
+    if (0 >= prte_state_base_report_delay || prte_state_base_report_batch <= pending_nprocs
+        || abnormal_exit(jdata)) {
+        if (timer_active) {
+            prte_event_evtimer_del(&timer_ev);
+            timer_active = false;
+        }
+        prte_state_base_flush_proc_states();
+    } else if (!timer_active) {
+        tv.tv_sec = prte_state_base_report_delay / 1000;
+        tv.tv_usec = (prte_state_base_report_delay % 1000) * 1000;
+        prte_event_evtimer_set(prte_event_base, &timer_ev, timer_fired, NULL);
+        prte_event_evtimer_add(&timer_ev, &tv);
+        timer_active = true;
+    }
+    return PRTE_SUCCESS;
+}
+
+void prte_state_base_flush_proc_states(void)
+{
+    int rc;
+
+    if (timer_active) {
+        prte_event_evtimer_del(&timer_ev);
+        timer_active = false;
+    }
+    if (NULL == pending) {
+        return;
+    }
+
+    PRTE_OUTPUT_VERBOSE((5, prte_state_base_framework.framework_output,
+                         "%s state:base:report sending %d proc states",
+                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), pending_nprocs));
+
+    if (0 > (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, pending, PRTE_RML_TAG_PLM,
+                                          prte_rml_send_callback, NULL))) {
+        PRTE_ERROR_LOG(rc);
+        PMIX_DATA_BUFFER_RELEASE(pending);
+    }
+    pending = NULL;
+    pending_nprocs = 0;
+}
@@ -37,6 +37,13 @@
 BEGIN_C_DECLS
 
 PRTE_EXPORT extern bool prte_state_base_run_fdcheck;
+PRTE_EXPORT extern int prte_state_base_report_delay;
+PRTE_EXPORT extern int prte_state_base_report_batch;
+
+/* flags describing a packed proc-state report */
+#define PRTE_STATE_REPORT_UNIFORM_STATE 0x01
+#define PRTE_STATE_REPORT_UNIFORM_EXIT  0x02
+
 /*
  * Base functions
  */
@@ -56,6 +63,9 @@ PRTE_EXPORT void prte_util_print_job_state_machine(void);
 
 PRTE_EXPORT void prte_state_base_activate_proc_state(pmix_proc_t *proc, prte_proc_state_t state);
 
+PRTE_EXPORT void prte_state_base_activate_proc_state_batch(pmix_proc_t *procs, size_t nprocs,
+                                                           prte_proc_state_t state);
+
 PRTE_EXPORT int prte_state_base_add_proc_state(prte_proc_state_t state, prte_state_cbfunc_t cbfunc,
                                                int priority);
 
@@ -68,6 +78,15 @@ PRTE_EXPORT int prte_state_base_remove_proc_state(prte_proc_state_t state);
 
 PRTE_EXPORT void prte_util_print_proc_state_machine(void);
 
+/* daemon-side reporting of local proc states to the DVM master */
+PRTE_EXPORT int prte_state_base_pack_proc_states(pmix_data_buffer_t *buf, prte_job_t *jdata);
+PRTE_EXPORT int prte_state_base_report_proc_states(prte_job_t *jdata);
+PRTE_EXPORT void prte_state_base_flush_proc_states(void);
+
+/* release the dispatch tables and cached caddies */
+PRTE_EXPORT void prte_state_base_reset_dispatch(void);
+PRTE_EXPORT void prte_state_base_purge_caddies(void);
+
 /* common state processing functions */
 PRTE_EXPORT void prte_state_base_local_launch_complete(int fd, short argc, void *cbdata);
 PRTE_EXPORT void prte_state_base_cleanup_job(int fd, short argc, void *cbdata);
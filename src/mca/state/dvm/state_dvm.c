@@ -78,7 +78,8 @@ prte_state_base_module_t prte_state_dvm_module = {init,
                                                   prte_state_base_add_proc_state,
                                                   prte_state_base_set_proc_state_callback,
                                                   prte_state_base_set_proc_state_priority,
-                                                  prte_state_base_remove_proc_state};
+                                                  prte_state_base_remove_proc_state,
+                                                  prte_state_base_activate_proc_state_batch};
 
 static void dvm_notify(int sd, short args, void *cbdata);
 
@@ -148,7 +149,7 @@ static void force_quit(int fd, short args, void *cbdata)
 
     /* give us a chance to stop the orteds */
     prte_plm.terminate_orteds();
-    PRTE_RELEASE(caddy);
+    PRTE_STATE_CADDY_RELEASE(caddy);
 }
 
 /************************
@@ -251,7 +252,7 @@ static void init_complete(int sd, short args, void *cbdata)
     /* need to go thru allocate step in case someone wants to
      * expand the DVM */
     PRTE_ACTIVATE_JOB_STATE(caddy->jdata, PRTE_JOB_STATE_ALLOCATE);
-    PRTE_RELEASE(caddy);
+    PRTE_STATE_CADDY_RELEASE(caddy);
 }
 
 static void vm_ready(int fd, short args, void *cbdata)
@@ -361,7 +362,7 @@ static void vm_ready(int fd, short args, void *cbdata)
         }
         /* progress the job */
         caddy->jdata->state = PRTE_JOB_STATE_VM_READY;
-        PRTE_RELEASE(caddy);
+        PRTE_STATE_CADDY_RELEASE(caddy);
         return;
     }
 
@@ -369,7 +370,7 @@ static void vm_ready(int fd, short args, void *cbdata)
     if (PRTE_SUCCESS != prte_filem.preposition_files(caddy->jdata, files_ready, caddy->jdata)) {
         PRTE_ACTIVATE_JOB_STATE(caddy->jdata, PRTE_JOB_STATE_FILES_POSN_FAILED);
     }
-    PRTE_RELEASE(caddy);
+    PRTE_STATE_CADDY_RELEASE(caddy);
 }
 
 static void job_started(int fd, short args, void *cbdata)
@@ -408,7 +409,7 @@ static void job_started(int fd, short args, void *cbdata)
         PMIX_INFO_FREE(iptr, 5);
     }
 
-    PRTE_RELEASE(caddy);
+    PRTE_STATE_CADDY_RELEASE(caddy);
 }
 
 static void ready_for_debug(int fd, short args, void *cbdata)
@@ -483,7 +484,7 @@ static void ready_for_debug(int fd, short args, void *cbdata)
     PMIX_INFO_FREE(iptr, ninfo);
 
 DONE:
-    PRTE_RELEASE(caddy);
+    PRTE_STATE_CADDY_RELEASE(caddy);
 }
 
 static void opcbfunc(pmix_status_t status, void *cbdata)
@@ -544,11 +545,11 @@ static void check_complete(int fd, short args, void *cbdata)
                 jdata = prte_get_job_data_object(PRTE_PROC_MY_NAME->nspace);
             }
             PRTE_ACTIVATE_JOB_STATE(jdata, PRTE_JOB_STATE_DAEMONS_TERMINATED);
-            PRTE_RELEASE(caddy);
+            PRTE_STATE_CADDY_RELEASE(caddy);
             prte_dvm_ready = false;
             return;
         }
-        PRTE_RELEASE(caddy);
+        PRTE_STATE_CADDY_RELEASE(caddy);
         return;
     }
 
@@ -579,19 +580,10 @@ static void check_complete(int fd, short args, void *cbdata)
     /* cleanup any pending server ops */
     PMIX_LOAD_PROCID(&pname, jdata->nspace, PMIX_RANK_WILDCARD);
     prte_pmix_server_clear(&pname);
+    pmix_server_prefetch_purge(jdata->nspace);
 
     /* cleanup the procs as these are gone */
-    for (i = 0; i < prte_local_children->size; i++) {
-        if (NULL == (proc = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children, i))) {
-            continue;
-        }
-        /* if this child is part of the job... */
-        if (PMIX_CHECK_NSPACE(proc->name.nspace, jdata->nspace)) {
-            /* clear the entry in the local children */
-            prte_pointer_array_set_item(prte_local_children, i, NULL);
-            PRTE_RELEASE(proc); // maintain accounting
-        }
-    }
+    prte_remove_local_children(jdata);
 
     /* tell the IOF that the job is complete */
     if (NULL != prte_iof.complete) {
@@ -650,7 +642,7 @@ static void check_complete(int fd, short args, void *cbdata)
         /* if we fell thru to this point, then nobody is still
          * alive except the daemons, so just shut us down */
         prte_plm.terminate_orteds();
-        PRTE_RELEASE(caddy);
+        PRTE_STATE_CADDY_RELEASE(caddy);
         return;
     }
 
@@ -731,6 +723,8 @@ release:
                 /* release the proc once for the map entry */
                 PRTE_RELEASE(proc);
             }
+            /* its slots are available again */
+            prte_rmaps_base_free_index_mark(node);
             /* set the node location to NULL */
             prte_pointer_array_set_item(map->nodes, index, NULL);
             /* maintain accounting */
@@ -785,7 +779,7 @@ release:
         jdata->state = PRTE_JOB_STATE_NOTIFIED;
     }
 
-    PRTE_RELEASE(caddy);
+    PRTE_STATE_CADDY_RELEASE(caddy);
 }
 
 static void cleanup_job(int sd, short args, void *cbdata)
@@ -799,7 +793,7 @@ static void cleanup_job(int sd, short args, void *cbdata)
         prte_plm.terminate_orteds();
     }
 
-    PRTE_RELEASE(caddy);
+    PRTE_STATE_CADDY_RELEASE(caddy);
 }
 
 static void dvm_notify(int sd, short args, void *cbdata)
@@ -814,7 +808,9 @@ static void dvm_notify(int sd, short args, void *cbdata)
     bool notify = true, flag;
     pmix_proc_t *proc, pnotify;
     pmix_info_t *info;
-    size_t ninfo;
+    size_t ninfo, n;
+    uint32_t asize, *asptr = &asize, afailed = 0, *afptr = &afailed;
+    bool array;
     pmix_proc_t pname;
     pmix_data_buffer_t pbkt;
     pmix_data_range_t range = PMIX_RANGE_SESSION;
@@ -857,11 +853,20 @@ static void dvm_notify(int sd, short args, void *cbdata)
         if (PRTE_SUCCESS != rc) {
             errmsg = prte_dump_aborted_procs(jdata);
         }
+        /* a job array reports how many of its elements failed */
+        array = prte_get_attribute(&jdata->attributes, PRTE_JOB_ARRAY_SIZE, (void **) &asptr,
+                                   PMIX_UINT32);
+        if (array) {
+            prte_get_attribute(&jdata->attributes, PRTE_JOB_ARRAY_NUM_FAILED, (void **) &afptr,
+                               PMIX_UINT32);
+        }
         /* construct the info to be provided */
-        if (NULL == errmsg) {
-            ninfo = 3;
-        } else {
-            ninfo = 4;
+        ninfo = 3;
+        if (NULL != errmsg) {
+            ++ninfo;
+        }
+        if (array) {
+            ninfo += 2;
         }
         PMIX_INFO_CREATE(info, ninfo);
         /* ensure this only goes to the job terminated event handler */
@@ -877,9 +882,15 @@ static void dvm_notify(int sd, short args, void *cbdata)
             pname.rank = PMIX_RANK_WILDCARD;
         }
         PMIX_INFO_LOAD(&info[2], PMIX_EVENT_AFFECTED_PROC, &pname, PMIX_PROC);
+        n = 3;
         if (NULL != errmsg) {
-            PMIX_INFO_LOAD(&info[3], PMIX_EVENT_TEXT_MESSAGE, errmsg, PMIX_STRING);
+            PMIX_INFO_LOAD(&info[n], PMIX_EVENT_TEXT_MESSAGE, errmsg, PMIX_STRING);
             free(errmsg);
+            ++n;
+        }
+        if (array) {
+            PMIX_INFO_LOAD(&info[n], PRTE_PMIX_JOB_ARRAY, &asize, PMIX_UINT32);
+            PMIX_INFO_LOAD(&info[n + 1], PRTE_PMIX_JOB_ARRAY_FAILED, &afailed, PMIX_UINT32);
         }
 
         /* pack the info for sending */
@@ -990,7 +1001,7 @@ static void dvm_notify(int sd, short args, void *cbdata)
     prte_grpcomm.xcast(&sig, PRTE_RML_TAG_DAEMON, reply);
     PMIX_DATA_BUFFER_RELEASE(reply);
     PMIX_PROC_FREE(sig.signature, 1);
-    PRTE_RELEASE(caddy);
+    PRTE_STATE_CADDY_RELEASE(caddy);
 
     // We are done with our use of job data and have notified the other daemons
     if (notify) {
@@ -28,6 +28,7 @@
 #include "src/mca/rmaps/rmaps_types.h"
 #include "src/mca/rml/rml.h"
 #include "src/mca/routed/routed.h"
+#include "src/prted/pmix/pmix_server.h"
 #include "src/prted/pmix/pmix_server_internal.h"
 #include "src/runtime/prte_data_server.h"
 #include "src/runtime/prte_quit.h"
@@ -61,12 +62,12 @@ prte_state_base_module_t prte_state_prted_module = {init,
                                                     prte_state_base_add_proc_state,
                                                     prte_state_base_set_proc_state_callback,
                                                     prte_state_base_set_proc_state_priority,
-                                                    prte_state_base_remove_proc_state};
+                                                    prte_state_base_remove_proc_state,
+                                                    prte_state_base_activate_proc_state_batch};
 
 /* Local functions */
 static void track_jobs(int fd, short argc, void *cbdata);
 static void track_procs(int fd, short argc, void *cbdata);
-static int pack_state_update(pmix_data_buffer_t *buf, prte_job_t *jdata);
 
 /* defined default state machines */
 static prte_job_state_t job_states[] = {PRTE_JOB_STATE_LOCAL_LAUNCH_COMPLETE,
@@ -169,6 +170,9 @@ static void track_jobs(int fd, short argc, void *cbdata)
                              "%s state:prted:track_jobs sending local launch complete for job %s",
                              PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                              PRTE_JOBID_PRINT(caddy->jdata->nspace)));
+        /* all our procs are up - go get whatever data they
+         * told us they will need */
+        pmix_server_prefetch(caddy->jdata);
         /* update the HNP with all proc states for this job */
         PMIX_DATA_BUFFER_CREATE(alert);
         /* pack update state command */
@@ -295,7 +299,7 @@ static void track_jobs(int fd, short argc, void *cbdata)
     }
 
 cleanup:
-    PRTE_RELEASE(caddy);
+    PRTE_STATE_CADDY_RELEASE(caddy);
 }
 
 static void opcbfunc(pmix_status_t status, void *cbdata)
@@ -506,53 +510,27 @@ static void track_procs(int fd, short argc, void *cbdata)
         /* track job status */
         if (jdata->num_terminated == jdata->num_local_procs
             && !prte_get_attribute(&jdata->attributes, PRTE_JOB_TERM_NOTIFIED, NULL, PMIX_BOOL)) {
-            /* pack update state command */
-            cmd = PRTE_PLM_UPDATE_PROC_STATE;
-            PMIX_DATA_BUFFER_CREATE(alert);
-            rc = PMIx_Data_pack(NULL, alert, &cmd, 1, PMIX_UINT8);
-            if (PMIX_SUCCESS != rc) {
-                PMIX_ERROR_LOG(rc);
-                PMIX_DATA_BUFFER_RELEASE(alert);
-                goto cleanup;
-            }
-            /* pack the job info */
-            if (PRTE_SUCCESS != (rc = pack_state_update(alert, jdata))) {
-                PRTE_ERROR_LOG(rc);
-                PMIX_DATA_BUFFER_RELEASE(alert);
-                goto cleanup;
-            }
-            /* send it */
+            /* report the final state of our local procs - the report may
+             * be held briefly so it can be combined with others */
             PRTE_OUTPUT_VERBOSE((5, prte_state_base_framework.framework_output,
                                  "%s state:prted: SENDING JOB LOCAL TERMINATION UPDATE FOR JOB %s",
                                  PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                                  PRTE_JOBID_PRINT(jdata->nspace)));
-            if (0 > (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, alert, PRTE_RML_TAG_PLM,
-                                                  prte_rml_send_callback, NULL))) {
+            if (PRTE_SUCCESS != (rc = prte_state_base_report_proc_states(jdata))) {
                 PRTE_ERROR_LOG(rc);
             }
             /* mark that we sent it so we ensure we don't do it again */
             prte_set_attribute(&jdata->attributes, PRTE_JOB_TERM_NOTIFIED, PRTE_ATTR_LOCAL, NULL,
                                PMIX_BOOL);
             /* cleanup the procs as these are gone */
-            for (i = 0; i < prte_local_children->size; i++) {
-                if (NULL
-                    == (pptr = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children,
-                                                                           i))) {
-                    continue;
-                }
-                /* if this child is part of the job... */
-                if (PMIX_CHECK_NSPACE(pptr->name.nspace, jdata->nspace)) {
-                    /* clear the entry in the local children */
-                    prte_pointer_array_set_item(prte_local_children, i, NULL);
-                    PRTE_RELEASE(pptr); // maintain accounting
-                }
-            }
+            prte_remove_local_children(jdata);
             /* tell the IOF that the job is complete */
             if (NULL != prte_iof.complete) {
                 prte_iof.complete(jdata);
             }
 
             /* tell the PMIx subsystem the job is complete */
+            pmix_server_prefetch_purge(jdata->nspace);
             PRTE_PMIX_CONSTRUCT_LOCK(&lock);
             PMIx_server_deregister_nspace(jdata->nspace, opcbfunc, &lock);
             PRTE_PMIX_WAIT_THREAD(&lock);
@@ -623,71 +601,5 @@ static void track_procs(int fd, short argc, void *cbdata)
     }
 
 cleanup:
-    PRTE_RELEASE(caddy);
-}
-
-static int pack_state_for_proc(pmix_data_buffer_t *alert, prte_proc_t *child)
-{
-    int rc;
-
-    /* pack the child's vpid */
-    rc = PMIx_Data_pack(NULL, alert, &child->name.rank, 1, PMIX_PROC_RANK);
-    if (PMIX_SUCCESS != rc) {
-        PMIX_ERROR_LOG(rc);
-        return rc;
-    }
-    /* pack the pid */
-    rc = PMIx_Data_pack(NULL, alert, &child->pid, 1, PMIX_PID);
-    if (PMIX_SUCCESS != rc) {
-        PMIX_ERROR_LOG(rc);
-        return rc;
-    }
-    /* pack its state */
-    rc = PMIx_Data_pack(NULL, alert, &child->state, 1, PMIX_UINT32);
-    if (PMIX_SUCCESS != rc) {
-        PMIX_ERROR_LOG(rc);
-        return rc;
-    }
-    /* pack its exit code */
-    rc = PMIx_Data_pack(NULL, alert, &child->exit_code, 1, PMIX_INT32);
-    if (PMIX_SUCCESS != rc) {
-        PMIX_ERROR_LOG(rc);
-        return rc;
-    }
-
-    return PRTE_SUCCESS;
-}
-
-static int pack_state_update(pmix_data_buffer_t *alert, prte_job_t *jdata)
-{
-    int i, rc;
-    prte_proc_t *child;
-    pmix_rank_t null = PMIX_RANK_INVALID;
-
-    /* pack the jobid */
-    rc = PMIx_Data_pack(NULL, alert, &jdata->nspace, 1, PMIX_PROC_NSPACE);
-    if (PMIX_SUCCESS != rc) {
-        PMIX_ERROR_LOG(rc);
-        return rc;
-    }
-    for (i = 0; i < prte_local_children->size; i++) {
-        if (NULL == (child = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children, i))) {
-            continue;
-        }
-        /* if this child is part of the job... */
-        if (PMIX_CHECK_NSPACE(child->name.nspace, jdata->nspace)) {
-            if (PRTE_SUCCESS != (rc = pack_state_for_proc(alert, child))) {
-                PRTE_ERROR_LOG(rc);
-                return rc;
-            }
-        }
-    }
-    /* flag that this job is complete so the receiver can know */
-    rc = PMIx_Data_pack(NULL, alert, &null, 1, PMIX_PROC_RANK);
-    if (PMIX_SUCCESS != rc) {
-        PMIX_ERROR_LOG(rc);
-        return rc;
-    }
-
-    return PRTE_SUCCESS;
+    PRTE_STATE_CADDY_RELEASE(caddy);
 }
@@ -111,6 +111,29 @@ PRTE_EXPORT extern prte_mca_base_framework_t prte_state_base_framework;
         prte_state.activate_proc_state(shadow, (s));                                 \
     } while (0);
 
+#define PRTE_ACTIVATE_PROC_STATE_BATCH(p, n, s)                                        \
+    do {                                                                               \
+        pmix_proc_t *shadow = (p);                                                     \
+        if (prte_state_base_framework.framework_verbose > 0) {                         \
+            double timestamp = 0.0;                                                    \
+            PRTE_STATE_GET_TIMESTAMP(timestamp);                                       \
+            prte_output_verbose(1, prte_state_base_framework.framework_output,         \
+                                "%s [%f] ACTIVATE %lu PROCS STATE %s AT %s:%d",        \
+                                PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), timestamp,         \
+                                (unsigned long) (n), prte_proc_state_to_str((s)),      \
+                                __FILE__, __LINE__);                                   \
+        }                                                                              \
+        prte_state.activate_proc_state_batch(shadow, (n), (s));                        \
+    } while (0);
+
+/* Return a caddy delivered to a state callback so it can be reused
+ * by a later activation. Callbacks may also simply PRTE_RELEASE the
+ * caddy - it is then freed instead of being recycled. */
+#define PRTE_STATE_CADDY_RELEASE(c) prte_state_base_return_caddy((c))
+
+PRTE_EXPORT prte_state_caddy_t *prte_state_base_get_caddy(void);
+PRTE_EXPORT void prte_state_base_return_caddy(prte_state_caddy_t *caddy);
+
 /* Called when actually arriving (reaching) the state with priority k */
 #define PRTE_REACHING_JOB_STATE(j, s, k)                                                      \
     do {                                                                                      \
@@ -243,6 +266,18 @@ typedef int (*prte_state_base_module_remove_job_state_fn_t)(prte_job_state_t sta
 typedef void (*prte_state_base_module_activate_proc_state_fn_t)(pmix_proc_t *proc,
                                                                 prte_proc_state_t state);
 
+/* Activate the same proc state for a set of procs.
+ *
+ * Equivalent to activating the state for each proc in turn, except that
+ * a single event is used to deliver the whole set - the callback for the
+ * state is invoked once per proc, in order, from within that event. The
+ * ERROR/ANY fallback rules are the same as for activate_proc_state. The
+ * array of procs is copied, so the caller retains ownership of it.
+ */
+typedef void (*prte_state_base_module_activate_proc_state_batch_fn_t)(pmix_proc_t *procs,
+                                                                      size_t nprocs,
+                                                                      prte_proc_state_t state);
+
 /* Add a state to the proc state machine.
  *
  */
@@ -286,6 +321,7 @@ struct prte_state_base_module_1_0_0_t {
     prte_state_base_module_set_proc_state_callback_fn_t set_proc_state_callback;
     prte_state_base_module_set_proc_state_priority_fn_t set_proc_state_priority;
     prte_state_base_module_remove_proc_state_fn_t remove_proc_state;
+    prte_state_base_module_activate_proc_state_batch_fn_t activate_proc_state_batch;
 };
 typedef struct prte_state_base_module_1_0_0_t prte_state_base_module_1_0_0_t;
 typedef prte_state_base_module_1_0_0_t prte_state_base_module_t;
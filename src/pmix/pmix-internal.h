@@ -444,6 +444,18 @@ static inline __prte_attribute_always_inline__ void pmix_proc_hton_intr(pmix_pro
 
 #define PRTE_PMIX_SHOW_HELP "prte.show.help"
 
+/* job arrays - the number of elements (uint32_t) requested at spawn,
+ * and the number of elements that failed (uint32_t) as reported in
+ * the job-end event once the whole array has completed */
+#define PRTE_PMIX_JOB_ARRAY        "prte.job.array"
+#define PRTE_PMIX_JOB_ARRAY_FAILED "prte.job.array.failed"
+
+/* modex prefetch - at spawn, a string naming the peers each proc will
+ * talk to ("ranks:K" or "nodes:G") so their data can be fetched ahead
+ * of the first request. In a direct modex request, a bool marking the
+ * request as a prefetch */
+#define PRTE_PMIX_DMODEX_PREFETCH "prte.dmodex.prefetch"
+
 /* PRTE attribute */
 typedef uint16_t prte_attribute_key_t;
 #define PRTE_ATTR_KEY_T PRTE_UINT16
@@ -269,6 +269,7 @@ static prte_regattr_input_t prte_attributes[] = {
 static void send_error(int status, pmix_proc_t *idreq, pmix_proc_t *remote, int remote_room);
 static void _mdxresp(int sd, short args, void *cbdata);
 static void modex_resp(pmix_status_t status, char *data, size_t sz, void *cbdata);
+static void dmdx_flush(int sd, short args, void *cbdata);
 
 void pmix_server_register_params(void)
 {
@@ -337,6 +338,55 @@ void pmix_server_register_params(void)
                                       PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
                                       PRTE_MCA_BASE_VAR_SCOPE_ALL,
                                       &prte_pmix_server_globals.system_server);
+
+    /* whether or not to only pass proc-level data for local procs */
+    prte_pmix_server_globals.compact_registration = false;
+    (void) prte_mca_base_var_register(
+        "prte", "pmix", NULL, "compact_registration",
+        "Only pass proc-level data for local procs when registering a job's nspace with the "
+        "PMIx server - the location of remote procs is derived from the node and proc maps. "
+        "Other proc-level keys of a remote proc (e.g., PMIX_APPNUM, PMIX_APP_RANK, "
+        "PMIX_GLOBAL_RANK, PMIX_LOCAL_RANK, PMIX_NODE_RANK, PMIX_PARENT_ID) are NOT available "
+        "to the job's procs, as direct modex only returns data a proc has committed - only "
+        "use this for applications that do not query them",
+        PRTE_MCA_BASE_VAR_TYPE_BOOL, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
+        PRTE_MCA_BASE_VAR_SCOPE_ALL, &prte_pmix_server_globals.compact_registration);
+
+    /* how long to collect direct modex traffic to a daemon before sending it */
+    prte_pmix_server_globals.dmdx_batch_delay = 0;
+    (void) prte_mca_base_var_register(
+        "prte", "pmix", NULL, "server_dmodex_batch_delay",
+        "Time (in usec) to collect direct modex requests and responses for a daemon so they "
+        "can be sent in a single message (0 = send once the current events have been processed)",
+        PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
+        PRTE_MCA_BASE_VAR_SCOPE_ALL, &prte_pmix_server_globals.dmdx_batch_delay);
+    if (0 > prte_pmix_server_globals.dmdx_batch_delay) {
+        prte_pmix_server_globals.dmdx_batch_delay = 0;
+    }
+    prte_pmix_server_globals.dmdx_batch_max = 256;
+    (void) prte_mca_base_var_register(
+        "prte", "pmix", NULL, "server_dmodex_batch_max",
+        "Maximum number of direct modex requests or responses to send in a single message",
+        PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
+        PRTE_MCA_BASE_VAR_SCOPE_ALL, &prte_pmix_server_globals.dmdx_batch_max);
+    if (1 > prte_pmix_server_globals.dmdx_batch_max) {
+        prte_pmix_server_globals.dmdx_batch_max = 1;
+    }
+
+    /* how much of the request hotel a modex prefetch may fill */
+    prte_pmix_server_globals.prefetch_max_pct = 50;
+    (void) prte_mca_base_var_register(
+        "prte", "pmix", NULL, "server_prefetch_max_rooms",
+        "Maximum percentage of the direct modex request slots (see server_max_reqs) that may "
+        "be in use when a modex prefetch issues its requests - the remaining slots are kept "
+        "free for requests from local clients",
+        PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
+        PRTE_MCA_BASE_VAR_SCOPE_ALL, &prte_pmix_server_globals.prefetch_max_pct);
+    if (0 > prte_pmix_server_globals.prefetch_max_pct) {
+        prte_pmix_server_globals.prefetch_max_pct = 0;
+    } else if (100 < prte_pmix_server_globals.prefetch_max_pct) {
+        prte_pmix_server_globals.prefetch_max_pct = 100;
+    }
 }
 
 static void eviction_cbfunc(struct prte_hotel_t *hotel, int room_num, void *occupant)
@@ -397,7 +447,9 @@ static void eviction_cbfunc(struct prte_hotel_t *hotel, int room_num, void *occu
             return;
         }
         /* fall thru and return an error so the caller doesn't hang */
-    } else {
+    } else if (!req->prefetch) {
+        /* a peer that never provides the data it was expected to
+         * is not an error, so don't complain about prefetches */
         prte_show_help("help-prted.txt", "timedout", true, req->operation);
     }
 
@@ -517,6 +569,17 @@ int pmix_server_init(void)
     }
     PRTE_CONSTRUCT(&prte_pmix_server_globals.notifications, prte_list_t);
     prte_pmix_server_globals.server = *PRTE_NAME_INVALID;
+    PRTE_CONSTRUCT(&prte_pmix_server_globals.dmdx_reqs, prte_pointer_array_t);
+    prte_pointer_array_init(&prte_pmix_server_globals.dmdx_reqs, 16, INT_MAX, 16);
+    PRTE_CONSTRUCT(&prte_pmix_server_globals.dmdx_resps, prte_pointer_array_t);
+    prte_pointer_array_init(&prte_pmix_server_globals.dmdx_resps, 16, INT_MAX, 16);
+    PRTE_CONSTRUCT(&prte_pmix_server_globals.dmdx_pending, prte_list_t);
+    prte_event_evtimer_set(prte_event_base, &prte_pmix_server_globals.dmdx_ev, dmdx_flush, NULL);
+    prte_pmix_server_globals.dmdx_ev_active = false;
+    PRTE_CONSTRUCT(&prte_pmix_server_globals.prefetched, prte_hash_table_t);
+    prte_hash_table_init(&prte_pmix_server_globals.prefetched, 128);
+    prte_pmix_server_globals.prefetch_reqs = 0;
+    prte_pmix_server_globals.prefetch_hits = 0;
 
     PRTE_CONSTRUCT(&ilist, prte_list_t);
 
@@ -720,6 +783,8 @@ void pmix_server_start(void)
 
 void pmix_server_finalize(void)
 {
+    uint64_t nregs, nprocs, usec;
+
     if (!prte_pmix_server_globals.initialized) {
         return;
     }
@@ -737,6 +802,35 @@ void pmix_server_finalize(void)
         prte_rml.recv_cancel(PRTE_NAME_WILDCARD, PRTE_RML_TAG_LOGGING);
     }
 
+    /* anything not yet sent is of no use now */
+    if (prte_pmix_server_globals.dmdx_ev_active) {
+        prte_event_evtimer_del(&prte_pmix_server_globals.dmdx_ev);
+        prte_pmix_server_globals.dmdx_ev_active = false;
+    }
+    PRTE_LIST_DESTRUCT(&prte_pmix_server_globals.dmdx_pending);
+    PRTE_DESTRUCT(&prte_pmix_server_globals.dmdx_reqs);
+    PRTE_DESTRUCT(&prte_pmix_server_globals.dmdx_resps);
+    if (0 < prte_pmix_server_globals.dmdx_batches_sent[0]
+        || 0 < prte_pmix_server_globals.dmdx_batches_sent[1]) {
+        prte_output_verbose(1, prte_pmix_server_globals.output,
+                            "%s direct modex: sent %lu requests in %lu messages, "
+                            "%lu responses in %lu messages",
+                            PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                            (unsigned long) prte_pmix_server_globals.dmdx_msgs_sent[0],
+                            (unsigned long) prte_pmix_server_globals.dmdx_batches_sent[0],
+                            (unsigned long) prte_pmix_server_globals.dmdx_msgs_sent[1],
+                            (unsigned long) prte_pmix_server_globals.dmdx_batches_sent[1]);
+    }
+    if (0 < prte_pmix_server_globals.prefetch_reqs) {
+        prte_output_verbose(1, prte_pmix_server_globals.output,
+                            "%s modex prefetch: %lu requests, %lu hits",
+                            PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                            (unsigned long) prte_pmix_server_globals.prefetch_reqs,
+                            (unsigned long) prte_pmix_server_globals.prefetch_hits);
+    }
+    pmix_server_prefetch_purge(NULL);
+    PRTE_DESTRUCT(&prte_pmix_server_globals.prefetched);
+
     /* finalize our local data server */
     prte_data_server_finalize();
 
@@ -747,37 +841,318 @@ void pmix_server_finalize(void)
     PRTE_DESTRUCT(&prte_pmix_server_globals.reqs);
     PRTE_LIST_DESTRUCT(&prte_pmix_server_globals.notifications);
     PRTE_LIST_DESTRUCT(&prte_pmix_server_globals.psets);
+    pmix_server_registration_totals(&nregs, &nprocs, &usec);
+    prte_output_verbose(2, prte_pmix_server_globals.output,
+                        "%s nspace registration: %lu nspaces %lu proc entries in %lu usec",
+                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), (unsigned long) nregs,
+                        (unsigned long) nprocs, (unsigned long) usec);
+    pmix_server_purge_locality_cache();
     free(mytopology.source);
     prte_pmix_server_globals.initialized = false;
 }
 
-static void send_error(int status, pmix_proc_t *idreq, pmix_proc_t *remote, int remote_room)
+/*
+ * A direct modex request carries the target proc, the hotel room of the
+ * request on the requesting daemon and any qualifiers. The response
+ * carries the status, the target proc and the room, followed by the size
+ * and bytes of the data if the status is success.
+ */
+pmix_status_t pmix_server_dmdx_pack_request(pmix_data_buffer_t *buf, pmix_proc_t *tproc, int room,
+                                            pmix_info_t *info, size_t ninfo)
 {
-    pmix_data_buffer_t *reply;
-    pmix_status_t prc, pstatus;
+    pmix_status_t prc;
 
-    /* pack the status */
-    pstatus = prte_pmix_convert_rc(status);
-    PMIX_DATA_BUFFER_CREATE(reply);
-    if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, reply, &pstatus, 1, PMIX_STATUS))) {
+    if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, buf, tproc, 1, PMIX_PROC))
+        || PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, buf, &room, 1, PMIX_INT))
+        || PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, buf, &ninfo, 1, PMIX_SIZE))) {
+        return prc;
+    }
+    if (0 < ninfo) {
+        prc = PMIx_Data_pack(NULL, buf, info, ninfo, PMIX_INFO);
+    }
+    return prc;
+}
+
+pmix_status_t pmix_server_dmdx_unpack_request(pmix_data_buffer_t *buf, pmix_proc_t *tproc,
+                                              int *room, pmix_info_t **info, size_t *ninfo)
+{
+    pmix_status_t prc;
+    int32_t cnt;
+
+    *info = NULL;
+    *ninfo = 0;
+    cnt = 1;
+    if (PMIX_SUCCESS != (prc = PMIx_Data_unpack(NULL, buf, tproc, &cnt, PMIX_PROC))) {
+        return prc;
+    }
+    cnt = 1;
+    if (PMIX_SUCCESS != (prc = PMIx_Data_unpack(NULL, buf, room, &cnt, PMIX_INT))) {
+        return prc;
+    }
+    cnt = 1;
+    if (PMIX_SUCCESS != (prc = PMIx_Data_unpack(NULL, buf, ninfo, &cnt, PMIX_SIZE))) {
+        return prc;
+    }
+    if (0 < *ninfo) {
+        PMIX_INFO_CREATE(*info, *ninfo);
+        cnt = *ninfo;
+        prc = PMIx_Data_unpack(NULL, buf, *info, &cnt, PMIX_INFO);
+        if (PMIX_SUCCESS == prc && (size_t) cnt != *ninfo) {
+            prc = PMIX_ERR_UNPACK_READ_PAST_END_OF_BUFFER;
+        }
+        if (PMIX_SUCCESS != prc) {
+            PMIX_INFO_FREE(*info, *ninfo);
+            *info = NULL;
+            *ninfo = 0;
+        }
+    }
+    return prc;
+}
+
+pmix_status_t pmix_server_dmdx_pack_response(pmix_data_buffer_t *buf, pmix_status_t status,
+                                             pmix_proc_t *tproc, int room, char *data, size_t sz)
+{
+    pmix_status_t prc;
+
+    if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, buf, &status, 1, PMIX_STATUS))
+        || PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, buf, tproc, 1, PMIX_PROC))
+        || PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, buf, &room, 1, PMIX_INT))) {
+        return prc;
+    }
+    if (PMIX_SUCCESS != status) {
+        return PMIX_SUCCESS;
+    }
+    if (NULL == data) {
+        sz = 0;
+    }
+    if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, buf, &sz, 1, PMIX_SIZE))) {
+        return prc;
+    }
+    if (0 < sz) {
+        prc = PMIx_Data_pack(NULL, buf, data, sz, PMIX_BYTE);
+    }
+    return prc;
+}
+
+pmix_status_t pmix_server_dmdx_unpack_response(pmix_data_buffer_t *buf, pmix_status_t *status,
+                                               pmix_proc_t *tproc, int *room, char **data,
+                                               size_t *sz)
+{
+    pmix_status_t prc;
+    int32_t cnt;
+
+    *data = NULL;
+    *sz = 0;
+    cnt = 1;
+    if (PMIX_SUCCESS != (prc = PMIx_Data_unpack(NULL, buf, status, &cnt, PMIX_STATUS))) {
+        return prc;
+    }
+    cnt = 1;
+    if (PMIX_SUCCESS != (prc = PMIx_Data_unpack(NULL, buf, tproc, &cnt, PMIX_PROC))) {
+        return prc;
+    }
+    cnt = 1;
+    if (PMIX_SUCCESS != (prc = PMIx_Data_unpack(NULL, buf, room, &cnt, PMIX_INT))) {
+        return prc;
+    }
+    if (PMIX_SUCCESS != *status) {
+        return PMIX_SUCCESS;
+    }
+    cnt = 1;
+    if (PMIX_SUCCESS != (prc = PMIx_Data_unpack(NULL, buf, sz, &cnt, PMIX_SIZE))) {
+        return prc;
+    }
+    if (0 < *sz) {
+        if (NULL == (*data = (char *) malloc(*sz))) {
+            *sz = 0;
+            return PMIX_ERR_NOMEM;
+        }
+        cnt = *sz;
+        prc = PMIx_Data_unpack(NULL, buf, *data, &cnt, PMIX_BYTE);
+        if (PMIX_SUCCESS == prc && (size_t) cnt != *sz) {
+            prc = PMIX_ERR_UNPACK_READ_PAST_END_OF_BUFFER;
+        }
+        if (PMIX_SUCCESS != prc) {
+            free(*data);
+            *data = NULL;
+            *sz = 0;
+        }
+    }
+    return prc;
+}
+
+/* a batch is the number of messages followed by the messages themselves */
+pmix_status_t pmix_server_dmdx_pack_batch(pmix_data_buffer_t *buf, int32_t nmsgs,
+                                          pmix_data_buffer_t *msgs)
+{
+    pmix_status_t prc;
+
+    if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, buf, &nmsgs, 1, PMIX_INT32))) {
+        return prc;
+    }
+    return PMIx_Data_copy_payload(buf, msgs);
+}
+
+/*
+ * Direct modex traffic is batched per daemon: requests (and responses)
+ * for the same daemon are collected until the current events have been
+ * processed, or for pmix_server_dmodex_batch_delay usec, and then sent as
+ * a single message. This coalesces the requests of all local clients,
+ * which at startup tend to ask the same remote daemons about many procs.
+ */
+typedef struct {
+    prte_list_item_t super;
+    pmix_proc_t target;
+    prte_rml_tag_t tag;
+    pmix_data_buffer_t msgs;
+    int32_t nmsgs;
+    int *rooms;
+} dmdx_batch_t;
+static void dbcon(dmdx_batch_t *p)
+{
+    PMIX_DATA_BUFFER_CONSTRUCT(&p->msgs);
+    p->nmsgs = 0;
+    p->rooms = NULL;
+}
+static void dbdes(dmdx_batch_t *p)
+{
+    PMIX_DATA_BUFFER_DESTRUCT(&p->msgs);
+    if (NULL != p->rooms) {
+        free(p->rooms);
+    }
+}
+static PRTE_CLASS_INSTANCE(dmdx_batch_t, prte_list_item_t, dbcon, dbdes);
+
+static void dmdx_send_batch(dmdx_batch_t *batch)
+{
+    pmix_data_buffer_t *buf;
+    pmix_server_req_t *req;
+    pmix_status_t prc;
+    int rc, n, dir;
+
+    dir = (PRTE_RML_TAG_DIRECT_MODEX == batch->tag) ? 0 : 1;
+    prte_pointer_array_set_item((0 == dir) ? &prte_pmix_server_globals.dmdx_reqs
+                                           : &prte_pmix_server_globals.dmdx_resps,
+                                batch->target.rank, NULL);
+    prte_list_remove_item(&prte_pmix_server_globals.dmdx_pending, &batch->super);
+
+    prte_output_verbose(2, prte_pmix_server_globals.output, "%s direct modex: sending %d %s to %s",
+                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), batch->nmsgs,
+                        (0 == dir) ? "requests" : "responses", PRTE_NAME_PRINT(&batch->target));
+
+    PMIX_DATA_BUFFER_CREATE(buf);
+    if (PMIX_SUCCESS != (prc = pmix_server_dmdx_pack_batch(buf, batch->nmsgs, &batch->msgs))) {
         PMIX_ERROR_LOG(prc);
-        return;
+        PMIX_DATA_BUFFER_RELEASE(buf);
+        rc = prte_pmix_convert_status(prc);
+    } else if (PRTE_SUCCESS
+               != (rc = prte_rml.send_buffer_nb(&batch->target, buf, batch->tag,
+                                                prte_rml_send_callback, NULL))) {
+        PRTE_ERROR_LOG(rc);
+        PMIX_DATA_BUFFER_RELEASE(buf);
+    } else {
+        prte_pmix_server_globals.dmdx_msgs_sent[dir] += batch->nmsgs;
+        prte_pmix_server_globals.dmdx_batches_sent[dir]++;
+    }
+
+    if (PRTE_SUCCESS != rc && NULL != batch->rooms) {
+        /* let the requestors know we couldn't get their data */
+        for (n = 0; n < batch->nmsgs; n++) {
+            prte_hotel_checkout_and_return_occupant(&prte_pmix_server_globals.reqs,
+                                                    batch->rooms[n], (void **) &req);
+            if (NULL == req) {
+                continue;
+            }
+            if (NULL != req->mdxcbfunc) {
+                req->mdxcbfunc(prte_pmix_convert_rc(rc), NULL, 0, req->cbdata, NULL, NULL);
+            }
+            PRTE_RELEASE(req);
+        }
+    }
+    PRTE_RELEASE(batch);
+}
+
+static void dmdx_flush(int sd, short args, void *cbdata)
+{
+    prte_pmix_server_globals.dmdx_ev_active = false;
+    while (0 < prte_list_get_size(&prte_pmix_server_globals.dmdx_pending)) {
+        dmdx_send_batch((dmdx_batch_t *) prte_list_get_first(&prte_pmix_server_globals.dmdx_pending));
+    }
+}
+
+void pmix_server_dmdx_queue(pmix_proc_t *dmn, prte_rml_tag_t tag, pmix_data_buffer_t *msg,
+                            int room)
+{
+    prte_pointer_array_t *batches;
+    dmdx_batch_t *batch;
+    pmix_server_req_t *req;
+    pmix_status_t prc;
+    struct timeval tv;
+
+    batches = (PRTE_RML_TAG_DIRECT_MODEX == tag) ? &prte_pmix_server_globals.dmdx_reqs
+                                                 : &prte_pmix_server_globals.dmdx_resps;
+    batch = (dmdx_batch_t *) prte_pointer_array_get_item(batches, dmn->rank);
+    if (NULL == batch) {
+        batch = PRTE_NEW(dmdx_batch_t);
+        batch->target = *dmn;
+        batch->tag = tag;
+        if (PRTE_RML_TAG_DIRECT_MODEX == tag) {
+            batch->rooms = (int *) malloc(prte_pmix_server_globals.dmdx_batch_max * sizeof(int));
+        }
+        prte_pointer_array_set_item(batches, dmn->rank, batch);
+        prte_list_append(&prte_pmix_server_globals.dmdx_pending, &batch->super);
     }
-    /* pack the id of the requested proc */
-    if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, reply, idreq, 1, PMIX_PROC))) {
+
+    prc = PMIx_Data_copy_payload(&batch->msgs, msg);
+    PMIX_DATA_BUFFER_RELEASE(msg);
+    if (PMIX_SUCCESS != prc) {
         PMIX_ERROR_LOG(prc);
+        if (0 <= room) {
+            /* let the requestor know we couldn't get their data */
+            prte_hotel_checkout_and_return_occupant(&prte_pmix_server_globals.reqs, room,
+                                                    (void **) &req);
+            if (NULL != req) {
+                if (NULL != req->mdxcbfunc) {
+                    req->mdxcbfunc(prc, NULL, 0, req->cbdata, NULL, NULL);
+                }
+                PRTE_RELEASE(req);
+            }
+        }
         return;
     }
+    if (NULL != batch->rooms) {
+        batch->rooms[batch->nmsgs] = room;
+    }
+    batch->nmsgs++;
+
+    if (batch->nmsgs >= prte_pmix_server_globals.dmdx_batch_max) {
+        dmdx_send_batch(batch);
+    } else if (!prte_pmix_server_globals.dmdx_ev_active) {
+        prte_pmix_server_globals.dmdx_ev_active = true;
+        tv.tv_sec = prte_pmix_server_globals.dmdx_batch_delay / 1000000;
+        tv.tv_usec = prte_pmix_server_globals.dmdx_batch_delay % 1000000;
+        prte_event_evtimer_add(&prte_pmix_server_globals.dmdx_ev, &tv);
+    }
+}
+
+static void send_error(int status, pmix_proc_t *idreq, pmix_proc_t *remote, int remote_room)
+{
+    pmix_data_buffer_t *reply;
+    pmix_status_t prc, pstatus;
 
-    /* pack the remote daemon's request room number */
-    if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, reply, &remote_room, 1, PMIX_INT))) {
+    /* pack the status, the id of the requested proc and the
+     * remote daemon's request room number */
+    pstatus = prte_pmix_convert_rc(status);
+    PMIX_DATA_BUFFER_CREATE(reply);
+    if (PMIX_SUCCESS
+        != (prc = pmix_server_dmdx_pack_response(reply, pstatus, idreq, remote_room, NULL, 0))) {
         PMIX_ERROR_LOG(prc);
+        PMIX_DATA_BUFFER_RELEASE(reply);
         return;
     }
 
     /* send the response */
-    prte_rml.send_buffer_nb(remote, reply, PRTE_RML_TAG_DIRECT_MODEX_RESP, prte_rml_send_callback,
-                            NULL);
+    pmix_server_dmdx_queue(remote, PRTE_RML_TAG_DIRECT_MODEX_RESP, reply, -1);
 }
 
 static void _mdxresp(int sd, short args, void *cbdata)
@@ -794,42 +1169,23 @@ static void _mdxresp(int sd, short args, void *cbdata)
     /* check us out of the hotel */
     prte_hotel_checkout(&prte_pmix_server_globals.reqs, req->room_num);
 
-    /* pack the status */
+    /* pack the status, the id of the requested proc, the remote
+     * daemon's request room number and any provided data */
     PMIX_DATA_BUFFER_CREATE(reply);
-    if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, reply, &req->pstatus, 1, PMIX_STATUS))) {
-        PMIX_ERROR_LOG(prc);
-        goto error;
+    prc = pmix_server_dmdx_pack_response(reply, req->pstatus, &req->tproc, req->remote_room_num,
+                                         req->data, req->sz);
+    if (NULL != req->data) {
+        free(req->data);
+        req->data = NULL;
     }
-    /* pack the id of the requested proc */
-    if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, reply, &req->tproc, 1, PMIX_PROC))) {
+    if (PMIX_SUCCESS != prc) {
         PMIX_ERROR_LOG(prc);
+        PMIX_DATA_BUFFER_RELEASE(reply);
         goto error;
     }
 
-    /* pack the remote daemon's request room number */
-    if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, reply, &req->remote_room_num, 1, PMIX_INT))) {
-        PMIX_ERROR_LOG(prc);
-        goto error;
-    }
-    if (PMIX_SUCCESS == req->pstatus) {
-        /* return any provided data */
-        if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, reply, &req->sz, 1, PMIX_SIZE))) {
-            PMIX_ERROR_LOG(prc);
-            goto error;
-        }
-        if (0 < req->sz) {
-            if (PMIX_SUCCESS
-                != (prc = PMIx_Data_pack(NULL, reply, req->data, req->sz, PMIX_BYTE))) {
-                PMIX_ERROR_LOG(prc);
-                goto error;
-            }
-            free(req->data);
-        }
-    }
-
     /* send the response */
-    prte_rml.send_buffer_nb(&req->proxy, reply, PRTE_RML_TAG_DIRECT_MODEX_RESP,
-                            prte_rml_send_callback, NULL);
+    pmix_server_dmdx_queue(&req->proxy, PRTE_RML_TAG_DIRECT_MODEX_RESP, reply, -1);
 
 error:
     PRTE_RELEASE(req);
@@ -860,11 +1216,9 @@ static void modex_resp(pmix_status_t status, char *data, size_t sz, void *cbdata
     PRTE_POST_OBJECT(req);
     prte_event_active(&(req->ev), PRTE_EV_WRITE, 1);
 }
-static void pmix_server_dmdx_recv(int status, pmix_proc_t *sender, pmix_data_buffer_t *buffer,
-                                  prte_rml_tag_t tg, void *cbdata)
+static pmix_status_t dmdx_request(pmix_proc_t *sender, pmix_data_buffer_t *buffer)
 {
     int rc, room_num;
-    int32_t cnt;
     prte_job_t *jdata;
     prte_proc_t *proc;
     pmix_server_req_t *req;
@@ -875,43 +1229,28 @@ static void pmix_server_dmdx_recv(int status, pmix_proc_t *sender, pmix_data_buf
     char *key = NULL;
     size_t sz;
     pmix_value_t *pval = NULL;
+    bool prefetch = false;
 
-    cnt = 1;
-    if (PMIX_SUCCESS != (prc = PMIx_Data_unpack(NULL, buffer, &pproc, &cnt, PMIX_PROC))) {
+    /* unpack the target proc, the remote daemon's tracking
+     * room number and any qualifiers */
+    prc = pmix_server_dmdx_unpack_request(buffer, &pproc, &room_num, &info, &ninfo);
+    if (PMIX_SUCCESS != prc) {
         PMIX_ERROR_LOG(prc);
-        return;
+        return prc;
     }
     prte_output_verbose(2, prte_pmix_server_globals.output,
                         "%s dmdx:recv request from proc %s for proc %s:%u",
                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_NAME_PRINT(sender), pproc.nspace,
                         pproc.rank);
-    /* and the remote daemon's tracking room number */
-    cnt = 1;
-    if (PMIX_SUCCESS != (prc = PMIx_Data_unpack(NULL, buffer, &room_num, &cnt, PMIX_INT))) {
-        PMIX_ERROR_LOG(prc);
-        return;
-    }
-    cnt = 1;
-    if (PMIX_SUCCESS != (prc = PMIx_Data_unpack(NULL, buffer, &ninfo, &cnt, PMIX_SIZE))) {
-        PMIX_ERROR_LOG(prc);
-        return;
-    }
-    if (0 < ninfo) {
-        PMIX_INFO_CREATE(info, ninfo);
-        cnt = ninfo;
-        if (PMIX_SUCCESS != (prc = PMIx_Data_unpack(NULL, buffer, info, &cnt, PMIX_INFO))) {
-            PMIX_ERROR_LOG(prc);
-            return;
-        }
-    }
 
     /* see if they want us to await a particular key before sending
-     * the response */
+     * the response, and if they are only prefetching */
     if (NULL != info) {
         for (sz = 0; sz < ninfo; sz++) {
             if (PMIX_CHECK_KEY(&info[sz], PMIX_REQUIRED_KEY)) {
                 key = info[sz].value.data.string;
-                break;
+            } else if (PMIX_CHECK_KEY(&info[sz], PRTE_PMIX_DMODEX_PREFETCH)) {
+                prefetch = PMIX_INFO_TRUE(&info[sz]);
             }
         }
     }
@@ -935,6 +1274,7 @@ static void pmix_server_dmdx_recv(int status, pmix_proc_t *sender, pmix_data_buf
             req->key = strdup(key);
         }
         req->remote_room_num = room_num;
+        req->prefetch = prefetch;
         /* adjust the timeout to reflect the size of the job as it can take some
          * amount of time to start the job */
         PRTE_ADJUST_TIMEOUT(req);
@@ -945,17 +1285,17 @@ static void pmix_server_dmdx_recv(int status, pmix_proc_t *sender, pmix_data_buf
             PRTE_RELEASE(req);
             send_error(rc, &pproc, sender, room_num);
         }
-        return;
+        return PMIX_SUCCESS;
     }
     if (NULL == (proc = (prte_proc_t *) prte_pointer_array_get_item(jdata->procs, pproc.rank))) {
         /* this is truly an error, so notify the sender */
         send_error(PRTE_ERR_NOT_FOUND, &pproc, sender, room_num);
-        return;
+        return PMIX_SUCCESS;
     }
     if (!PRTE_FLAG_TEST(proc, PRTE_PROC_FLAG_LOCAL)) {
         /* send back an error - they obviously have made a mistake */
         send_error(PRTE_ERR_NOT_FOUND, &pproc, sender, room_num);
-        return;
+        return PMIX_SUCCESS;
     }
 
     if (NULL != key) {
@@ -975,6 +1315,7 @@ static void pmix_server_dmdx_recv(int status, pmix_proc_t *sender, pmix_data_buf
             req->ninfo = ninfo;
             req->key = strdup(key);
             req->remote_room_num = room_num;
+            req->prefetch = prefetch;
             /* adjust the timeout to reflect the size of the job as it can take some
              * amount of time to start the job */
             PRTE_ADJUST_TIMEOUT(req);
@@ -991,7 +1332,7 @@ static void pmix_server_dmdx_recv(int status, pmix_proc_t *sender, pmix_data_buf
             prte_output_verbose(2, prte_pmix_server_globals.output,
                                 "%s:%d CHECKING REQ FOR KEY %s TO %d REMOTE ROOM %d", __FILE__,
                                 __LINE__, req->key, req->room_num, req->remote_room_num);
-            return;
+            return PMIX_SUCCESS;
         }
         /* we do already have it, so go get the payload */
         PMIX_VALUE_RELEASE(pval);
@@ -1009,6 +1350,7 @@ static void pmix_server_dmdx_recv(int status, pmix_proc_t *sender, pmix_data_buf
     req->info = info;
     req->ninfo = ninfo;
     req->remote_room_num = room_num;
+    req->prefetch = prefetch;
     /* adjust the timeout to reflect the size of the job as it can take some
      * amount of time to start the job */
     PRTE_ADJUST_TIMEOUT(req);
@@ -1018,7 +1360,7 @@ static void pmix_server_dmdx_recv(int status, pmix_proc_t *sender, pmix_data_buf
                        prte_pmix_server_globals.num_rooms);
         PRTE_RELEASE(req);
         send_error(rc, &pproc, sender, room_num);
-        return;
+        return PMIX_SUCCESS;
     }
 
     /* ask our local pmix server for the data */
@@ -1027,9 +1369,30 @@ static void pmix_server_dmdx_recv(int status, pmix_proc_t *sender, pmix_data_buf
         prte_hotel_checkout(&prte_pmix_server_globals.reqs, req->room_num);
         PRTE_RELEASE(req);
         send_error(rc, &pproc, sender, room_num);
+        return PMIX_SUCCESS;
+    }
+    return PMIX_SUCCESS;
+}
+
+static void pmix_server_dmdx_recv(int status, pmix_proc_t *sender, pmix_data_buffer_t *buffer,
+                                  prte_rml_tag_t tg, void *cbdata)
+{
+    int32_t n, nreqs, cnt;
+    pmix_status_t prc;
+
+    cnt = 1;
+    if (PMIX_SUCCESS != (prc = PMIx_Data_unpack(NULL, buffer, &nreqs, &cnt, PMIX_INT32))) {
+        PMIX_ERROR_LOG(prc);
         return;
     }
-    return;
+    prte_output_verbose(2, prte_pmix_server_globals.output,
+                        "%s dmdx:recv %d requests from %s", PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                        nreqs, PRTE_NAME_PRINT(sender));
+    for (n = 0; n < nreqs; n++) {
+        if (PMIX_SUCCESS != dmdx_request(sender, buffer)) {
+            return;
+        }
+    }
 }
 
 typedef struct {
@@ -1057,77 +1420,36 @@ static void relcbfunc(void *relcbdata)
     PRTE_RELEASE(d);
 }
 
-static void pmix_server_dmdx_resp(int status, pmix_proc_t *sender, pmix_data_buffer_t *buffer,
-                                  prte_rml_tag_t tg, void *cbdata)
+static pmix_status_t dmdx_response(pmix_proc_t *sender, pmix_data_buffer_t *buffer)
 {
     int room_num, rnum;
-    int32_t cnt;
     pmix_server_req_t *req;
     datacaddy_t *d;
     pmix_proc_t pproc;
     size_t psz;
     pmix_status_t prc, pret;
-
-    prte_output_verbose(2, prte_pmix_server_globals.output,
-                        "%s dmdx:recv response from proc %s with %d bytes",
-                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_NAME_PRINT(sender),
-                        (int) buffer->bytes_used);
+    bool prefetch = false, delivered = false;
 
     d = PRTE_NEW(datacaddy_t);
 
-    /* unpack the status */
-    cnt = 1;
-    if (PMIX_SUCCESS != (prc = PMIx_Data_unpack(NULL, buffer, &pret, &cnt, PMIX_STATUS))) {
+    /* unpack the status, the id of the target whose info we just
+     * received, our tracking room number and any data */
+    prc = pmix_server_dmdx_unpack_response(buffer, &pret, &pproc, &room_num, &d->data, &psz);
+    if (PMIX_SUCCESS != prc) {
         PMIX_ERROR_LOG(prc);
         PRTE_RELEASE(d);
-        return;
-    }
-
-    /* unpack the id of the target whose info we just received */
-    cnt = 1;
-    if (PMIX_SUCCESS != (prc = PMIx_Data_unpack(NULL, buffer, &pproc, &cnt, PMIX_PROC))) {
-        PMIX_ERROR_LOG(prc);
-        PRTE_RELEASE(d);
-        return;
-    }
-
-    /* unpack our tracking room number */
-    cnt = 1;
-    if (PMIX_SUCCESS != (prc = PMIx_Data_unpack(NULL, buffer, &room_num, &cnt, PMIX_INT))) {
-        PMIX_ERROR_LOG(prc);
-        PRTE_RELEASE(d);
-        return;
-    }
-
-    /* unload the remainder of the buffer */
-    if (PMIX_SUCCESS == pret) {
-        cnt = 1;
-        if (PMIX_SUCCESS != (prc = PMIx_Data_unpack(NULL, buffer, &psz, &cnt, PMIX_SIZE))) {
-            PMIX_ERROR_LOG(prc);
-            PRTE_RELEASE(d);
-            return;
-        }
-        if (0 < psz) {
-            d->ndata = psz;
-            d->data = (char *) malloc(psz);
-            if (NULL == d->data) {
-                PRTE_ERROR_LOG(PRTE_ERR_OUT_OF_RESOURCE);
-            }
-            cnt = psz;
-            if (PMIX_SUCCESS != (prc = PMIx_Data_unpack(NULL, buffer, d->data, &cnt, PMIX_BYTE))) {
-                PMIX_ERROR_LOG(prc);
-                PRTE_RELEASE(d);
-                return;
-            }
-        }
+        return prc;
     }
+    d->ndata = psz;
 
     /* check the request out of the tracking hotel */
     prte_hotel_checkout_and_return_occupant(&prte_pmix_server_globals.reqs, room_num,
                                             (void **) &req);
     /* return the returned data to the requestor */
     if (NULL != req) {
-        if (NULL != req->mdxcbfunc) {
+        if (req->prefetch) {
+            prefetch = true;
+        } else if (NULL != req->mdxcbfunc) {
             PRTE_RETAIN(d);
             req->mdxcbfunc(pret, d->data, d->ndata, req->cbdata, relcbfunc, d);
         }
@@ -1147,12 +1469,44 @@ static void pmix_server_dmdx_resp(int status, pmix_proc_t *sender, pmix_data_buf
             if (NULL != req->mdxcbfunc) {
                 PRTE_RETAIN(d);
                 req->mdxcbfunc(pret, d->data, d->ndata, req->cbdata, relcbfunc, d);
+                delivered = true;
             }
             prte_hotel_checkout(&prte_pmix_server_globals.reqs, rnum);
             PRTE_RELEASE(req);
         }
     }
+
+    /* a prefetch that clients joined while it was in flight has
+     * already reached the local server - otherwise hold the data
+     * until someone asks for it */
+    if (prefetch && !delivered && PMIX_SUCCESS == pret) {
+        pmix_server_prefetch_store(&pproc, d->data, d->ndata);
+    }
     PRTE_RELEASE(d); // maintain accounting
+    return PMIX_SUCCESS;
+}
+
+static void pmix_server_dmdx_resp(int status, pmix_proc_t *sender, pmix_data_buffer_t *buffer,
+                                  prte_rml_tag_t tg, void *cbdata)
+{
+    int32_t n, nresps, cnt;
+    pmix_status_t prc;
+
+    prte_output_verbose(2, prte_pmix_server_globals.output,
+                        "%s dmdx:recv response from proc %s with %d bytes",
+                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_NAME_PRINT(sender),
+                        (int) buffer->bytes_used);
+
+    cnt = 1;
+    if (PMIX_SUCCESS != (prc = PMIx_Data_unpack(NULL, buffer, &nresps, &cnt, PMIX_INT32))) {
+        PMIX_ERROR_LOG(prc);
+        return;
+    }
+    for (n = 0; n < nresps; n++) {
+        if (PMIX_SUCCESS != dmdx_response(sender, buffer)) {
+            return;
+        }
+    }
 }
 
 static void pmix_server_log(int status, pmix_proc_t *sender, pmix_data_buffer_t *buffer,
@@ -1239,6 +1593,7 @@ static void rqcon(pmix_server_req_t *p)
     p->key = NULL;
     p->flag = true;
     p->launcher = false;
+    p->prefetch = false;
     p->remote_room_num = -1;
     p->uid = 0;
     p->gid = 0;
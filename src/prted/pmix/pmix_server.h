@@ -42,6 +42,11 @@ PRTE_EXPORT void prte_pmix_server_clear(pmix_proc_t *pname);
 
 PRTE_EXPORT void pmix_server_notify_spawn(pmix_nspace_t jobid, int room, pmix_status_t ret);
 
+/* request the modex data of the peers the job declared it will
+ * talk to, and drop whatever is still cached for a job */
+PRTE_EXPORT void pmix_server_prefetch(prte_job_t *jdata);
+PRTE_EXPORT void pmix_server_prefetch_purge(const pmix_nspace_t nspace);
+
 END_C_DECLS
 
 #endif /* PMIX_SERVER_H_ */
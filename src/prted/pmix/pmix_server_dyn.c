@@ -208,6 +208,7 @@ static void interim(int sd, short args, void *cbdata)
     bool flag;
     size_t m, n;
     uint16_t u16;
+    uint32_t u32, *u32ptr;
     pmix_rank_t rank;
 
     prte_output_verbose(2, prte_pmix_server_globals.output,
@@ -596,6 +597,34 @@ static void interim(int sd, short args, void *cbdata)
             prte_set_attribute(&jdata->attributes, PRTE_JOB_INDEX_ARGV, PRTE_ATTR_GLOBAL, &flag,
                                PMIX_BOOL);
 
+            /***   JOB ARRAY   ***/
+        } else if (PMIX_CHECK_KEY(info, PRTE_PMIX_JOB_ARRAY)) {
+            PMIX_VALUE_GET_NUMBER(rc, &info->value, u32, uint32_t);
+            if (PMIX_SUCCESS != rc || 0 == u32) {
+                PRTE_ERROR_LOG(PRTE_ERR_BAD_PARAM);
+                rc = PRTE_ERR_BAD_PARAM;
+                goto complete;
+            }
+            prte_set_attribute(&jdata->attributes, PRTE_JOB_ARRAY_SIZE, PRTE_ATTR_GLOBAL, &u32,
+                               PMIX_UINT32);
+
+            /***   MODEX PREFETCH   ***/
+        } else if (PMIX_CHECK_KEY(info, PRTE_PMIX_DMODEX_PREFETCH)) {
+            int ptype, pk;
+            if (PMIX_STRING != info->value.type || NULL == info->value.data.string
+                || PRTE_SUCCESS
+                       != pmix_server_prefetch_parse(info->value.data.string, &ptype, &pk)) {
+                prte_show_help("help-prted.txt", "bad-prefetch", true,
+                               (PMIX_STRING == info->value.type
+                                && NULL != info->value.data.string)
+                                   ? info->value.data.string
+                                   : "(not a string)");
+                rc = PRTE_ERR_SILENT;
+                goto complete;
+            }
+            prte_set_attribute(&jdata->attributes, PRTE_JOB_DMODEX_PREFETCH, PRTE_ATTR_GLOBAL,
+                               info->value.data.string, PMIX_STRING);
+
             /***   DEBUGGER DAEMONS   ***/
         } else if (PMIX_CHECK_KEY(info, PMIX_DEBUGGER_DAEMONS)) {
             PRTE_FLAG_SET(jdata, PRTE_JOB_FLAG_TOOL);
@@ -680,6 +709,34 @@ static void interim(int sd, short args, void *cbdata)
         }
     }
 
+    /* a job array is a single app launched once per element - it is
+     * mapped, launched and registered as one job whose ranks are laid
+     * out element by element, so all elements share a single launch
+     * message and nspace registration */
+    u32ptr = &u32;
+    if (prte_get_attribute(&jdata->attributes, PRTE_JOB_ARRAY_SIZE, (void **) &u32ptr,
+                           PMIX_UINT32)) {
+        app = (prte_app_context_t *) prte_pointer_array_get_item(jdata->apps, 0);
+        if (1 != jdata->num_apps || NULL == app) {
+            prte_show_help("help-prted.txt", "job-array-apps", true, (int) jdata->num_apps);
+            rc = PRTE_ERR_SILENT;
+            goto complete;
+        }
+        /* default to one proc per element */
+        if (0 == app->num_procs) {
+            app->num_procs = 1;
+        }
+        if ((uint32_t) INT32_MAX / u32 < (uint32_t) app->num_procs) {
+            PRTE_ERROR_LOG(PRTE_ERR_BAD_PARAM);
+            rc = PRTE_ERR_BAD_PARAM;
+            goto complete;
+        }
+        prte_output_verbose(2, prte_pmix_server_globals.output,
+                            "%s spawn: job array of %u elements with %d procs each",
+                            PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), u32, app->num_procs);
+        app->num_procs *= u32;
+    }
+
     /* indicate the requestor so bookmarks can be correctly set */
     prte_set_attribute(&jdata->attributes, PRTE_JOB_LAUNCH_PROXY, PRTE_ATTR_GLOBAL,
                        &jdata->originator, PMIX_PROC);
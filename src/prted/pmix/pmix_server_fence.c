@@ -128,40 +128,19 @@ static void modex_resp(pmix_status_t status, char *data, size_t sz, void *cbdata
 
     PRTE_ACQUIRE_OBJECT(req);
 
-    /* pack the status */
+    /* pack the status, the id of the requested proc, the remote
+     * daemon's request room number and any provided data */
     PMIX_DATA_BUFFER_CREATE(reply);
-    if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, reply, &status, 1, PMIX_STATUS))) {
-        PMIX_ERROR_LOG(prc);
-        goto error;
-    }
-    /* pack the id of the requested proc */
-    if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, reply, &req->tproc, 1, PMIX_PROC))) {
+    prc = pmix_server_dmdx_pack_response(reply, status, &req->tproc, req->remote_room_num, data,
+                                         sz);
+    if (PMIX_SUCCESS != prc) {
         PMIX_ERROR_LOG(prc);
+        PMIX_DATA_BUFFER_RELEASE(reply);
         goto error;
     }
 
-    /* pack the remote daemon's request room number */
-    if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, reply, &req->remote_room_num, 1, PMIX_INT))) {
-        PMIX_ERROR_LOG(prc);
-        goto error;
-    }
-    if (PMIX_SUCCESS == status) {
-        /* return any provided data */
-        if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, reply, &sz, 1, PMIX_SIZE))) {
-            PMIX_ERROR_LOG(prc);
-            goto error;
-        }
-        if (0 < sz) {
-            if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, reply, data, sz, PMIX_BYTE))) {
-                PMIX_ERROR_LOG(prc);
-                goto error;
-            }
-        }
-    }
-
     /* send the response */
-    prte_rml.send_buffer_nb(&req->proxy, reply, PRTE_RML_TAG_DIRECT_MODEX_RESP,
-                            prte_rml_send_callback, NULL);
+    pmix_server_dmdx_queue(&req->proxy, PRTE_RML_TAG_DIRECT_MODEX_RESP, reply, -1);
 
 error:
     PRTE_RELEASE(req);
@@ -202,6 +181,12 @@ static void dmodex_req(int sd, short args, void *cbdata)
                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), refresh_cache ? "TRUE" : "FALSE",
                         (NULL == req->key) ? "NULL" : req->key);
 
+    /* we may already have prefetched it - a prefetch didn't wait for
+     * any particular key, so only use it if we don't need one */
+    if ((NULL == req->key || refresh_cache) && pmix_server_prefetch_fetch(req, refresh_cache)) {
+        return;
+    }
+
     if (!refresh_cache && NULL != req->key) {
         /* a race condition exists here because of the thread-shift - it is
          * possible that data for the specified proc arrived while we were
@@ -339,47 +324,19 @@ static void dmodex_req(int sd, short args, void *cbdata)
         return;
     }
 
-    /* construct a request message */
+    /* construct a request message, including the request room
+     * number for quick retrieval and any qualifiers */
     PMIX_DATA_BUFFER_CREATE(buf);
-    if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, buf, &req->tproc, 1, PMIX_PROC))) {
-        PMIX_ERROR_LOG(prc);
-        prte_hotel_checkout(&prte_pmix_server_globals.reqs, req->room_num);
-        PMIX_DATA_BUFFER_RELEASE(buf);
-        goto callback;
-    }
-    /* include the request room number for quick retrieval */
-    if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, buf, &req->room_num, 1, PMIX_INT))) {
+    prc = pmix_server_dmdx_pack_request(buf, &req->tproc, req->room_num, req->info, req->ninfo);
+    if (PMIX_SUCCESS != prc) {
         PMIX_ERROR_LOG(prc);
         prte_hotel_checkout(&prte_pmix_server_globals.reqs, req->room_num);
         PMIX_DATA_BUFFER_RELEASE(buf);
         goto callback;
     }
-    /* add any qualifiers */
-    if (PRTE_SUCCESS != (prc = PMIx_Data_pack(NULL, buf, &req->ninfo, 1, PMIX_SIZE))) {
-        PMIX_ERROR_LOG(prc);
-        prte_hotel_checkout(&prte_pmix_server_globals.reqs, req->room_num);
-        PMIX_DATA_BUFFER_RELEASE(buf);
-        goto callback;
-    }
-    if (0 < req->ninfo) {
-        if (PRTE_SUCCESS != (prc = PMIx_Data_pack(NULL, buf, req->info, req->ninfo, PMIX_INFO))) {
-            PMIX_ERROR_LOG(prc);
-            prte_hotel_checkout(&prte_pmix_server_globals.reqs, req->room_num);
-            PMIX_DATA_BUFFER_RELEASE(buf);
-            goto callback;
-        }
-    }
 
-    /* send it to the host daemon */
-    if (PRTE_SUCCESS
-        != (rc = prte_rml.send_buffer_nb(&dmn->name, buf, PRTE_RML_TAG_DIRECT_MODEX,
-                                         prte_rml_send_callback, NULL))) {
-        PRTE_ERROR_LOG(rc);
-        prte_hotel_checkout(&prte_pmix_server_globals.reqs, req->room_num);
-        PRTE_RELEASE(buf);
-        prc = prte_pmix_convert_rc(rc);
-        goto callback;
-    }
+    /* send it to the host daemon along with any other requests for it */
+    pmix_server_dmdx_queue(&dmn->name, PRTE_RML_TAG_DIRECT_MODEX, buf, req->room_num);
     return;
 
 callback:
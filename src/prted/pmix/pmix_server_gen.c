@@ -700,15 +700,10 @@ void pmix_server_log_fn(const pmix_proc_t *client, const pmix_info_t data[], siz
             if (PMIX_BYTE_OBJECT != data[n].value.type) {
                 continue;
             }
-            PMIX_DATA_BUFFER_CREATE(buf);
-            /* we don't "own" the data here, so we cannot just point to it
-             * nor can we "adopt" it - we have to actually make a copy of it */
-            rc = PMIx_Data_embed(buf, &data[n].value.data.bo);
-            if (PRTE_SUCCESS
-                != (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, buf, PRTE_RML_TAG_SHOW_HELP,
-                                                 prte_rml_send_callback, NULL))) {
+            /* relay it to the HNP - we don't "own" the data here, so
+             * the relay makes its own copy of it */
+            if (PRTE_SUCCESS != (rc = prte_show_help_relay(&data[n].value.data.bo))) {
                 PRTE_ERROR_LOG(rc);
-                PMIX_DATA_BUFFER_RELEASE(buf);
             }
         } else {
             /* ship this to our HNP/MASTER for processing, even if that is us */
@@ -40,6 +40,7 @@
 #endif
 #include <pmix_server.h>
 
+#include "src/class/prte_hash_table.h"
 #include "src/class/prte_hotel.h"
 #include "src/event/event-internal.h"
 #include "src/mca/base/base.h"
@@ -91,6 +92,7 @@ typedef struct {
     int remote_room_num;
     bool flag;
     bool launcher;
+    bool prefetch;
     uid_t uid;
     gid_t gid;
     pid_t pid;
@@ -350,6 +352,56 @@ PRTE_EXPORT extern void pmix_server_jobid_return(int status, pmix_proc_t *sender
 
 PRTE_EXPORT extern int prte_pmix_server_register_tool(pmix_nspace_t nspace);
 
+PRTE_EXPORT extern void pmix_server_purge_locality_cache(void);
+
+/* cumulative number of nspaces registered, the proc entries
+ * registered for them, and the usec spent doing so */
+PRTE_EXPORT extern void pmix_server_registration_totals(uint64_t *nregs, uint64_t *nprocs,
+                                                        uint64_t *usec);
+
+/* queue a direct modex request (PRTE_RML_TAG_DIRECT_MODEX) or response
+ * (PRTE_RML_TAG_DIRECT_MODEX_RESP) for the given daemon. Messages queued
+ * for the same daemon and tag are sent together, prefixed by their count.
+ * For requests, room is the hotel room of the request so it can be failed
+ * if the send fails - pass -1 for responses. Takes ownership of msg. */
+PRTE_EXPORT extern void pmix_server_dmdx_queue(pmix_proc_t *dmn, prte_rml_tag_t tag,
+                                               pmix_data_buffer_t *msg, int room);
+
+/* pack and unpack a single direct modex request or response, and the
+ * count that prefixes a batch of them. Responses only carry data when
+ * their status is success. The unpack functions allocate the returned
+ * info array or data, which the caller must release */
+PRTE_EXPORT extern pmix_status_t pmix_server_dmdx_pack_request(pmix_data_buffer_t *buf,
+                                                               pmix_proc_t *tproc, int room,
+                                                               pmix_info_t *info, size_t ninfo);
+PRTE_EXPORT extern pmix_status_t pmix_server_dmdx_unpack_request(pmix_data_buffer_t *buf,
+                                                                 pmix_proc_t *tproc, int *room,
+                                                                 pmix_info_t **info,
+                                                                 size_t *ninfo);
+PRTE_EXPORT extern pmix_status_t pmix_server_dmdx_pack_response(pmix_data_buffer_t *buf,
+                                                                pmix_status_t status,
+                                                                pmix_proc_t *tproc, int room,
+                                                                char *data, size_t sz);
+PRTE_EXPORT extern pmix_status_t pmix_server_dmdx_unpack_response(pmix_data_buffer_t *buf,
+                                                                  pmix_status_t *status,
+                                                                  pmix_proc_t *tproc, int *room,
+                                                                  char **data, size_t *sz);
+PRTE_EXPORT extern pmix_status_t pmix_server_dmdx_pack_batch(pmix_data_buffer_t *buf,
+                                                             int32_t nmsgs,
+                                                             pmix_data_buffer_t *msgs);
+
+/* modex prefetch - see pmix_server_prefetch.c */
+#define PRTE_PMIX_PREFETCH_RANKS 1
+#define PRTE_PMIX_PREFETCH_NODES 2
+
+/* parse a prefetch spec into its type and extent */
+PRTE_EXPORT extern int pmix_server_prefetch_parse(const char *spec, int *type, int *k);
+/* cache the data returned for a prefetch request */
+PRTE_EXPORT extern void pmix_server_prefetch_store(pmix_proc_t *proc, char *data, size_t sz);
+/* answer a direct modex request from the cache - returns true if the
+ * request was completed, in which case it has been released */
+PRTE_EXPORT extern bool pmix_server_prefetch_fetch(pmix_server_req_t *req, bool refresh);
+
 /* exposed shared variables */
 typedef struct {
     prte_list_item_t super;
@@ -373,8 +425,24 @@ typedef struct {
     bool session_server;
     bool system_server;
     bool legacy;
+    bool compact_registration;
     prte_list_t tools;
     prte_list_t psets;
+    /* batching of direct modex traffic */
+    int dmdx_batch_delay;
+    int dmdx_batch_max;
+    prte_pointer_array_t dmdx_reqs;
+    prte_pointer_array_t dmdx_resps;
+    prte_list_t dmdx_pending;
+    prte_event_t dmdx_ev;
+    bool dmdx_ev_active;
+    uint64_t dmdx_msgs_sent[2];
+    uint64_t dmdx_batches_sent[2];
+    /* modex prefetch */
+    prte_hash_table_t prefetched;
+    int prefetch_max_pct;
+    uint64_t prefetch_reqs;
+    uint64_t prefetch_hits;
 } pmix_server_globals_t;
 
 extern pmix_server_globals_t prte_pmix_server_globals;
@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) 2021      Nanook Consulting.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+/** @file
+ *
+ * Prefetch of direct modex data.
+ *
+ * Without a data exchange in the fence, the first PMIx_Get for a remote
+ * proc stalls on a direct modex round trip to the daemon hosting it. An
+ * application that knows which peers it will talk to can declare them at
+ * spawn with PRTE_PMIX_DMODEX_PREFETCH:
+ *
+ *    ranks:K  - the procs within K ranks of each local proc (wrapping
+ *               around the job, as for a periodic stencil)
+ *    nodes:G  - the procs on the nodes of the same group of G
+ *               consecutive nodes of the job map as this one
+ *
+ * Once all local procs of a job have been launched, the daemon asks for
+ * the data of every declared peer that is hosted elsewhere. The remote
+ * daemon holds each request until the peer has committed its data, and
+ * the requests and responses go out in batches. A prefetch stops short
+ * of filling more than pmix_server_prefetch_max_rooms percent of the
+ * request hotel, so our clients' own requests still find a room. The
+ * returned blobs are cached here, and the first direct modex request
+ * for one of those peers is answered from the cache without leaving
+ * the node. A response that also answered client requests that joined
+ * the prefetch while it was in flight is not cached, as the local
+ * server already has the data.
+ */
+
+#include "prte_config.h"
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_STRINGS_H
+#    include <strings.h>
+#endif
+
+#include "src/class/prte_hash_table.h"
+#include "src/mca/errmgr/errmgr.h"
+#include "src/mca/rmaps/rmaps_types.h"
+#include "src/mca/rml/rml.h"
+#include "src/pmix/pmix-internal.h"
+#include "src/runtime/prte_globals.h"
+#include "src/util/name_fns.h"
+#include "src/util/output.h"
+
+#include "src/prted/pmix/pmix_server.h"
+#include "src/prted/pmix/pmix_server_internal.h"
+
+typedef struct {
+    prte_object_t super;
+    char *data;
+    size_t sz;
+} prefetch_blob_t;
+static void pbcon(prefetch_blob_t *p)
+{
+    p->data = NULL;
+    p->sz = 0;
+}
+static void pbdes(prefetch_blob_t *p)
+{
+    if (NULL != p->data) {
+        free(p->data);
+    }
+}
+static PRTE_CLASS_INSTANCE(prefetch_blob_t, prte_object_t, pbcon, pbdes);
+
+static void relblob(void *cbdata)
+{
+    prefetch_blob_t *blob = (prefetch_blob_t *) cbdata;
+
+    PRTE_RELEASE(blob);
+}
+
+/* the nspace of a proc may carry junk after the terminating NUL,
+ * so always build a clean key */
+static void blob_key(pmix_proc_t *key, const pmix_proc_t *proc)
+{
+    memset(key, 0, sizeof(pmix_proc_t));
+    PMIX_LOAD_PROCID(key, proc->nspace, proc->rank);
+}
+
+int pmix_server_prefetch_parse(const char *spec, int *type, int *k)
+{
+    char *end;
+    long val;
+
+    if (0 == strncasecmp(spec, "ranks:", 6)) {
+        *type = PRTE_PMIX_PREFETCH_RANKS;
+        spec += 6;
+    } else if (0 == strncasecmp(spec, "nodes:", 6)) {
+        *type = PRTE_PMIX_PREFETCH_NODES;
+        spec += 6;
+    } else {
+        return PRTE_ERR_BAD_PARAM;
+    }
+    val = strtol(spec, &end, 10);
+    if (end == spec || '\0' != *end || 0 >= val || INT_MAX < val) {
+        return PRTE_ERR_BAD_PARAM;
+    }
+    *k = (int) val;
+    return PRTE_SUCCESS;
+}
+
+static bool request_peer(prte_job_t *jdata, pmix_rank_t rank, int *avail)
+{
+    prte_proc_t *proct;
+    prte_proc_t *dmn;
+    pmix_server_req_t *req;
+    pmix_data_buffer_t *buf;
+    pmix_status_t prc;
+    bool flag = true;
+
+    proct = (prte_proc_t *) prte_pointer_array_get_item(jdata->procs, rank);
+    if (NULL == proct || NULL == proct->node || NULL == (dmn = proct->node->daemon)
+        || PRTE_PROC_MY_NAME->rank == dmn->name.rank) {
+        /* unknown, or one of ours and so already available */
+        return true;
+    }
+
+    req = PRTE_NEW(pmix_server_req_t);
+    prte_asprintf(&req->operation, "PREFETCH: %s:%d", __FILE__, __LINE__);
+    PMIX_LOAD_PROCID(&req->tproc, jdata->nspace, rank);
+    /* mark the data for this peer as requested, so a client that
+     * asks for it meanwhile waits for this response instead of
+     * sending a request of its own */
+    req->target = req->tproc;
+    req->proxy = dmn->name;
+    req->prefetch = true;
+    /* let the remote daemon know this is a prefetch so it doesn't
+     * complain if the peer never commits any data */
+    req->ninfo = 1;
+    PMIX_INFO_CREATE(req->info, req->ninfo);
+    PMIX_INFO_LOAD(&req->info[0], PRTE_PMIX_DMODEX_PREFETCH, &flag, PMIX_BOOL);
+    PRTE_ADJUST_TIMEOUT(req);
+    if (PRTE_SUCCESS
+        != prte_hotel_checkin(&prte_pmix_server_globals.reqs, req, &req->room_num)) {
+        /* out of rooms - leave them to the real requests */
+        PRTE_RELEASE(req);
+        return false;
+    }
+
+    PMIX_DATA_BUFFER_CREATE(buf);
+    prc = pmix_server_dmdx_pack_request(buf, &req->tproc, req->room_num, req->info, req->ninfo);
+    if (PMIX_SUCCESS != prc) {
+        PMIX_ERROR_LOG(prc);
+        prte_hotel_checkout(&prte_pmix_server_globals.reqs, req->room_num);
+        PMIX_DATA_BUFFER_RELEASE(buf);
+        PRTE_RELEASE(req);
+        return false;
+    }
+    --(*avail);
+    pmix_server_dmdx_queue(&dmn->name, PRTE_RML_TAG_DIRECT_MODEX, buf, req->room_num);
+    prte_pmix_server_globals.prefetch_reqs++;
+    return true;
+}
+
+void pmix_server_prefetch(prte_job_t *jdata)
+{
+    char *spec = NULL;
+    char *want = NULL;
+    prte_proc_t *child;
+    prte_node_t *node;
+    prte_proc_t *proct;
+    int type, k, n, d, mine, first, last, avail;
+    pmix_rank_t rank, nreqs = 0;
+    void *occupant;
+
+    if (!prte_get_attribute(&jdata->attributes, PRTE_JOB_DMODEX_PREFETCH, (void **) &spec,
+                            PMIX_STRING)
+        || NULL == spec) {
+        return;
+    }
+    if (PRTE_SUCCESS != pmix_server_prefetch_parse(spec, &type, &k) || 0 == jdata->num_procs
+        || 0 == jdata->local_children.lowest_free) {
+        free(spec);
+        return;
+    }
+    want = (char *) calloc(jdata->num_procs, sizeof(char));
+    if (NULL == want) {
+        PRTE_ERROR_LOG(PRTE_ERR_OUT_OF_RESOURCE);
+        free(spec);
+        return;
+    }
+
+    if (PRTE_PMIX_PREFETCH_RANKS == type) {
+        if (k >= (int) jdata->num_procs) {
+            k = jdata->num_procs - 1;
+        }
+        for (n = 0; n < jdata->local_children.size; n++) {
+            child = (prte_proc_t *) prte_pointer_array_get_item(&jdata->local_children, n);
+            if (NULL == child) {
+                continue;
+            }
+            for (d = -k; d <= k; d++) {
+                rank = (child->name.rank + jdata->num_procs + d) % jdata->num_procs;
+                want[rank] = 1;
+            }
+        }
+    } else if (NULL != jdata->map) {
+        /* find our position in the job map */
+        mine = -1;
+        for (n = 0; n < jdata->map->nodes->size; n++) {
+            node = (prte_node_t *) prte_pointer_array_get_item(jdata->map->nodes, n);
+            if (NULL != node && NULL != node->daemon
+                && PRTE_PROC_MY_NAME->rank == node->daemon->name.rank) {
+                mine = n;
+                break;
+            }
+        }
+        if (0 <= mine) {
+            first = (mine / k) * k;
+            last = first + k;
+            if (last > jdata->map->nodes->size) {
+                last = jdata->map->nodes->size;
+            }
+            for (n = first; n < last; n++) {
+                node = (prte_node_t *) prte_pointer_array_get_item(jdata->map->nodes, n);
+                if (NULL == node) {
+                    continue;
+                }
+                for (d = 0; d < node->procs->size; d++) {
+                    proct = (prte_proc_t *) prte_pointer_array_get_item(node->procs, d);
+                    if (NULL != proct && PMIX_CHECK_NSPACE(proct->name.nspace, jdata->nspace)
+                        && proct->name.rank < jdata->num_procs) {
+                        want[proct->name.rank] = 1;
+                    }
+                }
+            }
+        }
+    }
+
+    /* leave room in the hotel for the requests of our clients - a
+     * prefetch only gets what remains below its share of the rooms */
+    avail = (int) (((int64_t) prte_pmix_server_globals.reqs.num_rooms
+                    * prte_pmix_server_globals.prefetch_max_pct)
+                   / 100);
+    for (n = 0; n < prte_pmix_server_globals.reqs.num_rooms && 0 < avail; n++) {
+        prte_hotel_knock(&prte_pmix_server_globals.reqs, n, &occupant);
+        if (NULL != occupant) {
+            --avail;
+        }
+    }
+
+    for (rank = 0; rank < jdata->num_procs; rank++) {
+        if (!want[rank]) {
+            continue;
+        }
+        if (0 >= avail) {
+            prte_output_verbose(2, prte_pmix_server_globals.output,
+                                "%s prefetch for job %s: request slots exhausted at rank %u",
+                                PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                                PRTE_JOBID_PRINT(jdata->nspace), rank);
+            break;
+        }
+        if (!request_peer(jdata, rank, &avail)) {
+            break;
+        }
+        ++nreqs;
+    }
+
+    prte_output_verbose(2, prte_pmix_server_globals.output,
+                        "%s prefetch %s for job %s: checked %u peers",
+                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), spec, PRTE_JOBID_PRINT(jdata->nspace),
+                        nreqs);
+    free(want);
+    free(spec);
+}
+
+void pmix_server_prefetch_store(pmix_proc_t *proc, char *data, size_t sz)
+{
+    prefetch_blob_t *blob;
+    pmix_proc_t key;
+
+    blob = PRTE_NEW(prefetch_blob_t);
+    if (0 < sz) {
+        blob->data = (char *) malloc(sz);
+        if (NULL == blob->data) {
+            PRTE_ERROR_LOG(PRTE_ERR_OUT_OF_RESOURCE);
+            PRTE_RELEASE(blob);
+            return;
+        }
+        memcpy(blob->data, data, sz);
+        blob->sz = sz;
+    }
+    blob_key(&key, proc);
+    if (PRTE_SUCCESS
+        != prte_hash_table_set_value_ptr(&prte_pmix_server_globals.prefetched, &key, sizeof(key),
+                                         blob)) {
+        PRTE_RELEASE(blob);
+    }
+}
+
+bool pmix_server_prefetch_fetch(pmix_server_req_t *req, bool refresh)
+{
+    prefetch_blob_t *blob;
+    pmix_proc_t key;
+
+    blob_key(&key, &req->tproc);
+    if (PRTE_SUCCESS
+        != prte_hash_table_get_value_ptr(&prte_pmix_server_globals.prefetched, &key, sizeof(key),
+                                         (void **) &blob)) {
+        return false;
+    }
+    /* the local server keeps what we give it, so we don't need it again */
+    prte_hash_table_remove_value_ptr(&prte_pmix_server_globals.prefetched, &key, sizeof(key));
+    if (refresh) {
+        PRTE_RELEASE(blob);
+        return false;
+    }
+
+    prte_output_verbose(2, prte_pmix_server_globals.output, "%s prefetch hit for %s",
+                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_NAME_PRINT(&req->tproc));
+    prte_pmix_server_globals.prefetch_hits++;
+    if (NULL != req->mdxcbfunc) {
+        req->mdxcbfunc(PMIX_SUCCESS, blob->data, blob->sz, req->cbdata, relblob, blob);
+    } else {
+        PRTE_RELEASE(blob);
+    }
+    PRTE_RELEASE(req);
+    return true;
+}
+
+void pmix_server_prefetch_purge(const pmix_nspace_t nspace)
+{
+    pmix_proc_t *key, *tmp, *doomed = NULL;
+    size_t keysize, n, ndoomed = 0, nalloc = 0;
+    prefetch_blob_t *blob;
+    void *node, *next;
+    int rc;
+
+    /* removing entries can move others around in the table, so
+     * find them all first */
+    rc = prte_hash_table_get_first_key_ptr(&prte_pmix_server_globals.prefetched, (void **) &key,
+                                           &keysize, (void **) &blob, &node);
+    while (PRTE_SUCCESS == rc) {
+        if (NULL == nspace || PMIX_CHECK_NSPACE(key->nspace, nspace)) {
+            if (ndoomed == nalloc) {
+                nalloc = (0 == nalloc) ? 16 : 2 * nalloc;
+                tmp = (pmix_proc_t *) realloc(doomed, nalloc * sizeof(pmix_proc_t));
+                if (NULL == tmp) {
+                    PRTE_ERROR_LOG(PRTE_ERR_OUT_OF_RESOURCE);
+                    break;
+                }
+                doomed = tmp;
+            }
+            memcpy(&doomed[ndoomed++], key, sizeof(pmix_proc_t));
+            PRTE_RELEASE(blob);
+        }
+        rc = prte_hash_table_get_next_key_ptr(&prte_pmix_server_globals.prefetched,
+                                              (void **) &key, &keysize, (void **) &blob, node,
+                                              &next);
+        node = next;
+    }
+    for (n = 0; n < ndoomed; n++) {
+        prte_hash_table_remove_value_ptr(&prte_pmix_server_globals.prefetched, &doomed[n],
+                                         sizeof(pmix_proc_t));
+    }
+    if (NULL != doomed) {
+        free(doomed);
+    }
+}
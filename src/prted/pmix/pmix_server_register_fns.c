@@ -33,10 +33,15 @@
 #ifdef HAVE_UNISTD_H
 #    include <unistd.h>
 #endif
+#include <errno.h>
 #include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/time.h>
 #include <pmix_server.h>
 
 #include "prte_stdint.h"
+#include "src/class/prte_hash_table.h"
 #include "src/hwloc/hwloc-internal.h"
 #include "src/pmix/pmix-internal.h"
 #include "src/util/argv.h"
@@ -56,14 +61,104 @@
 
 static void opcbfunc(pmix_status_t status, void *cbdata);
 
+/* max number of entries describing a single proc */
+#define PRTE_PMIX_PROC_DATA_MAX 16
+
+/* locality strings for the cpusets we have seen, keyed by the
+ * cpuset string. The strings depend on our topology, so the cache
+ * is flushed should our topology signature change */
+static prte_hash_table_t loc_cache;
+static bool loc_cache_init = false;
+static char *loc_cache_sig = NULL;
+
+/* counters for the nspace registration phase */
+static struct {
+    uint64_t nregs;
+    uint64_t nprocs;
+    uint64_t usec;
+    uint64_t total_usec;
+    uint64_t hits;
+    uint64_t misses;
+} reg_timing = {0, 0, 0, 0, 0, 0};
+
+void pmix_server_purge_locality_cache(void)
+{
+    void *key;
+    char *value;
+
+    if (!loc_cache_init) {
+        return;
+    }
+    PRTE_HASH_TABLE_FOREACH_PTR(key, value, &loc_cache, { free(value); });
+    PRTE_DESTRUCT(&loc_cache);
+    loc_cache_init = false;
+    if (NULL != loc_cache_sig) {
+        free(loc_cache_sig);
+        loc_cache_sig = NULL;
+    }
+}
+
+void pmix_server_registration_totals(uint64_t *nregs, uint64_t *nprocs, uint64_t *usec)
+{
+    *nregs = reg_timing.nregs;
+    *nprocs = reg_timing.nprocs;
+    *usec = reg_timing.total_usec;
+}
+
+/* get the locality string for the given cpuset - the returned
+ * string belongs to the cache and must not be released */
+static int get_locality(char *cpustr, char **locality)
+{
+    pmix_cpuset_t cpuset;
+    pmix_status_t ret;
+    char *str;
+    size_t len = strlen(cpustr);
+
+    if (loc_cache_init
+        && (NULL == loc_cache_sig || NULL == prte_topo_signature
+            || 0 != strcmp(loc_cache_sig, prte_topo_signature))) {
+        pmix_server_purge_locality_cache();
+    }
+    if (!loc_cache_init) {
+        PRTE_CONSTRUCT(&loc_cache, prte_hash_table_t);
+        prte_hash_table_init(&loc_cache, 64);
+        loc_cache_init = true;
+        if (NULL != prte_topo_signature) {
+            loc_cache_sig = strdup(prte_topo_signature);
+        }
+    }
+
+    if (PRTE_SUCCESS
+        == prte_hash_table_get_value_ptr(&loc_cache, cpustr, len, (void **) locality)) {
+        reg_timing.hits++;
+        return PRTE_SUCCESS;
+    }
+
+    /* let PMIx generate the locality string */
+    PMIX_CPUSET_CONSTRUCT(&cpuset);
+    cpuset.source = "hwloc";
+    cpuset.bitmap = hwloc_bitmap_alloc();
+    hwloc_bitmap_list_sscanf(cpuset.bitmap, cpustr);
+    ret = PMIx_server_generate_locality_string(&cpuset, &str);
+    hwloc_bitmap_free(cpuset.bitmap);
+    if (PMIX_SUCCESS != ret) {
+        PMIX_ERROR_LOG(ret);
+        return prte_pmix_convert_status(ret);
+    }
+    prte_hash_table_set_value_ptr(&loc_cache, cpustr, len, str);
+    reg_timing.misses++;
+    *locality = str;
+    return PRTE_SUCCESS;
+}
+
 /* stuff proc attributes for sending back to a proc */
 int prte_pmix_server_register_nspace(prte_job_t *jdata)
 {
     int rc;
     prte_proc_t *pptr;
-    int i, k, n, p;
-    prte_list_t *info, *pmap, nodeinfo, appinfo;
-    prte_info_item_t *kv, *kptr;
+    int i, k, n;
+    prte_list_t *info, nodeinfo, appinfo;
+    prte_info_item_t *kv;
     prte_info_array_item_t *iarray;
     prte_node_t *node;
     pmix_rank_t vpid;
@@ -83,12 +178,17 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
     prte_namelist_t *nm;
     size_t nmsize;
     pmix_server_pset_t *pset;
-    pmix_cpuset_t cpuset;
     uint32_t ui32;
     prte_job_t *parent = NULL;
+    pmix_info_t pmap[PRTE_PMIX_PROC_DATA_MAX];
+    size_t p, nprocdata = 0;
+    bool local;
+    char *nsdir = NULL, *locality;
+    struct timeval start, stop;
 
     prte_output_verbose(2, prte_pmix_server_globals.output, "%s register nspace for %s",
                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_JOBID_PRINT(jdata->nspace));
+    gettimeofday(&start, NULL);
 
     /* setup the info list */
     info = PRTE_NEW(prte_list_t);
@@ -146,6 +246,7 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
             tmp = NULL;
             vpid = PMIX_RANK_VALID;
             ui32 = 0;
+            local = (PRTE_PROC_MY_NAME->rank == node->daemon->name.rank);
             prte_argv_append_nosize(&list, node->name);
             /* assemble all the ranks for this job that are on this node */
             for (k = 0; k < node->procs->size; k++) {
@@ -157,7 +258,7 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
                         }
                         ++ui32;
                     }
-                    if (PRTE_PROC_MY_NAME->rank == node->daemon->name.rank) {
+                    if (local) {
                         /* track all procs on our node */
                         nm = PRTE_NEW(prte_namelist_t);
                         PMIX_LOAD_PROCID(&nm->name, pptr->name.nspace, pptr->name.rank);
@@ -181,6 +282,10 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
                 prte_argv_free(micro);
                 prte_argv_append_nosize(&procs, tmp);
             }
+            /* count the proc data entries we will pass */
+            if (local || !prte_pmix_server_globals.compact_registration) {
+                nprocdata += ui32;
+            }
             /* construct the node info array */
             iarray = PRTE_NEW(prte_info_array_item_t);
             /* start with the hostname */
@@ -454,165 +559,14 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
         }
     }
 
-    /* for each proc in this job, create an object that
-     * includes the info describing the proc so the recipient has a complete
-     * picture. This allows procs to connect to each other without
-     * any further info exchange, assuming the underlying transports
-     * support it. We also pass all the proc-specific data here so
-     * that each proc can lookup info about every other proc in the job */
-
-    for (n = 0; n < map->nodes->size; n++) {
-        if (NULL == (node = (prte_node_t *) prte_pointer_array_get_item(map->nodes, n))) {
-            continue;
-        }
-        /* cycle across each proc on this node, passing all data that
-         * varies by proc */
-        for (i = 0; i < node->procs->size; i++) {
-            if (NULL == (pptr = (prte_proc_t *) prte_pointer_array_get_item(node->procs, i))) {
-                continue;
-            }
-            /* only consider procs from this job */
-            if (!PMIX_CHECK_NSPACE(pptr->name.nspace, jdata->nspace)) {
-                continue;
-            }
-            /* setup the proc map object */
-            pmap = PRTE_NEW(prte_list_t);
-
-            /* must start with rank */
-            kv = PRTE_NEW(prte_info_item_t);
-            PMIX_INFO_LOAD(&kv->info, PMIX_RANK, &pptr->name.rank, PMIX_PROC_RANK);
-            prte_list_append(pmap, &kv->super);
-
-            /* location, for local procs */
-            if (PRTE_PROC_MY_NAME->rank == node->daemon->name.rank) {
-                tmp = NULL;
-                if (prte_get_attribute(&pptr->attributes, PRTE_PROC_CPU_BITMAP, (void **) &tmp,
-                                       PMIX_STRING)
-                    && NULL != tmp) {
-                    /* provide the cpuset string for this proc */
-                    kv = PRTE_NEW(prte_info_item_t);
-                    PMIX_INFO_LOAD(&kv->info, PMIX_CPUSET, tmp, PMIX_STRING);
-                    prte_list_append(pmap, &kv->super);
-                    /* let PMIx generate the locality string */
-                    PMIX_CPUSET_CONSTRUCT(&cpuset);
-                    cpuset.source = "hwloc";
-                    cpuset.bitmap = hwloc_bitmap_alloc();
-                    hwloc_bitmap_list_sscanf(cpuset.bitmap, tmp);
-                    free(tmp);
-                    ret = PMIx_server_generate_locality_string(&cpuset, &tmp);
-                    if (PMIX_SUCCESS != ret) {
-                        PMIX_ERROR_LOG(ret);
-                        PRTE_LIST_RELEASE(pmap);
-                        PRTE_LIST_DESTRUCT(&appinfo);
-                        PRTE_LIST_RELEASE(info);
-                        return prte_pmix_convert_status(ret);
-                    }
-                    kv = PRTE_NEW(prte_info_item_t);
-                    PMIX_INFO_LOAD(&kv->info, PMIX_LOCALITY_STRING, tmp, PMIX_STRING);
-                    prte_list_append(pmap, &kv->super);
-                    free(tmp);
-                } else {
-                    /* the proc is not bound */
-                    kv = PRTE_NEW(prte_info_item_t);
-                    PMIX_INFO_LOAD(&kv->info, PMIX_LOCALITY_STRING, NULL, PMIX_STRING);
-                    prte_list_append(pmap, &kv->super);
-                }
-                /* create and pass a proc-level session directory */
-                if (0 > prte_asprintf(&tmp, "%s/%u/%u", prte_process_info.jobfam_session_dir,
-                                      PRTE_LOCAL_JOBID(jdata->nspace), pptr->name.rank)) {
-                    PRTE_ERROR_LOG(PRTE_ERR_OUT_OF_RESOURCE);
-                    return PRTE_ERR_OUT_OF_RESOURCE;
-                }
-                if (PRTE_SUCCESS != (rc = prte_os_dirpath_create(tmp, S_IRWXU))) {
-                    PRTE_ERROR_LOG(rc);
-                    return rc;
-                }
-                kv = PRTE_NEW(prte_info_item_t);
-                PMIX_INFO_LOAD(&kv->info, PMIX_PROCDIR, tmp, PMIX_STRING);
-                free(tmp);
-                prte_list_append(pmap, &kv->super);
-            }
-
-            /* global/univ rank */
-            kv = PRTE_NEW(prte_info_item_t);
-            vpid = pptr->name.rank + jdata->offset;
-            PMIX_INFO_LOAD(&kv->info, PMIX_GLOBAL_RANK, &vpid, PMIX_PROC_RANK);
-            prte_list_append(pmap, &kv->super);
-
-            /* parent ID, if we were spawned by a non-tool */
-            if (NULL != parent) {
-                kv = PRTE_NEW(prte_info_item_t);
-                PMIX_INFO_LOAD(&kv->info, PMIX_PARENT_ID, parentproc, PMIX_PROC);
-                prte_list_append(pmap, &kv->super);
-            }
-
-            /* appnum */
-            kv = PRTE_NEW(prte_info_item_t);
-            PMIX_INFO_LOAD(&kv->info, PMIX_APPNUM, &pptr->app_idx, PMIX_UINT32);
-            prte_list_append(pmap, &kv->super);
-
-            /* app rank */
-            kv = PRTE_NEW(prte_info_item_t);
-            PMIX_INFO_LOAD(&kv->info, PMIX_APP_RANK, &pptr->app_rank, PMIX_PROC_RANK);
-            prte_list_append(pmap, &kv->super);
-
-            /* local rank */
-            if (PRTE_LOCAL_RANK_INVALID != pptr->local_rank) {
-                kv = PRTE_NEW(prte_info_item_t);
-                PMIX_INFO_LOAD(&kv->info, PMIX_LOCAL_RANK, &pptr->local_rank, PMIX_UINT16);
-                prte_list_append(pmap, &kv->super);
-            }
-
-            /* node rank */
-            if (PRTE_NODE_RANK_INVALID != pptr->node_rank) {
-                kv = PRTE_NEW(prte_info_item_t);
-                PMIX_INFO_LOAD(&kv->info, PMIX_NODE_RANK, &pptr->node_rank, PMIX_UINT16);
-                prte_list_append(pmap, &kv->super);
-            }
-
-            /* node ID */
-            kv = PRTE_NEW(prte_info_item_t);
-            PMIX_INFO_LOAD(&kv->info, PMIX_NODEID, &pptr->node->index, PMIX_UINT32);
-            prte_list_append(pmap, &kv->super);
-
-            /* reincarnation number */
-            ui32 = 0; // we are starting this proc for the first time
-            kv = PRTE_NEW(prte_info_item_t);
-            PMIX_INFO_LOAD(&kv->info, PMIX_REINCARNATION, &ui32, PMIX_UINT32);
-            prte_list_append(pmap, &kv->super);
-
-            if (map->num_nodes < prte_hostname_cutoff) {
-                kv = PRTE_NEW(prte_info_item_t);
-                PMIX_INFO_LOAD(&kv->info, PMIX_HOSTNAME, pptr->node->name, PMIX_STRING);
-                prte_list_append(pmap, &kv->super);
-            }
-            kv = PRTE_NEW(prte_info_item_t);
-            PMIX_LOAD_KEY(kv->info.key, PMIX_PROC_DATA);
-            kv->info.value.type = PMIX_DATA_ARRAY;
-            ninfo = prte_list_get_size(pmap);
-            if (0 < ninfo) {
-                PMIX_DATA_ARRAY_CREATE(kv->info.value.data.darray, ninfo, PMIX_INFO);
-                pinfo = (pmix_info_t *) kv->info.value.data.darray->array;
-                p = 0;
-                while (NULL != (kptr = (prte_info_item_t *) prte_list_remove_first(pmap))) {
-                    PMIX_INFO_XFER(&pinfo[p], &kptr->info);
-                    PRTE_RELEASE(kptr);
-                    ++p;
-                }
-            }
-            prte_list_append(info, &kv->super);
-        }
-    }
-    if (NULL != parent) {
-        PMIX_PROC_RELEASE(parentproc);
-    }
-
     /* mark the job as registered */
     prte_set_attribute(&jdata->attributes, PRTE_JOB_NSPACE_REGISTERED, PRTE_ATTR_LOCAL, NULL,
                        PMIX_BOOL);
 
-    /* pass it down */
-    ninfo = prte_list_get_size(info) + prte_list_get_size(&nodeinfo) + prte_list_get_size(&appinfo);
+    /* size the payload - the proc data entries are loaded directly
+     * into the array below, so count them now */
+    ninfo = prte_list_get_size(info) + prte_list_get_size(&nodeinfo) + prte_list_get_size(&appinfo)
+            + nprocdata;
     /* if there are local procs, then we add that here */
     if (0 < (nmsize = prte_list_get_size(&local_procs))) {
         ++ninfo;
@@ -685,6 +639,164 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
     }
     PRTE_LIST_DESTRUCT(&appinfo);
 
+    /* for each proc in this job, create an object that
+     * includes the info describing the proc so the recipient has a complete
+     * picture. This allows procs to connect to each other without
+     * any further info exchange, assuming the underlying transports
+     * support it. We also pass all the proc-specific data here so
+     * that each proc can lookup info about every other proc in the job.
+     *
+     * In compact mode we only do this for our local procs - the PMIx
+     * server derives the location of the remote procs from the node
+     * and proc maps. The other proc-level keys of remote procs are
+     * then not available at all, as a direct modex only returns the
+     * data the proc committed - not what its daemon registered.
+     *
+     * The entries for each proc are loaded into a fixed array on the
+     * stack and then moved into a data array of the exact size, so
+     * no intermediate list objects are required */
+
+    for (i = 0; i < map->nodes->size; i++) {
+        if (NULL == (node = (prte_node_t *) prte_pointer_array_get_item(map->nodes, i))) {
+            continue;
+        }
+        local = (PRTE_PROC_MY_NAME->rank == node->daemon->name.rank);
+        if (!local && prte_pmix_server_globals.compact_registration) {
+            continue;
+        }
+        /* cycle across each proc on this node, passing all data that
+         * varies by proc */
+        for (k = 0; k < node->procs->size; k++) {
+            if (NULL == (pptr = (prte_proc_t *) prte_pointer_array_get_item(node->procs, k))) {
+                continue;
+            }
+            /* only consider procs from this job */
+            if (!PMIX_CHECK_NSPACE(pptr->name.nspace, jdata->nspace)) {
+                continue;
+            }
+            p = 0;
+
+            /* must start with rank */
+            PMIX_INFO_LOAD(&pmap[p], PMIX_RANK, &pptr->name.rank, PMIX_PROC_RANK);
+            ++p;
+
+            /* location, for local procs */
+            if (local) {
+                tmp = NULL;
+                if (prte_get_attribute(&pptr->attributes, PRTE_PROC_CPU_BITMAP, (void **) &tmp,
+                                       PMIX_STRING)
+                    && NULL != tmp) {
+                    /* provide the cpuset string for this proc */
+                    PMIX_INFO_LOAD(&pmap[p], PMIX_CPUSET, tmp, PMIX_STRING);
+                    ++p;
+                    /* procs with the same binding share a locality string */
+                    rc = get_locality(tmp, &locality);
+                    free(tmp);
+                    if (PRTE_SUCCESS != rc) {
+                        goto procerr;
+                    }
+                    PMIX_INFO_LOAD(&pmap[p], PMIX_LOCALITY_STRING, locality, PMIX_STRING);
+                    ++p;
+                } else {
+                    /* the proc is not bound */
+                    PMIX_INFO_LOAD(&pmap[p], PMIX_LOCALITY_STRING, NULL, PMIX_STRING);
+                    ++p;
+                }
+                /* create and pass a proc-level session directory - the
+                 * job-level directory is created once, so each proc
+                 * only needs a single mkdir */
+                if (NULL == nsdir) {
+                    if (0 > prte_asprintf(&nsdir, "%s/%u", prte_process_info.jobfam_session_dir,
+                                          PRTE_LOCAL_JOBID(jdata->nspace))) {
+                        PRTE_ERROR_LOG(PRTE_ERR_OUT_OF_RESOURCE);
+                        nsdir = NULL;
+                        rc = PRTE_ERR_OUT_OF_RESOURCE;
+                        goto procerr;
+                    }
+                    if (PRTE_SUCCESS != (rc = prte_os_dirpath_create(nsdir, S_IRWXU))) {
+                        PRTE_ERROR_LOG(rc);
+                        goto procerr;
+                    }
+                }
+                if (0 > prte_asprintf(&tmp, "%s/%u", nsdir, pptr->name.rank)) {
+                    PRTE_ERROR_LOG(PRTE_ERR_OUT_OF_RESOURCE);
+                    rc = PRTE_ERR_OUT_OF_RESOURCE;
+                    goto procerr;
+                }
+                if (0 != mkdir(tmp, S_IRWXU) && EEXIST != errno
+                    && PRTE_SUCCESS != (rc = prte_os_dirpath_create(tmp, S_IRWXU))) {
+                    PRTE_ERROR_LOG(rc);
+                    free(tmp);
+                    goto procerr;
+                }
+                PMIX_INFO_LOAD(&pmap[p], PMIX_PROCDIR, tmp, PMIX_STRING);
+                ++p;
+                free(tmp);
+            }
+
+            /* global/univ rank */
+            vpid = pptr->name.rank + jdata->offset;
+            PMIX_INFO_LOAD(&pmap[p], PMIX_GLOBAL_RANK, &vpid, PMIX_PROC_RANK);
+            ++p;
+
+            /* parent ID, if we were spawned by a non-tool */
+            if (NULL != parent) {
+                PMIX_INFO_LOAD(&pmap[p], PMIX_PARENT_ID, parentproc, PMIX_PROC);
+                ++p;
+            }
+
+            /* appnum */
+            PMIX_INFO_LOAD(&pmap[p], PMIX_APPNUM, &pptr->app_idx, PMIX_UINT32);
+            ++p;
+
+            /* app rank */
+            PMIX_INFO_LOAD(&pmap[p], PMIX_APP_RANK, &pptr->app_rank, PMIX_PROC_RANK);
+            ++p;
+
+            /* local rank */
+            if (PRTE_LOCAL_RANK_INVALID != pptr->local_rank) {
+                PMIX_INFO_LOAD(&pmap[p], PMIX_LOCAL_RANK, &pptr->local_rank, PMIX_UINT16);
+                ++p;
+            }
+
+            /* node rank */
+            if (PRTE_NODE_RANK_INVALID != pptr->node_rank) {
+                PMIX_INFO_LOAD(&pmap[p], PMIX_NODE_RANK, &pptr->node_rank, PMIX_UINT16);
+                ++p;
+            }
+
+            /* node ID */
+            PMIX_INFO_LOAD(&pmap[p], PMIX_NODEID, &pptr->node->index, PMIX_UINT32);
+            ++p;
+
+            /* reincarnation number */
+            ui32 = 0; // we are starting this proc for the first time
+            PMIX_INFO_LOAD(&pmap[p], PMIX_REINCARNATION, &ui32, PMIX_UINT32);
+            ++p;
+
+            if (map->num_nodes < prte_hostname_cutoff) {
+                PMIX_INFO_LOAD(&pmap[p], PMIX_HOSTNAME, pptr->node->name, PMIX_STRING);
+                ++p;
+            }
+
+            /* move the entries into the proc data array - the
+             * loaded values now belong to the array */
+            PMIX_LOAD_KEY(pinfo[n].key, PMIX_PROC_DATA);
+            pinfo[n].value.type = PMIX_DATA_ARRAY;
+            PMIX_DATA_ARRAY_CREATE(pinfo[n].value.data.darray, p, PMIX_INFO);
+            memcpy(pinfo[n].value.data.darray->array, pmap, p * sizeof(pmix_info_t));
+            ++n;
+        }
+    }
+    if (NULL != parent) {
+        PMIX_PROC_RELEASE(parentproc);
+    }
+    if (NULL != nsdir) {
+        free(nsdir);
+    }
+    /* we sized the array before walking the procs */
+    ninfo = n;
+
     /* register it */
     PRTE_PMIX_CONSTRUCT_LOCK(&lock);
     ret = PMIx_server_register_nspace(pproc.nspace, jdata->num_local_procs, pinfo, ninfo, opcbfunc,
@@ -693,7 +805,6 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
         PMIX_ERROR_LOG(ret);
         rc = prte_pmix_convert_status(ret);
         PMIX_INFO_FREE(pinfo, ninfo);
-        PRTE_LIST_RELEASE(info);
         PRTE_PMIX_DESTRUCT_LOCK(&lock);
         return rc;
     }
@@ -705,6 +816,20 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
         return rc;
     }
 
+    /* track the time spent registering */
+    gettimeofday(&stop, NULL);
+    reg_timing.usec = (stop.tv_sec - start.tv_sec) * 1000000 + (stop.tv_usec - start.tv_usec);
+    reg_timing.total_usec += reg_timing.usec;
+    reg_timing.nregs++;
+    reg_timing.nprocs += nprocdata;
+    prte_output_verbose(2, prte_pmix_server_globals.output,
+                        "%s registered nspace %s: %lu proc entries in %lu usec "
+                        "(%lu usec total for %lu nspaces, locality cache %lu hits %lu misses)",
+                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_JOBID_PRINT(jdata->nspace),
+                        (unsigned long) nprocdata, (unsigned long) reg_timing.usec,
+                        (unsigned long) reg_timing.total_usec, (unsigned long) reg_timing.nregs,
+                        (unsigned long) reg_timing.hits, (unsigned long) reg_timing.misses);
+
     /* if the user has connected us to an external server, then we must
      * assume there is going to be some cross-mpirun exchange, and so
      * we protect against that situation by publishing the job info
@@ -772,7 +897,6 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
             PMIX_ERROR_LOG(ret);
             rc = prte_pmix_convert_status(ret);
             PMIX_INFO_FREE(pinfo, ninfo);
-            PRTE_LIST_RELEASE(info);
             PRTE_PMIX_DESTRUCT_LOCK(&lock);
             return rc;
         }
@@ -783,6 +907,20 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
     PMIX_INFO_FREE(pinfo, ninfo);
 
     return rc;
+
+procerr:
+    while (0 < p) {
+        --p;
+        PMIX_INFO_DESTRUCT(&pmap[p]);
+    }
+    PMIX_INFO_FREE(pinfo, ninfo);
+    if (NULL != parent) {
+        PMIX_PROC_RELEASE(parentproc);
+    }
+    if (NULL != nsdir) {
+        free(nsdir);
+    }
+    return rc;
 }
 
 static void opcbfunc(pmix_status_t status, void *cbdata)
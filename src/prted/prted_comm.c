@@ -59,6 +59,7 @@
 #include "src/util/nidmap.h"
 #include "src/util/proc_info.h"
 #include "src/util/session_dir.h"
+#include "src/util/trace.h"
 
 #include "src/mca/errmgr/errmgr.h"
 #include "src/mca/ess/ess.h"
@@ -69,6 +70,7 @@
 #include "src/mca/oob/base/base.h"
 #include "src/mca/plm/base/base.h"
 #include "src/mca/plm/plm.h"
+#include "src/mca/rmaps/base/base.h"
 #include "src/mca/rmaps/rmaps_types.h"
 #include "src/mca/rml/rml.h"
 #include "src/mca/rml/rml_types.h"
@@ -494,6 +496,8 @@ void prte_daemon_recv(int status, pmix_proc_t *sender, pmix_data_buffer_t *buffe
                     /* release the proc once for the map entry */
                     PRTE_RELEASE(proct);
                 }
+                /* its slots are available again */
+                prte_rmaps_base_free_index_mark(node);
                 /* set the node location to NULL */
                 prte_pointer_array_set_item(map->nodes, n, NULL);
                 /* maintain accounting */
@@ -709,6 +713,13 @@ void prte_daemon_recv(int status, pmix_proc_t *sender, pmix_data_buffer_t *buffe
         }
         break;
 
+        /****     DUMP TRACE COMMAND    ****/
+    case PRTE_DAEMON_DUMP_TRACE_CMD:
+        if (PRTE_SUCCESS != (ret = prte_trace_dump("timeout"))) {
+            PRTE_ERROR_LOG(ret);
+        }
+        break;
+
     default:
         PRTE_ERROR_LOG(PRTE_ERR_BAD_PARAM);
     }
@@ -752,6 +763,9 @@ static char *get_prted_comm_cmd_str(int command)
     case PRTE_DAEMON_DVM_CLEANUP_JOB_CMD:
         return strdup("PRTE_DAEMON_DVM_CLEANUP_JOB_CMD");
 
+    case PRTE_DAEMON_DUMP_TRACE_CMD:
+        return strdup("PRTE_DAEMON_DUMP_TRACE_CMD");
+
     default:
         return strdup("Unknown Command!");
     }
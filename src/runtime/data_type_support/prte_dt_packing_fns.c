@@ -35,6 +35,190 @@
 
 #include "src/runtime/prte_globals.h"
 
+/* pack a column of values as runs of identical values - the daemon,
+ * state and app of consecutive procs are almost always the same */
+static pmix_status_t pack_runs(pmix_data_buffer_t *bkt, uint32_t *vals, int32_t n)
+{
+    uint32_t *rvals;
+    int32_t *rlens, nruns = 0, j;
+    pmix_status_t rc;
+
+    rvals = (uint32_t *) malloc(n * sizeof(uint32_t));
+    rlens = (int32_t *) malloc(n * sizeof(int32_t));
+    if (NULL == rvals || NULL == rlens) {
+        free(rvals);
+        free(rlens);
+        return PMIX_ERR_NOMEM;
+    }
+    for (j = 0; j < n; j++) {
+        if (0 < nruns && rvals[nruns - 1] == vals[j]) {
+            rlens[nruns - 1]++;
+        } else {
+            rvals[nruns] = vals[j];
+            rlens[nruns] = 1;
+            ++nruns;
+        }
+    }
+    rc = PMIx_Data_pack(NULL, bkt, &nruns, 1, PMIX_INT32);
+    if (PMIX_SUCCESS == rc && 0 < nruns) {
+        rc = PMIx_Data_pack(NULL, bkt, rvals, nruns, PMIX_UINT32);
+    }
+    if (PMIX_SUCCESS == rc && 0 < nruns) {
+        rc = PMIx_Data_pack(NULL, bkt, rlens, nruns, PMIX_INT32);
+    }
+    free(rvals);
+    free(rlens);
+    return rc;
+}
+
+/* pack the procs of a fully described job one field at a time
+ * across all procs rather than one proc at a time - see
+ * prte_job_unpack for the layout */
+static pmix_status_t pack_procs(pmix_data_buffer_t *bkt, prte_job_t *job)
+{
+    prte_proc_t **procs = NULL, *proc;
+    prte_attribute_t *kv;
+    pmix_rank_t *ranks = NULL;
+    uint32_t *u32 = NULL;
+    uint16_t *u16 = NULL;
+    int32_t j, n = 0, count, nattrs = 0;
+    uint8_t implicit = 1;
+    pmix_status_t rc = PMIX_ERR_NOMEM;
+
+    procs = (prte_proc_t **) malloc(job->procs->size * sizeof(prte_proc_t *));
+    if (NULL == procs) {
+        return PMIX_ERR_NOMEM;
+    }
+    for (j = 0; j < job->procs->size; j++) {
+        if (NULL == (proc = (prte_proc_t *) prte_pointer_array_get_item(job->procs, j))) {
+            continue;
+        }
+        if (proc->name.rank != (pmix_rank_t) n) {
+            implicit = 0;
+        }
+        procs[n++] = proc;
+    }
+    ranks = (pmix_rank_t *) malloc(n * sizeof(pmix_rank_t));
+    u32 = (uint32_t *) malloc(n * sizeof(uint32_t));
+    u16 = (uint16_t *) malloc(n * sizeof(uint16_t));
+    if (0 < n && (NULL == ranks || NULL == u32 || NULL == u16)) {
+        goto done;
+    }
+
+    /* the number of procs, and their ranks unless they are simply 0..n-1 */
+    rc = PMIx_Data_pack(NULL, bkt, &n, 1, PMIX_INT32);
+    if (PMIX_SUCCESS != rc || 0 == n) {
+        goto done;
+    }
+    rc = PMIx_Data_pack(NULL, bkt, &implicit, 1, PMIX_UINT8);
+    if (PMIX_SUCCESS != rc) {
+        goto done;
+    }
+    if (!implicit) {
+        for (j = 0; j < n; j++) {
+            ranks[j] = procs[j]->name.rank;
+        }
+        rc = PMIx_Data_pack(NULL, bkt, ranks, n, PMIX_PROC_RANK);
+        if (PMIX_SUCCESS != rc) {
+            goto done;
+        }
+    }
+
+    /* the daemon hosting each proc */
+    for (j = 0; j < n; j++) {
+        u32[j] = procs[j]->parent;
+    }
+    if (PMIX_SUCCESS != (rc = pack_runs(bkt, u32, n))) {
+        goto done;
+    }
+    /* local and node ranks */
+    for (j = 0; j < n; j++) {
+        u16[j] = procs[j]->local_rank;
+    }
+    if (PMIX_SUCCESS != (rc = PMIx_Data_pack(NULL, bkt, u16, n, PMIX_UINT16))) {
+        goto done;
+    }
+    for (j = 0; j < n; j++) {
+        u16[j] = procs[j]->node_rank;
+    }
+    if (PMIX_SUCCESS != (rc = PMIx_Data_pack(NULL, bkt, u16, n, PMIX_UINT16))) {
+        goto done;
+    }
+    /* state and app context index */
+    for (j = 0; j < n; j++) {
+        u32[j] = procs[j]->state;
+    }
+    if (PMIX_SUCCESS != (rc = pack_runs(bkt, u32, n))) {
+        goto done;
+    }
+    for (j = 0; j < n; j++) {
+        u32[j] = procs[j]->app_idx;
+    }
+    if (PMIX_SUCCESS != (rc = pack_runs(bkt, u32, n))) {
+        goto done;
+    }
+    /* app ranks */
+    for (j = 0; j < n; j++) {
+        ranks[j] = procs[j]->app_rank;
+    }
+    if (PMIX_SUCCESS != (rc = PMIx_Data_pack(NULL, bkt, ranks, n, PMIX_PROC_RANK))) {
+        goto done;
+    }
+
+    /* attributes are rare, so only the procs that have any are
+     * included, each prefixed by its position */
+    for (j = 0; j < n; j++) {
+        PRTE_LIST_FOREACH(kv, &procs[j]->attributes, prte_attribute_t)
+        {
+            if (PRTE_ATTR_GLOBAL == kv->local) {
+                ++nattrs;
+                break;
+            }
+        }
+    }
+    if (PMIX_SUCCESS != (rc = PMIx_Data_pack(NULL, bkt, &nattrs, 1, PMIX_INT32))) {
+        goto done;
+    }
+    for (j = 0; j < n && 0 < nattrs; j++) {
+        count = 0;
+        PRTE_LIST_FOREACH(kv, &procs[j]->attributes, prte_attribute_t)
+        {
+            if (PRTE_ATTR_GLOBAL == kv->local) {
+                ++count;
+            }
+        }
+        if (0 == count) {
+            continue;
+        }
+        --nattrs;
+        if (PMIX_SUCCESS != (rc = PMIx_Data_pack(NULL, bkt, &j, 1, PMIX_INT32))
+            || PMIX_SUCCESS != (rc = PMIx_Data_pack(NULL, bkt, &count, 1, PMIX_INT32))) {
+            goto done;
+        }
+        PRTE_LIST_FOREACH(kv, &procs[j]->attributes, prte_attribute_t)
+        {
+            if (PRTE_ATTR_GLOBAL != kv->local) {
+                continue;
+            }
+            rc = PMIx_Data_pack(NULL, bkt, (void *) &kv->key, 1, PMIX_UINT16);
+            if (PMIX_SUCCESS != rc) {
+                goto done;
+            }
+            rc = PMIx_Data_pack(NULL, bkt, (void *) &kv->data, 1, PMIX_VALUE);
+            if (PMIX_SUCCESS != rc) {
+                goto done;
+            }
+        }
+    }
+
+done:
+    free(procs);
+    free(ranks);
+    free(u32);
+    free(u16);
+    return rc;
+}
+
 /*
  * JOB
  * NOTE: We do not pack all of the job object's fields as many of them have no
@@ -47,7 +231,6 @@ int prte_job_pack(pmix_data_buffer_t *bkt, prte_job_t *job)
     pmix_status_t rc;
     int32_t j, count, bookmark;
     prte_app_context_t *app;
-    prte_proc_t *proc;
     prte_attribute_t *kv;
     prte_list_t *cache;
     prte_info_item_t *val;
@@ -172,20 +355,20 @@ int prte_job_pack(pmix_data_buffer_t *bkt, prte_job_t *job)
         PMIX_ERROR_LOG(rc);
         return prte_pmix_convert_status(rc);
     }
+    rc = PMIx_Data_pack(NULL, bkt, (void *) &job->version, 1, PMIX_UINT32);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return prte_pmix_convert_status(rc);
+    }
 
     if (0 < job->num_procs) {
         /* check attributes to see if this job is to be fully
          * described in the launch msg */
         if (prte_get_attribute(&job->attributes, PRTE_JOB_FULLY_DESCRIBED, NULL, PMIX_BOOL)) {
-            for (j = 0; j < job->procs->size; j++) {
-                if (NULL == (proc = (prte_proc_t *) prte_pointer_array_get_item(job->procs, j))) {
-                    continue;
-                }
-                rc = prte_proc_pack(bkt, proc);
-                if (PMIX_SUCCESS != rc) {
-                    PMIX_ERROR_LOG(rc);
-                    return prte_pmix_convert_status(rc);
-                }
+            rc = pack_procs(bkt, job);
+            if (PMIX_SUCCESS != rc) {
+                PMIX_ERROR_LOG(rc);
+                return prte_pmix_convert_status(rc);
             }
         }
     }
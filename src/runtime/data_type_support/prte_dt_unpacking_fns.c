@@ -34,6 +34,221 @@
 
 #include "src/runtime/prte_globals.h"
 
+/* expand a column packed as runs of identical values */
+static pmix_status_t unpack_runs(pmix_data_buffer_t *bkt, uint32_t *vals, int32_t n)
+{
+    uint32_t *rvals = NULL;
+    int32_t *rlens = NULL, nruns, cnt, j, k, m = 0;
+    pmix_status_t rc;
+
+    cnt = 1;
+    rc = PMIx_Data_unpack(NULL, bkt, &nruns, &cnt, PMIX_INT32);
+    if (PMIX_SUCCESS != rc) {
+        return rc;
+    }
+    if (0 > nruns || n < nruns) {
+        return PMIX_ERR_UNPACK_FAILURE;
+    }
+    if (0 == nruns) {
+        return (0 == n) ? PMIX_SUCCESS : PMIX_ERR_UNPACK_FAILURE;
+    }
+    rvals = (uint32_t *) malloc(nruns * sizeof(uint32_t));
+    rlens = (int32_t *) malloc(nruns * sizeof(int32_t));
+    if (NULL == rvals || NULL == rlens) {
+        rc = PMIX_ERR_NOMEM;
+        goto done;
+    }
+    cnt = nruns;
+    rc = PMIx_Data_unpack(NULL, bkt, rvals, &cnt, PMIX_UINT32);
+    if (PMIX_SUCCESS != rc) {
+        goto done;
+    }
+    cnt = nruns;
+    rc = PMIx_Data_unpack(NULL, bkt, rlens, &cnt, PMIX_INT32);
+    if (PMIX_SUCCESS != rc) {
+        goto done;
+    }
+    for (j = 0; j < nruns; j++) {
+        if (0 >= rlens[j] || n - m < rlens[j]) {
+            rc = PMIX_ERR_UNPACK_FAILURE;
+            goto done;
+        }
+        for (k = 0; k < rlens[j]; k++) {
+            vals[m++] = rvals[j];
+        }
+    }
+    if (m != n) {
+        rc = PMIX_ERR_UNPACK_FAILURE;
+    }
+
+done:
+    free(rvals);
+    free(rlens);
+    return rc;
+}
+
+/* unpack the procs of a fully described job. The layout is:
+ *
+ *    int32     number of procs (n) - nothing follows if zero
+ *    uint8     one if the ranks are 0..n-1, else
+ *    rank[n]   the rank of each proc
+ *    runs      the daemon hosting each proc
+ *    uint16[n] local ranks
+ *    uint16[n] node ranks
+ *    runs      states
+ *    runs      app context indices
+ *    rank[n]   app ranks
+ *    int32     number of procs that have attributes, each followed by
+ *              its position, its number of attributes and key/value pairs
+ *
+ * where runs are an int32 count of runs followed by the value and
+ * length of each run */
+static pmix_status_t unpack_procs(pmix_data_buffer_t *bkt, prte_job_t *jptr)
+{
+    prte_proc_t **procs = NULL, *proc;
+    prte_attribute_t *kv;
+    pmix_rank_t *ranks = NULL, *aranks = NULL;
+    uint32_t *parents = NULL, *states = NULL, *apps = NULL;
+    uint16_t *lranks = NULL, *nranks = NULL;
+    int32_t j, k, n, cnt, count, nattrs;
+    uint8_t implicit;
+    pmix_status_t rc;
+
+    cnt = 1;
+    rc = PMIx_Data_unpack(NULL, bkt, &n, &cnt, PMIX_INT32);
+    if (PMIX_SUCCESS != rc || 0 == n) {
+        return rc;
+    }
+    if (0 > n) {
+        return PMIX_ERR_UNPACK_FAILURE;
+    }
+    cnt = 1;
+    rc = PMIx_Data_unpack(NULL, bkt, &implicit, &cnt, PMIX_UINT8);
+    if (PMIX_SUCCESS != rc) {
+        return rc;
+    }
+
+    procs = (prte_proc_t **) calloc(n, sizeof(prte_proc_t *));
+    ranks = (pmix_rank_t *) malloc(n * sizeof(pmix_rank_t));
+    aranks = (pmix_rank_t *) malloc(n * sizeof(pmix_rank_t));
+    parents = (uint32_t *) malloc(n * sizeof(uint32_t));
+    states = (uint32_t *) malloc(n * sizeof(uint32_t));
+    apps = (uint32_t *) malloc(n * sizeof(uint32_t));
+    lranks = (uint16_t *) malloc(n * sizeof(uint16_t));
+    nranks = (uint16_t *) malloc(n * sizeof(uint16_t));
+    if (NULL == procs || NULL == ranks || NULL == aranks || NULL == parents || NULL == states
+        || NULL == apps || NULL == lranks || NULL == nranks) {
+        rc = PMIX_ERR_NOMEM;
+        goto done;
+    }
+
+    if (implicit) {
+        for (j = 0; j < n; j++) {
+            ranks[j] = j;
+        }
+    } else {
+        cnt = n;
+        if (PMIX_SUCCESS != (rc = PMIx_Data_unpack(NULL, bkt, ranks, &cnt, PMIX_PROC_RANK))) {
+            goto done;
+        }
+    }
+    if (PMIX_SUCCESS != (rc = unpack_runs(bkt, parents, n))) {
+        goto done;
+    }
+    cnt = n;
+    if (PMIX_SUCCESS != (rc = PMIx_Data_unpack(NULL, bkt, lranks, &cnt, PMIX_UINT16))) {
+        goto done;
+    }
+    cnt = n;
+    if (PMIX_SUCCESS != (rc = PMIx_Data_unpack(NULL, bkt, nranks, &cnt, PMIX_UINT16))) {
+        goto done;
+    }
+    if (PMIX_SUCCESS != (rc = unpack_runs(bkt, states, n))) {
+        goto done;
+    }
+    if (PMIX_SUCCESS != (rc = unpack_runs(bkt, apps, n))) {
+        goto done;
+    }
+    cnt = n;
+    if (PMIX_SUCCESS != (rc = PMIx_Data_unpack(NULL, bkt, aranks, &cnt, PMIX_PROC_RANK))) {
+        goto done;
+    }
+
+    for (j = 0; j < n; j++) {
+        proc = PRTE_NEW(prte_proc_t);
+        if (NULL == proc) {
+            rc = PMIX_ERR_NOMEM;
+            goto done;
+        }
+        PMIX_LOAD_PROCID(&proc->name, jptr->nspace, ranks[j]);
+        proc->parent = parents[j];
+        proc->local_rank = lranks[j];
+        proc->node_rank = nranks[j];
+        proc->state = states[j];
+        proc->app_idx = apps[j];
+        proc->app_rank = aranks[j];
+        procs[j] = proc;
+    }
+
+    cnt = 1;
+    if (PMIX_SUCCESS != (rc = PMIx_Data_unpack(NULL, bkt, &nattrs, &cnt, PMIX_INT32))) {
+        goto done;
+    }
+    for (; 0 < nattrs; nattrs--) {
+        cnt = 1;
+        if (PMIX_SUCCESS != (rc = PMIx_Data_unpack(NULL, bkt, &j, &cnt, PMIX_INT32))) {
+            goto done;
+        }
+        cnt = 1;
+        if (PMIX_SUCCESS != (rc = PMIx_Data_unpack(NULL, bkt, &count, &cnt, PMIX_INT32))) {
+            goto done;
+        }
+        if (0 > j || n <= j) {
+            rc = PMIX_ERR_UNPACK_FAILURE;
+            goto done;
+        }
+        for (k = 0; k < count; k++) {
+            kv = PRTE_NEW(prte_attribute_t);
+            cnt = 1;
+            rc = PMIx_Data_unpack(NULL, bkt, &kv->key, &cnt, PMIX_UINT16);
+            if (PMIX_SUCCESS == rc) {
+                cnt = 1;
+                rc = PMIx_Data_unpack(NULL, bkt, &kv->data, &cnt, PMIX_VALUE);
+            }
+            if (PMIX_SUCCESS != rc) {
+                PRTE_RELEASE(kv);
+                goto done;
+            }
+            kv->local = PRTE_ATTR_GLOBAL; // obviously not a local value
+            prte_list_append(&procs[j]->attributes, &kv->super);
+        }
+    }
+
+    /* only hand them over once everything has been unpacked */
+    for (j = 0; j < n; j++) {
+        prte_pointer_array_add(jptr->procs, procs[j]);
+        procs[j] = NULL;
+    }
+
+done:
+    if (NULL != procs) {
+        for (j = 0; j < n; j++) {
+            if (NULL != procs[j]) {
+                PRTE_RELEASE(procs[j]);
+            }
+        }
+        free(procs);
+    }
+    free(ranks);
+    free(aranks);
+    free(parents);
+    free(states);
+    free(apps);
+    free(lranks);
+    free(nranks);
+    return rc;
+}
+
 /*
  * JOB
  * NOTE: We do not pack all of the job object's fields as many of them have no
@@ -192,21 +407,23 @@ int prte_job_unpack(pmix_data_buffer_t *bkt, prte_job_t **job)
         PRTE_RELEASE(jptr);
         return prte_pmix_convert_status(rc);
     }
+    n = 1;
+    rc = PMIx_Data_unpack(NULL, bkt, &jptr->version, &n, PMIX_UINT32);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        PRTE_RELEASE(jptr);
+        return prte_pmix_convert_status(rc);
+    }
 
     if (0 < jptr->num_procs) {
         /* check attributes to see if this job was fully
          * described in the launch msg */
         if (prte_get_attribute(&jptr->attributes, PRTE_JOB_FULLY_DESCRIBED, NULL, PMIX_BOOL)) {
-            prte_proc_t *proc;
-            for (j = 0; j < jptr->num_procs; j++) {
-                n = 1;
-                rc = prte_proc_unpack(bkt, &proc);
-                if (PMIX_SUCCESS != rc) {
-                    PMIX_ERROR_LOG(rc);
-                    PRTE_RELEASE(jptr);
-                    return prte_pmix_convert_status(rc);
-                }
-                prte_pointer_array_add(jptr->procs, proc);
+            rc = unpack_procs(bkt, jptr);
+            if (PMIX_SUCCESS != rc) {
+                PMIX_ERROR_LOG(rc);
+                PRTE_RELEASE(jptr);
+                return prte_pmix_convert_status(rc);
             }
         }
     }
@@ -46,6 +46,7 @@
 #include "src/util/name_fns.h"
 #include "src/util/proc_info.h"
 #include "src/util/show_help.h"
+#include "src/util/trace.h"
 
 int prte_finalize(void)
 {
@@ -151,6 +152,9 @@ int prte_finalize(void)
         prte_argv_free(prte_fork_agent);
     }
 
+    /* write out any trace events we recorded */
+    prte_trace_dump("finalize");
+
     free(prte_process_info.nodename);
     prte_process_info.nodename = NULL;
 
@@ -158,6 +162,10 @@ int prte_finalize(void)
     if (PRTE_SUCCESS != (rc = prte_ess.finalize())) {
         return rc;
     }
+    /* the ess normally shuts down show_help while the rml is still
+     * up - this just releases it if the ess did not */
+    prte_show_help_finalize();
+    prte_trace_finalize();
 
     /* finalize schizo */
     prte_schizo.finalize();
@@ -267,6 +267,44 @@ int prte_set_job_data_object(prte_job_t *jdata)
     return PRTE_SUCCESS;
 }
 
+int prte_add_local_child(prte_job_t *jdata, prte_proc_t *child)
+{
+    int idx;
+
+    PRTE_RETAIN(child);
+    if (0 > (child->local_index = prte_pointer_array_add(prte_local_children, child))) {
+        PRTE_RELEASE(child);
+        return PRTE_ERR_OUT_OF_RESOURCE;
+    }
+    if (0 > (idx = prte_pointer_array_add(&jdata->local_children, child))) {
+        prte_pointer_array_set_item(prte_local_children, child->local_index, NULL);
+        child->local_index = -1;
+        PRTE_RELEASE(child);
+        return PRTE_ERR_OUT_OF_RESOURCE;
+    }
+    PRTE_FLAG_SET(child, PRTE_PROC_FLAG_LOCAL);
+    return PRTE_SUCCESS;
+}
+
+void prte_remove_local_children(prte_job_t *jdata)
+{
+    prte_proc_t *child;
+    int n;
+
+    for (n = 0; n < jdata->local_children.size; n++) {
+        child = (prte_proc_t *) prte_pointer_array_get_item(&jdata->local_children, n);
+        if (NULL == child) {
+            continue;
+        }
+        if (0 <= child->local_index) {
+            prte_pointer_array_set_item(prte_local_children, child->local_index, NULL);
+            child->local_index = -1;
+            PRTE_RELEASE(child); // maintain accounting
+        }
+    }
+    prte_pointer_array_remove_all(&jdata->local_children);
+}
+
 prte_proc_t *prte_get_proc_object(const pmix_proc_t *proc)
 {
     prte_job_t *jdata;
@@ -465,6 +503,7 @@ static void prte_job_construct(prte_job_t *job)
     job->stdin_target = 0;
     job->total_slots_alloc = 0;
     job->num_procs = 0;
+    job->version = 0;
     job->procs = PRTE_NEW(prte_pointer_array_t);
     prte_pointer_array_init(job->procs, PRTE_GLOBAL_ARRAY_BLOCK_SIZE, PRTE_GLOBAL_ARRAY_MAX_SIZE,
                             PRTE_GLOBAL_ARRAY_BLOCK_SIZE);
@@ -482,6 +521,9 @@ static void prte_job_construct(prte_job_t *job)
 
     PMIX_LOAD_PROCID(&job->originator, NULL, PMIX_RANK_INVALID);
     job->num_local_procs = 0;
+    PRTE_CONSTRUCT(&job->local_children, prte_pointer_array_t);
+    prte_pointer_array_init(&job->local_children, PRTE_GLOBAL_ARRAY_BLOCK_SIZE,
+                            PRTE_GLOBAL_ARRAY_MAX_SIZE, PRTE_GLOBAL_ARRAY_BLOCK_SIZE);
 
     job->flags = 0;
     PRTE_FLAG_SET(job, PRTE_JOB_FLAG_FORWARD_OUTPUT);
@@ -549,6 +591,8 @@ static void prte_job_destruct(prte_job_t *job)
         PRTE_RELEASE(proc);
     }
     PRTE_RELEASE(job->procs);
+    /* prte_local_children holds the references to these */
+    PRTE_DESTRUCT(&job->local_children);
 
     /* release the attributes */
     PRTE_LIST_DESTRUCT(&job->attributes);
@@ -648,6 +692,7 @@ static void prte_proc_construct(prte_proc_t *proc)
     proc->exit_code = 0; /* Assume we won't fail unless otherwise notified */
     proc->rml_uri = NULL;
     proc->flags = 0;
+    proc->local_index = -1;
     PRTE_CONSTRUCT(&proc->attributes, prte_list_t);
 }
 
@@ -327,6 +327,9 @@ typedef struct {
     pmix_rank_t num_procs;
     /* array of pointers to procs in this job */
     prte_pointer_array_t *procs;
+    /* bumped each time the placement of the procs is sent to the
+     * daemons, so they can tell whether their copy is current */
+    uint32_t version;
     /* map of the job */
     struct prte_job_map_t *map;
     /* bookmark for where we are in mapping - this
@@ -354,6 +357,8 @@ typedef struct {
     pmix_proc_t originator;
     /* number of local procs */
     pmix_rank_t num_local_procs;
+    /* this job's entries in prte_local_children, densely packed */
+    prte_pointer_array_t local_children;
     /* flags */
     prte_job_flags_t flags;
     /* attributes */
@@ -415,6 +420,9 @@ struct prte_proc_t {
     char *rml_uri;
     /* some boolean flags */
     prte_proc_flags_t flags;
+    /* index of this proc in prte_local_children, or -1 if it
+     * isn't one of our local children */
+    int local_index;
     /* list of prte_value_t attributes */
     prte_list_t attributes;
 };
@@ -437,6 +445,19 @@ PRTE_EXPORT prte_job_t *prte_get_job_data_object(const pmix_nspace_t job);
  */
 PRTE_EXPORT int prte_set_job_data_object(prte_job_t *jdata);
 
+/**
+ * Add a proc to prte_local_children and to its job's index of
+ * local children. The local children array holds a reference
+ * to the proc.
+ */
+PRTE_EXPORT int prte_add_local_child(prte_job_t *jdata, prte_proc_t *child);
+
+/**
+ * Remove all of a job's procs from prte_local_children, releasing
+ * the references held on them
+ */
+PRTE_EXPORT void prte_remove_local_children(prte_job_t *jdata);
+
 /** Pack/unpack a job object */
 PRTE_EXPORT int prte_job_pack(pmix_data_buffer_t *bkt, prte_job_t *job);
 PRTE_EXPORT int prte_job_unpack(pmix_data_buffer_t *bkt, prte_job_t **job);
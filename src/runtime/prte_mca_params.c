@@ -43,6 +43,7 @@
 #include "src/util/proc_info.h"
 #include "src/util/prte_environ.h"
 #include "src/util/show_help.h"
+#include "src/util/trace.h"
 #include "src/mca/errmgr/errmgr.h"
 
 #include "src/runtime/prte_globals.h"
@@ -666,6 +667,9 @@ int prte_register_params(void)
                                NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_5,
                                PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_pmix_verbose_output);
 
+    /* binary event tracing */
+    prte_trace_register_params();
+
 #if PRTE_ENABLE_FT
     prte_mca_base_var_register("prte", "prte", NULL, "enable_ft", "Enable/disable fault tolerance",
                                PRTE_MCA_BASE_VAR_TYPE_BOOL, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE,
@@ -127,6 +127,9 @@ static void report_prted(void);
 static pmix_data_buffer_t *bucket, *mybucket = NULL;
 static int ncollected = 0;
 static bool node_regex_waiting = false;
+/* true if we were launched along a planned launch tree - our launcher
+ * is then not our routing parent, so we report straight to the HNP */
+static bool report_direct = false;
 static bool prted_abort = false;
 static char *prte_parent_uri = NULL;
 static prte_cmd_line_t *prte_cmd_line = NULL;
@@ -563,7 +566,9 @@ int main(int argc, char *argv[])
         /* set the lifeline to point to our parent so that we
          * can handle the situation if that lifeline goes away
          */
-        if (PRTE_SUCCESS != (ret = prte_routed.set_lifeline(PRTE_PROC_MY_PARENT))) {
+        report_direct = prte_plm_globals.launch_planner;
+        if (!report_direct
+            && PRTE_SUCCESS != (ret = prte_routed.set_lifeline(PRTE_PROC_MY_PARENT))) {
             PRTE_ERROR_LOG(ret);
             goto DONE;
         }
@@ -1027,9 +1032,11 @@ report:
 static void report_prted(void)
 {
     int nreqd, ret;
+    pmix_proc_t *target;
 
-    /* get the number of children */
-    nreqd = prte_routed.num_routes() + 1;
+    /* get the number of children - daemons we launched along a
+     * planned tree report directly to the HNP, just like us */
+    nreqd = report_direct ? 1 : prte_routed.num_routes() + 1;
     if (nreqd == ncollected && NULL != mybucket && !node_regex_waiting) {
         /* add the collection of our children's buckets to ours */
         ret = PMIx_Data_copy_payload(mybucket, bucket);
@@ -1038,9 +1045,9 @@ static void report_prted(void)
         }
         PMIX_DATA_BUFFER_RELEASE(bucket);
         /* relay this on to our parent */
-        if (0 > (ret = prte_rml.send_buffer_nb(PRTE_PROC_MY_PARENT, mybucket,
-                                               PRTE_RML_TAG_PRTED_CALLBACK, prte_rml_send_callback,
-                                               NULL))) {
+        target = report_direct ? PRTE_PROC_MY_HNP : PRTE_PROC_MY_PARENT;
+        if (0 > (ret = prte_rml.send_buffer_nb(target, mybucket, PRTE_RML_TAG_PRTED_CALLBACK,
+                                               prte_rml_send_callback, NULL))) {
             PRTE_ERROR_LOG(ret);
             PMIX_DATA_BUFFER_RELEASE(mybucket);
         }
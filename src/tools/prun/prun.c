@@ -198,6 +198,7 @@ static void evhandler(size_t evhdlr_registration_id, pmix_status_t status,
     pmix_nspace_t jobid = {0};
     size_t n;
     char *msg = NULL;
+    uint32_t asize = 0, afailed = 0;
 
     if (verbose) {
         prte_output(0, "PRUN: EVHANDLER WITH STATUS %s(%d)", PMIx_Error_string(status), status);
@@ -215,11 +216,19 @@ static void evhandler(size_t evhdlr_registration_id, pmix_status_t status,
                 lock = (prte_pmix_lock_t *) info[n].value.data.ptr;
             } else if (0 == strncmp(info[n].key, PMIX_EVENT_TEXT_MESSAGE, PMIX_MAX_KEYLEN)) {
                 msg = info[n].value.data.string;
+            } else if (PMIX_CHECK_KEY(&info[n], PRTE_PMIX_JOB_ARRAY)) {
+                asize = info[n].value.data.uint32;
+            } else if (PMIX_CHECK_KEY(&info[n], PRTE_PMIX_JOB_ARRAY_FAILED)) {
+                afailed = info[n].value.data.uint32;
             }
         }
         if (verbose && PMIX_CHECK_NSPACE(jobid, spawnednspace)) {
             prte_output(0, "JOB %s COMPLETED WITH STATUS %d", PRTE_JOBID_PRINT(jobid), jobstatus);
         }
+        if (0 < afailed) {
+            fprintf(stderr, "%s: %u of %u job array elements failed\n", prte_tool_basename,
+                    afailed, asize);
+        }
     }
     if (NULL != lock) {
         /* save the status */
@@ -308,10 +317,446 @@ static prte_cmd_line_init_t prte_tool_options[] = {
     /* override personality */
     {'\0', "personality", 1, PRTE_CMD_LINE_TYPE_STRING, "Specify the personality to be used",
      PRTE_CMD_LINE_OTYPE_DVM},
+    /* job array */
+    {'\0', "array", 1, PRTE_CMD_LINE_TYPE_INT,
+     "Launch the application once for each of the given number of array elements as a single "
+     "job - each instance finds its index in the PRTE_ARRAY_INDEX envar",
+     PRTE_CMD_LINE_OTYPE_DVM},
+    /* modex prefetch */
+    {'\0', "prefetch", 1, PRTE_CMD_LINE_TYPE_STRING,
+     "Prefetch the connection data of the peers each proc will talk to, given as \"ranks:K\" "
+     "(the procs within K ranks) or \"nodes:G\" (the procs on the same group of G nodes)",
+     PRTE_CMD_LINE_OTYPE_DVM},
+    /* batch of jobs */
+    {'\0', "batch", 1, PRTE_CMD_LINE_TYPE_STRING,
+     "Run the jobs given one per line in the specified file (\"-\" for stdin) over a single "
+     "connection to the DVM. Each line holds the application part of a prun cmd line - job-level "
+     "options are taken from this cmd line",
+     PRTE_CMD_LINE_OTYPE_DVM},
+    {'\0', "batch-inflight", 1, PRTE_CMD_LINE_TYPE_INT,
+     "Max number of batch jobs to have running at the same time [default: 64]",
+     PRTE_CMD_LINE_OTYPE_DVM},
 
     /* End of list */
     {'\0', NULL, 0, PRTE_CMD_LINE_TYPE_NULL, NULL}};
 
+/* a job submitted in batch mode */
+typedef struct {
+    prte_list_item_t super;
+    int line;
+    pmix_app_t *apps;
+    size_t napps;
+    pmix_nspace_t nspace;
+    /* termination status, for a job whose end was reported
+     * before its spawn callback */
+    int status;
+} batch_job_t;
+static void bjcon(batch_job_t *p)
+{
+    p->apps = NULL;
+    p->napps = 0;
+    PMIX_LOAD_NSPACE(p->nspace, NULL);
+    p->status = 0;
+}
+static void bjdes(batch_job_t *p)
+{
+    if (NULL != p->apps) {
+        PMIX_APP_FREE(p->apps, p->napps);
+    }
+}
+static PRTE_CLASS_INSTANCE(batch_job_t, prte_list_item_t, bjcon, bjdes);
+
+static struct {
+    /* protects everything below - the callbacks run
+     * in the PMIx progress thread */
+    prte_pmix_lock_t lock;
+    /* jobs that were spawned and have not yet terminated */
+    prte_list_t running;
+    /* jobs whose termination arrived while a spawn callback was
+     * still outstanding - the job can end before its spawn
+     * callback tells us its nspace */
+    prte_list_t ended;
+    int inflight;
+    int nspawned;
+    int ncompleted;
+    int nfailed;
+    int status;
+} batch;
+
+static int apps_to_array(prte_cmd_line_t *cmd, prte_list_t *apps, pmix_app_t **papps,
+                         size_t *napps)
+{
+    prte_pmix_app_t *app;
+    pmix_data_array_t darray;
+    pmix_status_t ret;
+    size_t n;
+    int rc;
+
+    *napps = prte_list_get_size(apps);
+    PMIX_APP_CREATE(*papps, *napps);
+    n = 0;
+    PRTE_LIST_FOREACH(app, apps, prte_pmix_app_t)
+    {
+        (*papps)[n].cmd = strdup(app->app.cmd);
+        (*papps)[n].argv = prte_argv_copy(app->app.argv);
+        (*papps)[n].env = prte_argv_copy(app->app.env);
+        (*papps)[n].cwd = strdup(app->app.cwd);
+        (*papps)[n].maxprocs = app->app.maxprocs;
+        PMIX_INFO_LIST_CONVERT(ret, app->info, &darray);
+        if (PMIX_SUCCESS != ret && PMIX_ERR_EMPTY != ret) {
+            return prte_pmix_convert_status(ret);
+        }
+        (*papps)[n].info = (pmix_info_t *) darray.array;
+        (*papps)[n].ninfo = darray.size;
+        /* pickup any relevant envars */
+        rc = prte_schizo.parse_env(cmd, environ, &(*papps)[n].env, false);
+        if (PRTE_SUCCESS != rc) {
+            return rc;
+        }
+        ++n;
+    }
+    return PRTE_SUCCESS;
+}
+
+/* account for a terminated job - must be called with the batch lock held */
+static void batch_job_done(batch_job_t *job, int jobstatus)
+{
+    if (verbose) {
+        prte_output(0, "JOB %s (LINE %d) COMPLETED WITH STATUS %d",
+                    PRTE_JOBID_PRINT(job->nspace), job->line, jobstatus);
+    }
+    PRTE_RELEASE(job);
+    --batch.inflight;
+    ++batch.ncompleted;
+    if (0 != jobstatus) {
+        ++batch.nfailed;
+        if (0 == batch.status) {
+            batch.status = jobstatus;
+        }
+    }
+}
+
+static void batch_spawn_cbfunc(pmix_status_t status, pmix_nspace_t nspace, void *cbdata)
+{
+    batch_job_t *job = (batch_job_t *) cbdata;
+    batch_job_t *ended;
+
+    prte_mutex_lock(&batch.lock.mutex);
+    /* the request has been sent, so we are done with the apps */
+    PMIX_APP_FREE(job->apps, job->napps);
+    job->apps = NULL;
+    if (PMIX_SUCCESS == status) {
+        PMIX_LOAD_NSPACE(job->nspace, nspace);
+        if (verbose) {
+            prte_output(0, "JOB %s (LINE %d) EXECUTING", PRTE_JOBID_PRINT(nspace), job->line);
+        }
+        /* it may already have terminated */
+        PRTE_LIST_FOREACH(ended, &batch.ended, batch_job_t)
+        {
+            if (0 == strncmp(ended->nspace, nspace, PMIX_MAX_NSLEN)) {
+                prte_list_remove_item(&batch.ended, &ended->super);
+                batch_job_done(job, ended->status);
+                PRTE_RELEASE(ended);
+                job = NULL;
+                break;
+            }
+        }
+        if (NULL != job) {
+            prte_list_append(&batch.running, &job->super);
+        }
+    } else {
+        fprintf(stderr, "%s: job on line %d failed to spawn: %s\n", prte_tool_basename,
+                job->line, PMIx_Error_string(status));
+        --batch.inflight;
+        ++batch.nfailed;
+        if (0 == batch.status) {
+            batch.status = prte_pmix_convert_status(status);
+        }
+        PRTE_RELEASE(job);
+    }
+    pthread_cond_broadcast(&batch.lock.cond);
+    prte_mutex_unlock(&batch.lock.mutex);
+}
+
+static void batch_evhandler(size_t evhdlr_registration_id, pmix_status_t status,
+                            const pmix_proc_t *source, pmix_info_t info[], size_t ninfo,
+                            pmix_info_t *results, size_t nresults,
+                            pmix_event_notification_cbfunc_fn_t cbfunc, void *cbdata)
+{
+    batch_job_t *job;
+    int jobstatus = 0;
+    pmix_nspace_t jobid = {0};
+    bool found = false;
+    size_t n;
+
+    for (n = 0; n < ninfo; n++) {
+        if (PMIX_CHECK_KEY(&info[n], PMIX_JOB_TERM_STATUS)) {
+            jobstatus = prte_pmix_convert_status(info[n].value.data.status);
+        } else if (PMIX_CHECK_KEY(&info[n], PMIX_EVENT_AFFECTED_PROC)) {
+            PMIX_LOAD_NSPACE(jobid, info[n].value.data.proc->nspace);
+        }
+    }
+    /* we can't tell which job this is about without the nspace - and
+     * an empty one would match any of ours */
+    if (PMIX_NSPACE_INVALID(jobid)) {
+        goto done;
+    }
+
+    prte_mutex_lock(&batch.lock.mutex);
+    PRTE_LIST_FOREACH(job, &batch.running, batch_job_t)
+    {
+        if (0 == strncmp(job->nspace, jobid, PMIX_MAX_NSLEN)) {
+            prte_list_remove_item(&batch.running, &job->super);
+            batch_job_done(job, jobstatus);
+            pthread_cond_broadcast(&batch.lock.cond);
+            found = true;
+            break;
+        }
+    }
+    /* not one of our running jobs - if any of our spawns have yet
+     * to be acknowledged, it may be one of those, so hold on to it
+     * for batch_spawn_cbfunc. Anything else is someone else's job */
+    if (!found && batch.inflight > (int) prte_list_get_size(&batch.running)) {
+        job = PRTE_NEW(batch_job_t);
+        PMIX_LOAD_NSPACE(job->nspace, jobid);
+        job->status = jobstatus;
+        prte_list_append(&batch.ended, &job->super);
+    }
+    prte_mutex_unlock(&batch.lock.mutex);
+
+done:
+    /* we _always_ have to execute the evhandler callback or
+     * else the event progress engine will hang */
+    if (NULL != cbfunc) {
+        cbfunc(PMIX_EVENT_ACTION_COMPLETE, NULL, 0, NULL, NULL, cbdata);
+    }
+}
+
+/* wait until no more than max batch jobs are in flight */
+static void batch_wait(int max)
+{
+    prte_mutex_lock(&batch.lock.mutex);
+    while (max < batch.inflight) {
+        prte_pmix_condition_wait(&batch.lock.cond, &batch.lock.mutex);
+    }
+    prte_mutex_unlock(&batch.lock.mutex);
+}
+
+/* true if the option is one that can't be carried from our own
+ * cmd line into a batch line because the line already sets it */
+static bool batch_line_overrides(prte_cmd_line_t *cmd, prte_cmd_line_option_t *option)
+{
+    char sname[2];
+
+    if (NULL != option->clo_long_name) {
+        if (0 == strcmp(option->clo_long_name, "batch")
+            || 0 == strcmp(option->clo_long_name, "batch-inflight")) {
+            return true;
+        }
+        /* -n and --np are the same thing */
+        if (0 == strcmp(option->clo_long_name, "np") || 0 == strcmp(option->clo_long_name, "n")) {
+            return prte_cmd_line_is_taken(cmd, "np") || prte_cmd_line_is_taken(cmd, "n");
+        }
+        return prte_cmd_line_is_taken(cmd, option->clo_long_name);
+    }
+    /* the values of -x accumulate */
+    if ('x' == option->clo_short_name) {
+        return false;
+    }
+    sname[0] = option->clo_short_name;
+    sname[1] = '\0';
+    return prte_cmd_line_is_taken(cmd, sname);
+}
+
+/*
+ * Build the cmd line for one line of a batch file in a cmd line
+ * object of its own. The options given to us on our own cmd line
+ * (e.g., -x) apply to every job, so they are placed ahead of those
+ * on the line - unless the line sets the same option, in which case
+ * the line's value is used. The merged argv is returned in margv
+ */
+static prte_cmd_line_t *batch_cmd_line(prte_schizo_base_module_t *schizo, char **pargv,
+                                       char **largv, char ***margv)
+{
+    prte_cmd_line_t *cmd;
+    prte_cmd_line_option_t *option;
+    prte_cmd_line_init_t e;
+    int i, j, margc = 0;
+
+    cmd = PRTE_NEW(prte_cmd_line_t);
+    if (PRTE_SUCCESS != schizo->define_cli(cmd)
+        || PRTE_SUCCESS != prte_cmd_line_add(cmd, prte_tool_options)) {
+        PRTE_RELEASE(cmd);
+        return NULL;
+    }
+    /* find out which options the line sets */
+    if (PRTE_SUCCESS != prte_cmd_line_parse(cmd, true, false, prte_argv_count(largv), largv)) {
+        PRTE_RELEASE(cmd);
+        return NULL;
+    }
+
+    *margv = NULL;
+    prte_argv_append(&margc, margv, largv[0]);
+    for (i = 1; NULL != pargv[i]; i++) {
+        /* our own cmd line has no app, but stop at anything that
+         * isn't an option just in case */
+        if ('-' != pargv[i][0] || 0 == strcmp(pargv[i], "--")) {
+            break;
+        }
+        memset(&e, 0, sizeof(prte_cmd_line_init_t));
+        if (0 == strncmp(pargv[i], "--", 2)) {
+            e.ocl_cmd_long_name = &pargv[i][2];
+        } else if (0 == strcmp(pargv[i], "-np")) {
+            e.ocl_cmd_long_name = &pargv[i][1];
+        } else if (2 == strlen(pargv[i])) {
+            e.ocl_cmd_short_name = pargv[i][1];
+        }
+        if (NULL == (option = prte_cmd_line_find_option(cmd, &e))) {
+            continue;
+        }
+        if (batch_line_overrides(cmd, option)) {
+            i += option->clo_num_params;
+            continue;
+        }
+        for (j = 0; j <= option->clo_num_params && NULL != pargv[i]; j++, i++) {
+            prte_argv_append(&margc, margv, pargv[i]);
+        }
+        --i;
+    }
+    for (i = 1; NULL != largv[i]; i++) {
+        prte_argv_append(&margc, margv, largv[i]);
+    }
+    return cmd;
+}
+
+/*
+ * Read job specifications from the given file and keep up to
+ * maxinflight of them running at any time, all thru the one
+ * connection we already have to the DVM
+ */
+static int run_batch(char *path, int maxinflight, pmix_info_t *jinfo, size_t njinfo,
+                     prte_schizo_base_module_t *schizo, char **pargv)
+{
+    FILE *fp;
+    char *line, **largv, **margv;
+    prte_cmd_line_t *cmd;
+    int lineno = 0, rc = PRTE_SUCCESS;
+    prte_list_t apps;
+    batch_job_t *job;
+    prte_pmix_lock_t lock;
+    pmix_status_t code = PMIX_EVENT_JOB_END, ret;
+    pmix_info_t info;
+    struct timeval start, end;
+    double secs;
+
+    if (0 == strcmp(path, "-")) {
+        fp = stdin;
+    } else if (NULL == (fp = fopen(path, "r"))) {
+        prte_show_help("help-prun.txt", "file-open-error", true, prte_tool_basename, "--batch",
+                       path, path);
+        return PRTE_ERR_BAD_PARAM;
+    }
+    if (0 >= maxinflight) {
+        maxinflight = 1;
+    }
+
+    PRTE_PMIX_CONSTRUCT_LOCK(&batch.lock);
+    PRTE_CONSTRUCT(&batch.running, prte_list_t);
+    PRTE_CONSTRUCT(&batch.ended, prte_list_t);
+
+    /* one handler collects the termination of all our jobs */
+    PMIX_INFO_LOAD(&info, PMIX_EVENT_HDLR_NAME, "BATCH_JOB_TERMINATION", PMIX_STRING);
+    PRTE_PMIX_CONSTRUCT_LOCK(&lock);
+    PMIx_Register_event_handler(&code, 1, &info, 1, batch_evhandler, regcbfunc, &lock);
+    PRTE_PMIX_WAIT_THREAD(&lock);
+    PRTE_PMIX_DESTRUCT_LOCK(&lock);
+    PMIX_INFO_DESTRUCT(&info);
+
+    gettimeofday(&start, NULL);
+    while (NULL != (line = prte_schizo_base_getline(fp))) {
+        ++lineno;
+        largv = prte_argv_split(line, ' ');
+        free(line);
+        if (NULL == largv || NULL == largv[0] || '#' == largv[0][0]) {
+            prte_argv_free(largv);
+            continue;
+        }
+        prte_argv_prepend_nosize(&largv, prte_tool_basename);
+
+        PRTE_CONSTRUCT(&apps, prte_list_t);
+        job = PRTE_NEW(batch_job_t);
+        job->line = lineno;
+        margv = NULL;
+        cmd = batch_cmd_line(schizo, pargv, largv, &margv);
+        prte_argv_free(largv);
+        if (NULL == cmd) {
+            rc = PRTE_ERR_BAD_PARAM;
+        } else {
+            rc = prte_parse_locals(cmd, &apps, prte_argv_count(margv), margv, NULL, NULL);
+        }
+        if (PRTE_SUCCESS == rc && 0 < prte_list_get_size(&apps)) {
+            rc = apps_to_array(cmd, &apps, &job->apps, &job->napps);
+        } else if (PRTE_SUCCESS == rc) {
+            rc = PRTE_ERR_BAD_PARAM;
+        }
+        PRTE_LIST_DESTRUCT(&apps);
+        prte_argv_free(margv);
+        if (NULL != cmd) {
+            PRTE_RELEASE(cmd);
+        }
+        if (PRTE_SUCCESS != rc) {
+            fprintf(stderr, "%s: could not parse the job on line %d of %s\n",
+                    prte_tool_basename, lineno, path);
+            PRTE_RELEASE(job);
+            prte_mutex_lock(&batch.lock.mutex);
+            ++batch.nfailed;
+            if (0 == batch.status) {
+                batch.status = rc;
+            }
+            prte_mutex_unlock(&batch.lock.mutex);
+            rc = PRTE_SUCCESS;
+            continue;
+        }
+
+        /* make room for it */
+        batch_wait(maxinflight - 1);
+
+        prte_mutex_lock(&batch.lock.mutex);
+        ++batch.inflight;
+        ++batch.nspawned;
+        prte_mutex_unlock(&batch.lock.mutex);
+        ret = PMIx_Spawn_nb(jinfo, njinfo, job->apps, job->napps, batch_spawn_cbfunc, job);
+        if (PMIX_SUCCESS != ret) {
+            batch_spawn_cbfunc(ret, NULL, job);
+        }
+    }
+    if (stdin != fp) {
+        fclose(fp);
+    }
+
+    /* wait for everything to finish */
+    batch_wait(0);
+    gettimeofday(&end, NULL);
+
+    PRTE_PMIX_CONSTRUCT_LOCK(&lock);
+    PMIx_Deregister_event_handler(evid, opcbfunc, &lock);
+    PRTE_PMIX_WAIT_THREAD(&lock);
+    PRTE_PMIX_DESTRUCT_LOCK(&lock);
+
+    if (verbose) {
+        secs = (double) (end.tv_sec - start.tv_sec) + (double) (end.tv_usec - start.tv_usec) / 1e6;
+        prte_output(0, "BATCH: %d jobs spawned, %d completed, %d failed in %.3f sec (%.1f jobs/sec)",
+                    batch.nspawned, batch.ncompleted, batch.nfailed, secs,
+                    (0 < secs) ? (double) batch.ncompleted / secs : 0.0);
+    }
+
+    rc = batch.status;
+    PRTE_LIST_DESTRUCT(&batch.running);
+    PRTE_LIST_DESTRUCT(&batch.ended);
+    PRTE_PMIX_DESTRUCT_LOCK(&batch.lock);
+    return rc;
+}
+
 int prun(int argc, char *argv[])
 {
     int rc = 1, i;
@@ -866,6 +1311,23 @@ int prun(int argc, char *argv[])
         PMIX_INFO_LIST_ADD(ret, jinfo, PMIX_STDIN_TGT, pval->value.data.string, PMIX_STRING);
     }
 
+    /* launch the app once per element of a job array */
+    if (NULL != (pval = prte_cmd_line_get_param(prte_cmd_line, "array", 0, 0))) {
+        if (0 >= pval->value.data.integer) {
+            fprintf(stderr, "%s: the --array option requires a positive number of elements\n",
+                    prte_tool_basename);
+            goto DONE;
+        }
+        ui32 = pval->value.data.integer;
+        PMIX_INFO_LIST_ADD(ret, jinfo, PRTE_PMIX_JOB_ARRAY, &ui32, PMIX_UINT32);
+    }
+
+    /* prefetch the modex data of the declared peers */
+    if (NULL != (pval = prte_cmd_line_get_param(prte_cmd_line, "prefetch", 0, 0))) {
+        PMIX_INFO_LIST_ADD(ret, jinfo, PRTE_PMIX_DMODEX_PREFETCH, pval->value.data.string,
+                           PMIX_STRING);
+    }
+
     if (NULL != (pval = prte_cmd_line_get_param(prte_cmd_line, "map-by", 0, 0))) {
         PMIX_INFO_LIST_ADD(ret, jinfo, PMIX_MAPBY, pval->value.data.string, PMIX_STRING);
         if (NULL != strcasestr(pval->value.data.string, "DONOTLAUNCH")) {
@@ -976,6 +1438,25 @@ int prun(int argc, char *argv[])
     /* mark that we harvested envars so prte knows not to do it again */
     PMIX_INFO_LIST_ADD(ret, jinfo, PMIX_ENVARS_HARVESTED, NULL, PMIX_BOOL);
 
+    /* if they gave us a batch of jobs, run those instead */
+    if (NULL != (pval = prte_cmd_line_get_param(prte_cmd_line, "batch", 0, 0))) {
+        param = strdup(pval->value.data.string);
+        i = 64;
+        if (NULL != (pval = prte_cmd_line_get_param(prte_cmd_line, "batch-inflight", 0, 0))) {
+            i = pval->value.data.integer;
+        }
+        PMIX_INFO_LIST_CONVERT(ret, jinfo, &darray);
+        iptr = (pmix_info_t *) darray.array;
+        ninfo = darray.size;
+        PMIX_INFO_LIST_RELEASE(jinfo);
+        PRTE_LIST_DESTRUCT(&apps);
+        rc = run_batch(param, i, iptr, ninfo, schizo, pargv);
+        free(param);
+        PMIX_INFO_FREE(iptr, ninfo);
+        PRTE_PMIX_DESTRUCT_LOCK(&rellock);
+        goto DONE;
+    }
+
 
     /* they want to run an application, so let's parse
      * the cmd line to get it */
@@ -999,25 +1480,8 @@ int prun(int argc, char *argv[])
     PMIX_INFO_LIST_RELEASE(jinfo);
 
     /* convert the apps to an array */
-    napps = prte_list_get_size(&apps);
-    PMIX_APP_CREATE(papps, napps);
-    n = 0;
-    PRTE_LIST_FOREACH(app, &apps, prte_pmix_app_t)
-    {
-        papps[n].cmd = strdup(app->app.cmd);
-        papps[n].argv = prte_argv_copy(app->app.argv);
-        papps[n].env = prte_argv_copy(app->app.env);
-        papps[n].cwd = strdup(app->app.cwd);
-        papps[n].maxprocs = app->app.maxprocs;
-        PMIX_INFO_LIST_CONVERT(ret, app->info, &darray);
-        papps[n].info = (pmix_info_t *) darray.array;
-        papps[n].ninfo = darray.size;
-        /* pickup any relevant envars */
-        rc = prte_schizo.parse_env(prte_cmd_line, environ, &papps[n].env, false);
-        if (PRTE_SUCCESS != rc) {
-            goto DONE;
-        }
-        ++n;
+    if (PRTE_SUCCESS != (rc = apps_to_array(prte_cmd_line, &apps, &papps, &napps))) {
+        goto DONE;
     }
     PRTE_LIST_DESTRUCT(&apps);
 
@@ -458,6 +458,12 @@ const char *prte_attr_key_to_str(prte_attribute_key_t key)
             return "ENVARS-HARVESTED";
         case PRTE_JOB_OUTPUT_NOCOPY:
             return "DO-NOT-COPY-OUTPUT";
+        case PRTE_JOB_ARRAY_SIZE:
+            return "JOB-ARRAY-SIZE";
+        case PRTE_JOB_ARRAY_NUM_FAILED:
+            return "JOB-ARRAY-NUM-FAILED";
+        case PRTE_JOB_DMODEX_PREFETCH:
+            return "DMODEX-PREFETCH";
 
         case PRTE_PROC_NOBARRIER:
             return "PROC-NOBARRIER";
@@ -196,6 +196,9 @@ typedef uint16_t prte_job_flags_t;
 #define PRTE_JOB_STOP_IN_APP                (PRTE_JOB_START_KEY + 89) // pmix_rank_t of procs to stop
 #define PRTE_JOB_ENVARS_HARVESTED           (PRTE_JOB_START_KEY + 90) // envars have already been harvested
 #define PRTE_JOB_OUTPUT_NOCOPY              (PRTE_JOB_START_KEY + 91) // bool - do not copy output to stdout/err
+#define PRTE_JOB_ARRAY_SIZE                 (PRTE_JOB_START_KEY + 92) // uint32_t - number of elements in a job array
+#define PRTE_JOB_ARRAY_NUM_FAILED           (PRTE_JOB_START_KEY + 93) // uint32_t - number of job array elements that terminated abnormally
+#define PRTE_JOB_DMODEX_PREFETCH            (PRTE_JOB_START_KEY + 94) // string - peers whose modex data is to be prefetched
 
 #define PRTE_JOB_MAX_KEY 300
 
@@ -24,6 +24,7 @@
 #ifdef HAVE_STDIO_H
 #    include <stdio.h>
 #endif /* HAVE_STDIO_H */
+#include <pthread.h>
 #include <stdlib.h>
 #ifdef HAVE_STRINGS_H
 #    include <strings.h>
@@ -34,6 +35,17 @@
 #endif /* HAVE_UNISTD_H */
 #include "src/util/crc.h"
 
+#if PRTE_HAVE_CRC32C_SSE42
+#    include <nmmintrin.h>
+#endif
+#if PRTE_HAVE_CSUM_AVX2
+#    include <immintrin.h>
+#endif
+#if PRTE_HAVE_CRC32C_ARMV8
+#    include <arm_acle.h>
+#    include <sys/auxv.h>
+#endif
+
 #if (ALIGNOF_LONG == 8)
 #    define PRTE_CRC_WORD_MASK_ 0x7
 #elif (ALIGNOF_LONG == 4)
@@ -46,6 +58,279 @@
 
 #define INTALIGNED(v) (((intptr_t) v & 3) ? false : true)
 
+/*
+ * Word-summing kernels used by the aligned fast paths of the checksum
+ * routines, and the CRC32C kernels. The portable versions are always
+ * available - accelerated versions are compiled with per-function
+ * target attributes (when configure found the compiler could do so)
+ * and selected once at runtime based on what the CPU supports.
+ */
+typedef unsigned long (*prte_csum_long_fn_t)(const unsigned long *src, unsigned long *dst,
+                                             size_t nwords);
+typedef unsigned int (*prte_csum_int_fn_t)(const unsigned int *src, unsigned int *dst,
+                                           size_t nwords);
+typedef uint32_t (*prte_crc32c_fn_t)(const unsigned char *src, size_t len, uint32_t crc);
+
+static unsigned long csum_long_generic(const unsigned long *src, unsigned long *dst, size_t nwords)
+{
+    unsigned long csum = 0;
+    size_t i;
+
+    if (NULL == dst) {
+        for (i = 0; i < nwords; i++) {
+            csum += src[i];
+        }
+    } else {
+        for (i = 0; i < nwords; i++) {
+            csum += src[i];
+            dst[i] = src[i];
+        }
+    }
+    return csum;
+}
+
+static unsigned int csum_int_generic(const unsigned int *src, unsigned int *dst, size_t nwords)
+{
+    unsigned int csum = 0;
+    size_t i;
+
+    if (NULL == dst) {
+        for (i = 0; i < nwords; i++) {
+            csum += src[i];
+        }
+    } else {
+        for (i = 0; i < nwords; i++) {
+            csum += src[i];
+            dst[i] = src[i];
+        }
+    }
+    return csum;
+}
+
+#if PRTE_HAVE_CSUM_AVX2
+/* the sums are taken modulo the word size, so adding the words in
+ * four (or eight) independent lanes and folding the lanes at the end
+ * yields exactly the same result as the sequential loop */
+__attribute__((target("avx2"))) static unsigned long
+csum_long_avx2(const unsigned long *src, unsigned long *dst, size_t nwords)
+{
+    __m256i acc = _mm256_setzero_si256();
+    __m256i v;
+    unsigned long lanes[4];
+    unsigned long csum;
+    size_t i = 0;
+
+    if (NULL == dst) {
+        for (; i + 4 <= nwords; i += 4) {
+            v = _mm256_loadu_si256((const __m256i *) (src + i));
+            acc = _mm256_add_epi64(acc, v);
+        }
+    } else {
+        for (; i + 4 <= nwords; i += 4) {
+            v = _mm256_loadu_si256((const __m256i *) (src + i));
+            _mm256_storeu_si256((__m256i *) (dst + i), v);
+            acc = _mm256_add_epi64(acc, v);
+        }
+    }
+    _mm256_storeu_si256((__m256i *) lanes, acc);
+    csum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (; i < nwords; i++) {
+        csum += src[i];
+        if (NULL != dst) {
+            dst[i] = src[i];
+        }
+    }
+    return csum;
+}
+
+__attribute__((target("avx2"))) static unsigned int
+csum_int_avx2(const unsigned int *src, unsigned int *dst, size_t nwords)
+{
+    __m256i acc = _mm256_setzero_si256();
+    __m256i v;
+    unsigned int lanes[8];
+    unsigned int csum = 0;
+    size_t i = 0;
+    int n;
+
+    if (NULL == dst) {
+        for (; i + 8 <= nwords; i += 8) {
+            v = _mm256_loadu_si256((const __m256i *) (src + i));
+            acc = _mm256_add_epi32(acc, v);
+        }
+    } else {
+        for (; i + 8 <= nwords; i += 8) {
+            v = _mm256_loadu_si256((const __m256i *) (src + i));
+            _mm256_storeu_si256((__m256i *) (dst + i), v);
+            acc = _mm256_add_epi32(acc, v);
+        }
+    }
+    _mm256_storeu_si256((__m256i *) lanes, acc);
+    for (n = 0; n < 8; n++) {
+        csum += lanes[n];
+    }
+    for (; i < nwords; i++) {
+        csum += src[i];
+        if (NULL != dst) {
+            dst[i] = src[i];
+        }
+    }
+    return csum;
+}
+#endif
+
+/* CRC32C tables for the portable slice-by-8 implementation */
+#define PRTE_CRC32C_POLYNOMIAL ((uint32_t) 0x82f63b78)
+static uint32_t _prte_crc32c_table[8][256];
+
+static void crc32c_init_table(void)
+{
+    uint32_t crc;
+    int i, j;
+
+    for (i = 0; i < 256; i++) {
+        crc = i;
+        for (j = 0; j < 8; j++) {
+            crc = (crc & 1) ? (crc >> 1) ^ PRTE_CRC32C_POLYNOMIAL : (crc >> 1);
+        }
+        _prte_crc32c_table[0][i] = crc;
+    }
+    for (i = 0; i < 256; i++) {
+        crc = _prte_crc32c_table[0][i];
+        for (j = 1; j < 8; j++) {
+            crc = _prte_crc32c_table[0][crc & 0xff] ^ (crc >> 8);
+            _prte_crc32c_table[j][i] = crc;
+        }
+    }
+}
+
+static uint32_t crc32c_generic(const unsigned char *src, size_t len, uint32_t crc)
+{
+    uint32_t lo, hi;
+
+    while (len && ((uintptr_t) src & 7)) {
+        crc = _prte_crc32c_table[0][(crc ^ *src++) & 0xff] ^ (crc >> 8);
+        len--;
+    }
+    while (len >= 8) {
+        memcpy(&lo, src, sizeof(lo));
+        memcpy(&hi, src + 4, sizeof(hi));
+#ifdef WORDS_BIGENDIAN
+        lo = __builtin_bswap32(lo);
+        hi = __builtin_bswap32(hi);
+#endif
+        lo ^= crc;
+        crc = _prte_crc32c_table[7][lo & 0xff] ^ _prte_crc32c_table[6][(lo >> 8) & 0xff]
+              ^ _prte_crc32c_table[5][(lo >> 16) & 0xff] ^ _prte_crc32c_table[4][lo >> 24]
+              ^ _prte_crc32c_table[3][hi & 0xff] ^ _prte_crc32c_table[2][(hi >> 8) & 0xff]
+              ^ _prte_crc32c_table[1][(hi >> 16) & 0xff] ^ _prte_crc32c_table[0][hi >> 24];
+        src += 8;
+        len -= 8;
+    }
+    while (len--) {
+        crc = _prte_crc32c_table[0][(crc ^ *src++) & 0xff] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+#if PRTE_HAVE_CRC32C_SSE42
+__attribute__((target("sse4.2"))) static uint32_t crc32c_sse42(const unsigned char *src,
+                                                               size_t len, uint32_t crc)
+{
+    uint64_t crc64, word;
+
+    while (len && ((uintptr_t) src & 7)) {
+        crc = _mm_crc32_u8(crc, *src++);
+        len--;
+    }
+    crc64 = crc;
+    while (len >= 8) {
+        memcpy(&word, src, sizeof(word));
+        crc64 = _mm_crc32_u64(crc64, word);
+        src += 8;
+        len -= 8;
+    }
+    crc = (uint32_t) crc64;
+    while (len--) {
+        crc = _mm_crc32_u8(crc, *src++);
+    }
+    return crc;
+}
+#endif
+
+#if PRTE_HAVE_CRC32C_ARMV8
+__attribute__((target("+crc"))) static uint32_t crc32c_armv8(const unsigned char *src, size_t len,
+                                                             uint32_t crc)
+{
+    uint64_t word;
+
+    while (len && ((uintptr_t) src & 7)) {
+        crc = __crc32cb(crc, *src++);
+        len--;
+    }
+    while (len >= 8) {
+        memcpy(&word, src, sizeof(word));
+        crc = __crc32cd(crc, word);
+        src += 8;
+        len -= 8;
+    }
+    while (len--) {
+        crc = __crc32cb(crc, *src++);
+    }
+    return crc;
+}
+#endif
+
+static struct {
+    prte_csum_long_fn_t csum_long;
+    prte_csum_int_fn_t csum_int;
+    prte_crc32c_fn_t crc32c;
+    const char *name;
+} prte_crc_kernels = {csum_long_generic, csum_int_generic, crc32c_generic, "generic"};
+
+/* selection fills in the CRC32C tables and the kernel pointers, and
+ * pthread_once ensures it runs exactly once and that every caller
+ * sees all of it before using any kernel - threads making their first
+ * call at the same time would otherwise race on the tables */
+static pthread_once_t prte_crc_kernels_once = PTHREAD_ONCE_INIT;
+
+static void crc_select_kernels(void)
+{
+    crc32c_init_table();
+    prte_crc_kernels.csum_long = csum_long_generic;
+    prte_crc_kernels.csum_int = csum_int_generic;
+    prte_crc_kernels.crc32c = crc32c_generic;
+    prte_crc_kernels.name = "generic";
+
+#if PRTE_HAVE_CRC32C_SSE42 || PRTE_HAVE_CSUM_AVX2
+    __builtin_cpu_init();
+#endif
+#if PRTE_HAVE_CRC32C_SSE42
+    if (__builtin_cpu_supports("sse4.2")) {
+        prte_crc_kernels.crc32c = crc32c_sse42;
+        prte_crc_kernels.name = "sse4.2";
+    }
+#endif
+#if PRTE_HAVE_CSUM_AVX2
+    if (__builtin_cpu_supports("avx2")) {
+        if (8 == sizeof(unsigned long)) {
+            prte_crc_kernels.csum_long = csum_long_avx2;
+        }
+        prte_crc_kernels.csum_int = csum_int_avx2;
+        prte_crc_kernels.name = (prte_crc_kernels.crc32c == crc32c_generic) ? "avx2"
+                                                                            : "sse4.2,avx2";
+    }
+#endif
+#if PRTE_HAVE_CRC32C_ARMV8
+    if (getauxval(AT_HWCAP) & HWCAP_CRC32) {
+        prte_crc_kernels.crc32c = crc32c_armv8;
+        prte_crc_kernels.name = "armv8-crc";
+    }
+#endif
+}
+
+#define PRTE_CRC_KERNELS_SELECT() (void) pthread_once(&prte_crc_kernels_once, crc_select_kernels)
+
 /*
  * this version of bcopy_csum() looks a little too long, but it
  * handles cumulative checksumming for arbitrary lengths and address
@@ -104,10 +389,11 @@ unsigned long prte_bcopy_csum_partial(const void *source, void *destination, siz
             }
         } else { /* fast path... */
             size_t numLongs = copylen / sizeof(unsigned long);
-            for (i = 0; i < numLongs; i++) {
-                csum += *src;
-                *dest++ = *src++;
-            }
+            PRTE_CRC_KERNELS_SELECT();
+            csum += prte_crc_kernels.csum_long(src, dest, numLongs);
+            src += numLongs;
+            dest += numLongs;
+            i = numLongs;
             *lastPartialLong = 0;
             *lastPartialLength = 0;
             if (WORDALIGNED(copylen) && (csumlenresidue == 0)) {
@@ -431,10 +717,11 @@ unsigned int prte_bcopy_uicsum_partial(const void *source, void *destination, si
             }
         } else { /* fast path... */
             size_t numLongs = copylen / sizeof(unsigned int);
-            for (i = 0; i < numLongs; i++) {
-                csum += *src;
-                *dest++ = *src++;
-            }
+            PRTE_CRC_KERNELS_SELECT();
+            csum += prte_crc_kernels.csum_int(src, dest, numLongs);
+            src += numLongs;
+            dest += numLongs;
+            i = numLongs;
             *lastPartialInt = 0;
             *lastPartialLength = 0;
             if (INTALIGNED(copylen) && (csumlenresidue == 0)) {
@@ -752,9 +1039,10 @@ unsigned long prte_csum_partial(const void *source, size_t csumlen, unsigned lon
             }
         } else { /* fast path... */
             size_t numLongs = csumlen / sizeof(unsigned long);
-            for (i = 0; i < numLongs; i++) {
-                csum += *src++;
-            }
+            PRTE_CRC_KERNELS_SELECT();
+            csum += prte_crc_kernels.csum_long(src, NULL, numLongs);
+            src += numLongs;
+            i = numLongs;
             *lastPartialLong = 0;
             *lastPartialLength = 0;
             if (WORDALIGNED(csumlen)) {
@@ -887,9 +1175,10 @@ unsigned int prte_uicsum_partial(const void *source, size_t csumlen, unsigned in
             }
         } else { /* fast path... */
             size_t numLongs = csumlen / sizeof(unsigned int);
-            for (i = 0; i < numLongs; i++) {
-                csum += *src++;
-            }
+            PRTE_CRC_KERNELS_SELECT();
+            csum += prte_crc_kernels.csum_int(src, NULL, numLongs);
+            src += numLongs;
+            i = numLongs;
             *lastPartialInt = 0;
             *lastPartialLength = 0;
             if (INTALIGNED(csumlen)) {
@@ -1109,3 +1398,44 @@ unsigned int prte_uicrc_partial(const void *source, size_t crclen, unsigned int
 
     return partial_crc;
 }
+
+uint32_t prte_crc32c_partial(const void *source, size_t crclen, uint32_t partial_crc)
+{
+    PRTE_CRC_KERNELS_SELECT();
+    return prte_crc_kernels.crc32c((const unsigned char *) source, crclen, partial_crc);
+}
+
+/* copy in cache-sized blocks so the CRC pass over each block
+ * reads data that the copy just brought into cache */
+#define PRTE_CRC32C_BCOPY_BLOCK 8192
+
+uint32_t prte_bcopy_crc32c_partial(const void *source, void *destination, size_t copylen,
+                                   size_t crclen, uint32_t partial_crc)
+{
+    const unsigned char *src = (const unsigned char *) source;
+    unsigned char *dst = (unsigned char *) destination;
+    size_t crclenresidue = (crclen > copylen) ? (crclen - copylen) : 0;
+    size_t n;
+
+    PRTE_CRC_KERNELS_SELECT();
+
+    while (0 < copylen) {
+        n = (copylen < PRTE_CRC32C_BCOPY_BLOCK) ? copylen : PRTE_CRC32C_BCOPY_BLOCK;
+        memcpy(dst, src, n);
+        partial_crc = prte_crc_kernels.crc32c(dst, n, partial_crc);
+        src += n;
+        dst += n;
+        copylen -= n;
+    }
+    if (0 < crclenresidue) {
+        partial_crc = prte_crc_kernels.crc32c(src, crclenresidue, partial_crc);
+    }
+
+    return partial_crc;
+}
+
+const char *prte_crc_kernel_name(void)
+{
+    PRTE_CRC_KERNELS_SELECT();
+    return prte_crc_kernels.name;
+}
@@ -28,6 +28,7 @@
 #include "prte_config.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
 BEGIN_C_DECLS
 
@@ -133,6 +134,46 @@ static inline unsigned int prte_uicrc(const void *source, size_t crclen)
     return prte_uicrc_partial(source, crclen, CRC_INITIAL_REGISTER);
 }
 
+/*
+ * CRC32C (Castagnoli) Support
+ *
+ * The CRC32C routines are dispatched at runtime to the fastest kernel
+ * the host supports (SSE4.2 or ARMv8 CRC instructions), falling back
+ * to a portable slice-by-8 table implementation. The "partial" forms
+ * operate on the raw CRC register so that a checksum can be
+ * accumulated over several discontiguous buffers - seed with
+ * PRTE_CRC32C_INITIAL and invert the final value (or just use the
+ * non-partial inline versions for a single buffer).
+ */
+
+#define PRTE_CRC32C_INITIAL ((uint32_t) 0xffffffff)
+
+PRTE_EXPORT uint32_t prte_crc32c_partial(const void *source, size_t crclen, uint32_t partial_crc);
+
+static inline uint32_t prte_crc32c(const void *source, size_t crclen)
+{
+    return ~prte_crc32c_partial(source, crclen, PRTE_CRC32C_INITIAL);
+}
+
+/*
+ * Copy copylen bytes from source to destination while computing the
+ * CRC32C over crclen bytes of the source. As with the other bcopy
+ * routines, any bytes beyond copylen are only included in the CRC.
+ */
+PRTE_EXPORT uint32_t prte_bcopy_crc32c_partial(const void *source, void *destination,
+                                               size_t copylen, size_t crclen,
+                                               uint32_t partial_crc);
+
+static inline uint32_t prte_bcopy_crc32c(const void *source, void *destination, size_t copylen,
+                                         size_t crclen)
+{
+    return ~prte_bcopy_crc32c_partial(source, destination, copylen, crclen, PRTE_CRC32C_INITIAL);
+}
+
+/* return a string naming the CRC32C and checksum kernels selected
+ * for this host - e.g., for diagnostic output */
+PRTE_EXPORT const char *prte_crc_kernel_name(void);
+
 END_C_DECLS
 
 #endif
@@ -433,22 +433,130 @@ cleanup:
     return rc;
 }
 
+/* The packed (and possibly compressed) set of topologies included in
+ * launch messages when the nodes are heterogeneous. Topologies are only
+ * ever added to prte_node_topologies, so the set is rebuilt only when
+ * it no longer matches the array - otherwise every launch would repack
+ * and recompress the same XML. Nodes reference the topologies by their
+ * position in the set. */
+static struct {
+    int32_t ntopos;
+    prte_topology_t **topos;
+    hwloc_topology_t *hwtopos;
+    bool compressed;
+    pmix_byte_object_t bo;
+} topo_blob = {0, NULL, NULL, false, PMIX_BYTE_OBJECT_STATIC_INIT};
+
+static bool topo_blob_current(void)
+{
+    prte_topology_t *t;
+    int n, m = 0;
+
+    if (NULL == topo_blob.bo.bytes) {
+        return false;
+    }
+    for (n = 0; n < prte_node_topologies->size; n++) {
+        if (NULL == (t = (prte_topology_t *) prte_pointer_array_get_item(prte_node_topologies, n))) {
+            continue;
+        }
+        if (m >= topo_blob.ntopos || t != topo_blob.topos[m] || t->topo != topo_blob.hwtopos[m]) {
+            return false;
+        }
+        ++m;
+    }
+    return (m == topo_blob.ntopos);
+}
+
+static int build_topo_blob(void)
+{
+    pmix_data_buffer_t bucket;
+    pmix_topology_t pt;
+    prte_topology_t *t;
+    size_t sz;
+    int n, rc;
+
+    if (topo_blob_current()) {
+        return PRTE_SUCCESS;
+    }
+
+    /* start over */
+    PMIX_BYTE_OBJECT_DESTRUCT(&topo_blob.bo);
+    if (NULL != topo_blob.topos) {
+        free(topo_blob.topos);
+        free(topo_blob.hwtopos);
+    }
+    topo_blob.ntopos = 0;
+    topo_blob.topos = (prte_topology_t **) malloc(prte_node_topologies->size
+                                                  * sizeof(prte_topology_t *));
+    topo_blob.hwtopos = (hwloc_topology_t *) malloc(prte_node_topologies->size
+                                                    * sizeof(hwloc_topology_t));
+    if (NULL == topo_blob.topos || NULL == topo_blob.hwtopos) {
+        return PRTE_ERR_OUT_OF_RESOURCE;
+    }
+
+    PMIX_DATA_BUFFER_CONSTRUCT(&bucket);
+    pt.source = strdup("hwloc");
+    for (n = 0; n < prte_node_topologies->size; n++) {
+        if (NULL == (t = (prte_topology_t *) prte_pointer_array_get_item(prte_node_topologies, n))) {
+            continue;
+        }
+        /* pack the topology string */
+        rc = PMIx_Data_pack(NULL, &bucket, &t->sig, 1, PMIX_STRING);
+        if (PMIX_SUCCESS != rc) {
+            goto error;
+        }
+        /* pack the topology itself */
+        pt.topology = t->topo;
+        rc = PMIx_Data_pack(NULL, &bucket, &pt, 1, PMIX_TOPO);
+        if (PMIX_SUCCESS != rc) {
+            goto error;
+        }
+        /* track it */
+        topo_blob.topos[topo_blob.ntopos] = t;
+        topo_blob.hwtopos[topo_blob.ntopos] = t->topo;
+        ++topo_blob.ntopos;
+    }
+    free(pt.source);
+
+    if (PMIx_Data_compress((uint8_t *) bucket.base_ptr, bucket.bytes_used,
+                           (uint8_t **) &topo_blob.bo.bytes, &sz)) {
+        /* the data was compressed - mark that we compressed it */
+        topo_blob.compressed = true;
+        topo_blob.bo.size = sz;
+    } else {
+        /* mark that it was not compressed */
+        topo_blob.compressed = false;
+        rc = PMIx_Data_unload(&bucket, &topo_blob.bo);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            PMIX_DATA_BUFFER_DESTRUCT(&bucket);
+            topo_blob.ntopos = 0;
+            return prte_pmix_convert_status(rc);
+        }
+    }
+    PMIX_DATA_BUFFER_DESTRUCT(&bucket);
+    return PRTE_SUCCESS;
+
+error:
+    PMIX_ERROR_LOG(rc);
+    PMIX_DATA_BUFFER_DESTRUCT(&bucket);
+    free(pt.source);
+    topo_blob.ntopos = 0;
+    return prte_pmix_convert_status(rc);
+}
+
 int prte_util_pass_node_info(pmix_data_buffer_t *buffer)
 {
     uint16_t *slots = NULL, slot = UINT16_MAX;
     uint8_t *flags = NULL, flag = UINT8_MAX;
     int8_t i8;
     int16_t i16;
-    int32_t ntopos;
     int rc, m, n, nbitmap;
     bool compressed, unislots = true, uniflags = true;
     prte_node_t *nptr;
     pmix_byte_object_t bo;
     size_t sz, nslots;
     pmix_data_buffer_t bucket;
-    prte_topology_t *t;
-    pmix_topology_t pt;
-    char **topos = NULL;
 
     /* make room for the number of slots on each node */
     nslots = sizeof(uint16_t) * prte_node_pool->size;
@@ -471,79 +579,28 @@ int prte_util_pass_node_info(pmix_data_buffer_t *buffer)
 
     /* we only need to send topologies if we have hetero nodes */
     if (prte_hetero_nodes) {
-        PMIX_DATA_BUFFER_CONSTRUCT(&bucket);
-        pt.source = strdup("hwloc");
-        ntopos = 0;
-        for (n = 0; n < prte_node_topologies->size; n++) {
-            if (NULL
-                == (t = (prte_topology_t *) prte_pointer_array_get_item(prte_node_topologies, n))) {
-                continue;
-            }
-            /* pack the topology string */
-            rc = PMIx_Data_pack(NULL, &bucket, &t->sig, 1, PMIX_STRING);
-            if (PMIX_SUCCESS != rc) {
-                PMIX_ERROR_LOG(rc);
-                PMIX_DATA_BUFFER_DESTRUCT(&bucket);
-                free(pt.source);
-                goto cleanup;
-            }
-            /* track it */
-            prte_argv_append_nosize(&topos, t->sig);
-            /* pack the topology itself */
-            pt.topology = t->topo;
-            rc = PMIx_Data_pack(NULL, &bucket, &pt, 1, PMIX_TOPO);
-            if (PMIX_SUCCESS != rc) {
-                PMIX_ERROR_LOG(rc);
-                PMIX_DATA_BUFFER_DESTRUCT(&bucket);
-                free(pt.source);
-                goto cleanup;
-            }
-            ++ntopos;
+        if (PRTE_SUCCESS != (rc = build_topo_blob())) {
+            PRTE_ERROR_LOG(rc);
+            goto cleanup;
         }
-        free(pt.source);
         /* pack the number of topologies */
-        rc = PMIx_Data_pack(NULL, buffer, &ntopos, 1, PMIX_INT32);
+        rc = PMIx_Data_pack(NULL, buffer, &topo_blob.ntopos, 1, PMIX_INT32);
         if (PMIX_SUCCESS != rc) {
             PMIX_ERROR_LOG(rc);
             goto cleanup;
         }
-        /* send them along */
-        if (PMIx_Data_compress((uint8_t *) bucket.base_ptr, bucket.bytes_used,
-                               (uint8_t **) &bo.bytes, &sz)) {
-            /* the data was compressed - mark that we compressed it */
-            compressed = true;
-            rc = PMIx_Data_pack(NULL, buffer, &compressed, 1, PMIX_BOOL);
-            if (PMIX_SUCCESS != rc) {
-                PMIX_ERROR_LOG(rc);
-                PMIX_DATA_BUFFER_DESTRUCT(&bucket);
-                goto cleanup;
-            }
-            bo.size = sz;
-        } else {
-            /* mark that it was not compressed */
-            compressed = false;
-            rc = PMIx_Data_pack(NULL, buffer, &compressed, 1, PMIX_BOOL);
-            if (PMIX_SUCCESS != rc) {
-                PMIX_ERROR_LOG(rc);
-                PMIX_DATA_BUFFER_DESTRUCT(&bucket);
-                goto cleanup;
-            }
-            rc = PMIx_Data_unload(&bucket, &bo);
-            if (PMIX_SUCCESS != rc) {
-                PMIX_ERROR_LOG(rc);
-                PMIX_DATA_BUFFER_DESTRUCT(&bucket);
-                goto cleanup;
-            }
+        /* indicate compression */
+        rc = PMIx_Data_pack(NULL, buffer, &topo_blob.compressed, 1, PMIX_BOOL);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            goto cleanup;
         }
         /* pack the info */
-        rc = PMIx_Data_pack(NULL, buffer, &bo, 1, PMIX_BYTE_OBJECT);
+        rc = PMIx_Data_pack(NULL, buffer, &topo_blob.bo, 1, PMIX_BYTE_OBJECT);
         if (PMIX_SUCCESS != rc) {
             PMIX_ERROR_LOG(rc);
-            PMIX_DATA_BUFFER_DESTRUCT(&bucket);
             goto cleanup;
         }
-        PMIX_DATA_BUFFER_DESTRUCT(&bucket);
-        free(bo.bytes);
     }
 
     /* construct the per-node info */
@@ -560,9 +617,10 @@ int prte_util_pass_node_info(pmix_data_buffer_t *buffer)
                 PMIX_DATA_BUFFER_DESTRUCT(&bucket);
                 goto cleanup;
             }
-            /* find this signature in the topos */
-            for (m = 0; NULL != topos[m]; m++) {
-                if (0 == strcmp(topos[m], nptr->topology->sig)) {
+            /* find this topology in the ones we sent */
+            for (m = 0; m < topo_blob.ntopos; m++) {
+                if (topo_blob.topos[m] == nptr->topology
+                    || 0 == strcmp(topo_blob.topos[m]->sig, nptr->topology->sig)) {
                     rc = PMIx_Data_pack(NULL, &bucket, &m, 1, PMIX_INT);
                     if (PMIX_SUCCESS != rc) {
                         PMIX_ERROR_LOG(rc);
@@ -728,9 +786,6 @@ cleanup:
     if (NULL != flags) {
         free(flags);
     }
-    if (NULL != topos) {
-        prte_argv_free(topos);
-    }
     return rc;
 }
 
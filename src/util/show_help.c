@@ -33,6 +33,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "src/class/prte_hash_table.h"
 #include "src/mca/iof/iof.h"
 #include "src/mca/prteinstalldirs/prteinstalldirs.h"
 #include "src/mca/rml/rml.h"
@@ -73,6 +74,9 @@ typedef struct {
     int tli_count_since_last_display;
     /* Do we want to display these? */
     bool tli_display;
+    /* Has the first instance been displayed? A daemon's duplicate
+       count can arrive before the message itself */
+    bool tli_shown;
 } tuple_list_item_t;
 static void tuple_list_item_constructor(tuple_list_item_t *obj)
 {
@@ -82,6 +86,7 @@ static void tuple_list_item_constructor(tuple_list_item_t *obj)
     obj->tli_time_displayed = time(NULL);
     obj->tli_count_since_last_display = 0;
     obj->tli_display = true;
+    obj->tli_shown = false;
 }
 
 static void tuple_list_item_destructor(tuple_list_item_t *obj)
@@ -97,12 +102,29 @@ static void tuple_list_item_destructor(tuple_list_item_t *obj)
 static PRTE_CLASS_INSTANCE(tuple_list_item_t, prte_list_item_t, tuple_list_item_constructor,
                            tuple_list_item_destructor);
 
-/* List of (filename, topic) tuples that have already been displayed */
+/* List of (filename, topic) tuples that have already been displayed,
+ * indexed by their exact (filename, topic) key. Tuples containing a
+ * '*' wildcard cannot be hashed, so we track how many of those there
+ * are and only scan the list when there are some */
 static prte_list_t abd_tuples;
+static prte_hash_table_t abd_hash;
+static int abd_nwild = 0;
+
+/* Topics we have already read from the help files, keyed by
+ * (filename, topic), so we don't re-lex the file every time */
+static prte_hash_table_t topic_cache;
+
+/* Control values for the have_output flag in show_help messages */
+#define PRTE_SHOW_HELP_SUPPRESS   0
+#define PRTE_SHOW_HELP_OUTPUT     1
+#define PRTE_SHOW_HELP_DUPLICATES 2
 
 /* How long to wait between displaying duplicate show_help notices */
 static struct timeval show_help_interval = {5, 0};
 
+/* How long a daemon accumulates duplicates before forwarding the count */
+static struct timeval show_help_forward_interval = {0, 500000};
+
 /* Timer for displaying duplicate help message notices */
 static time_t show_help_time_last_displayed = 0;
 static bool show_help_timer_set = false;
@@ -112,8 +134,10 @@ static prte_event_t show_help_timer_event;
  * Local functions
  */
 static void show_accumulated_duplicates(int fd, short event, void *context);
+static void forward_accumulated_duplicates(int fd, short event, void *context);
 static int show_help(const char *filename, const char *topic, const char *output,
                      pmix_proc_t *sender);
+static int get_tli(const char *filename, const char *topic, tuple_list_item_t **tli);
 
 int prte_show_help_init(void)
 {
@@ -129,21 +153,46 @@ int prte_show_help_init(void)
     PRTE_DESTRUCT(&lds);
 
     PRTE_CONSTRUCT(&abd_tuples, prte_list_t);
+    PRTE_CONSTRUCT(&abd_hash, prte_hash_table_t);
+    prte_hash_table_init(&abd_hash, 64);
+    abd_nwild = 0;
+    PRTE_CONSTRUCT(&topic_cache, prte_hash_table_t);
+    prte_hash_table_init(&topic_cache, 64);
 
     prte_argv_append_nosize(&search_dirs, prte_install_dirs.prtedatadir);
     show_help_initialized = true;
     return PRTE_SUCCESS;
 }
 
+static void purge_caches(void)
+{
+    void *key;
+    char **array;
+
+    PRTE_DESTRUCT(&abd_hash);
+    abd_nwild = 0;
+    PRTE_HASH_TABLE_FOREACH_PTR(key, array, &topic_cache, { prte_argv_free(array); });
+    PRTE_DESTRUCT(&topic_cache);
+}
+
 void prte_show_help_finalize(void)
 {
+    tuple_list_item_t *tli;
+
     if (!show_help_initialized) {
         return;
     }
 
     /* Shutdown show_help, showing final messages */
     if (PRTE_PROC_IS_MASTER) {
+        /* the first instance of a message whose duplicates we are
+         * still holding will not arrive now - report the counts anyway */
+        PRTE_LIST_FOREACH(tli, &abd_tuples, tuple_list_item_t)
+        {
+            tli->tli_shown = true;
+        }
         show_accumulated_duplicates(0, 0, NULL);
+        purge_caches();
         PRTE_LIST_DESTRUCT(&abd_tuples);
         if (show_help_timer_set) {
             prte_event_evtimer_del(&show_help_timer_event);
@@ -152,8 +201,14 @@ void prte_show_help_finalize(void)
         return;
     }
 
+    /* pass along any duplicates we are still holding */
+    if (show_help_timer_set) {
+        prte_event_evtimer_del(&show_help_timer_event);
+        forward_accumulated_duplicates(0, 0, NULL);
+    }
     prte_output_close(output_stream);
     output_stream = -1;
+    purge_caches();
     PRTE_LIST_DESTRUCT(&abd_tuples);
 
     /* destruct the search list */
@@ -352,8 +407,28 @@ static int read_topic(char ***array)
 static int load_array(char ***array, const char *filename, const char *topic)
 {
     int ret;
+    char *key = NULL;
+    char **cached;
+
+    /* check the cache first - the key is only used once we are
+     * initialized, as the help dirs aren't known before then */
+    if (show_help_initialized) {
+        if (0 > prte_asprintf(&key, "%s\n%s", (NULL == filename) ? default_filename : filename,
+                              topic)) {
+            return PRTE_ERR_OUT_OF_RESOURCE;
+        }
+        if (PRTE_SUCCESS
+            == prte_hash_table_get_value_ptr(&topic_cache, key, strlen(key), (void **) &cached)) {
+            free(key);
+            *array = prte_argv_copy(cached);
+            return PRTE_SUCCESS;
+        }
+    }
 
     if (PRTE_SUCCESS != (ret = open_file(filename, topic))) {
+        if (NULL != key) {
+            free(key);
+        }
         return ret;
     }
 
@@ -367,6 +442,11 @@ static int load_array(char ***array, const char *filename, const char *topic)
 
     if (PRTE_SUCCESS != ret) {
         prte_argv_free(*array);
+    } else if (NULL != key) {
+        prte_hash_table_set_value_ptr(&topic_cache, key, strlen(key), prte_argv_copy(*array));
+    }
+    if (NULL != key) {
+        free(key);
     }
 
     return ret;
@@ -450,12 +530,110 @@ int prte_show_help_add_dir(const char *directory)
     return PRTE_SUCCESS;
 }
 
+/*
+ * Send a show_help message to the HNP. Output messages carry the
+ * rendered string, while duplicate messages carry the number of
+ * duplicates seen since the last message for this (filename, topic)
+ * was forwarded.
+ */
+static int send_help(const char *filename, const char *topic, int8_t have_output,
+                     const char *output, int32_t count)
+{
+    pmix_data_buffer_t *buf;
+    int rc;
+
+    PMIX_DATA_BUFFER_CREATE(buf);
+    /* pack the filename of the show_help text file */
+    rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buf, &filename, 1, PMIX_STRING);
+    if (PMIX_SUCCESS != rc) {
+        goto error;
+    }
+    /* pack the topic tag */
+    rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buf, &topic, 1, PMIX_STRING);
+    if (PMIX_SUCCESS != rc) {
+        goto error;
+    }
+    /* pack the flag indicating what follows */
+    rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buf, &have_output, 1, PMIX_INT8);
+    if (PMIX_SUCCESS != rc) {
+        goto error;
+    }
+    if (PRTE_SHOW_HELP_OUTPUT == have_output) {
+        /* pack the resulting string */
+        rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buf, &output, 1, PMIX_STRING);
+    } else if (PRTE_SHOW_HELP_DUPLICATES == have_output) {
+        rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buf, &count, 1, PMIX_INT32);
+    }
+    if (PMIX_SUCCESS != rc) {
+        goto error;
+    }
+
+    /* send it via RML to the HNP */
+    if (PRTE_SUCCESS
+        != (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, buf, PRTE_RML_TAG_SHOW_HELP,
+                                         prte_rml_send_callback, NULL))) {
+        PMIX_DATA_BUFFER_RELEASE(buf);
+        return rc;
+    }
+    return PRTE_SUCCESS;
+
+error:
+    PMIX_ERROR_LOG(rc);
+    PMIX_DATA_BUFFER_RELEASE(buf);
+    return prte_pmix_convert_status(rc);
+}
+
+/*
+ * When aggregating, a daemon only forwards the first instance of a
+ * given (filename, topic) to the HNP. Later instances are counted
+ * here and the counts forwarded periodically, so the HNP receives
+ * one message per daemon instead of one per failing process.
+ * Returns true if the message was held as a duplicate.
+ */
+static bool hold_duplicate(const char *filename, const char *topic)
+{
+    tuple_list_item_t *tli = NULL;
+
+    if (!prte_help_want_aggregate || !show_help_initialized) {
+        return false;
+    }
+    if (PRTE_SUCCESS != get_tli(filename, topic, &tli)) {
+        /* first instance - forward it */
+        return false;
+    }
+    ++tli->tli_count_since_last_display;
+    if (!show_help_timer_set) {
+        prte_event_evtimer_set(prte_event_base, &show_help_timer_event,
+                               forward_accumulated_duplicates, NULL);
+        prte_event_evtimer_add(&show_help_timer_event, &show_help_forward_interval);
+        show_help_timer_set = true;
+    }
+    return true;
+}
+
+static void forward_accumulated_duplicates(int fd, short event, void *context)
+{
+    tuple_list_item_t *tli;
+    int rc;
+
+    PRTE_LIST_FOREACH(tli, &abd_tuples, tuple_list_item_t)
+    {
+        if (0 < tli->tli_count_since_last_display) {
+            rc = send_help(tli->tli_filename, tli->tli_topic, PRTE_SHOW_HELP_DUPLICATES, NULL,
+                           tli->tli_count_since_last_display);
+            if (PRTE_SUCCESS != rc) {
+                PRTE_ERROR_LOG(rc);
+            }
+            tli->tli_count_since_last_display = 0;
+        }
+    }
+    show_help_timer_set = false;
+}
+
 int prte_show_help_norender(const char *filename, const char *topic, int want_error_header,
                             const char *output)
 {
     int rc = PRTE_SUCCESS;
-    int8_t have_output = 1;
-    pmix_data_buffer_t *buf;
     bool am_inside = false;
 
     /* if we are the HNP, or the RML has not yet been setup,
@@ -478,51 +656,18 @@ int prte_show_help_norender(const char *filename, const char *topic, int want_er
        being. */
     if (am_inside) {
         rc = show_help(filename, topic, output, PRTE_PROC_MY_NAME);
+    } else if (hold_duplicate(filename, topic)) {
+        rc = PRTE_SUCCESS;
     } else {
         am_inside = true;
 
-        /* build the message to the HNP */
-        PMIX_DATA_BUFFER_CREATE(buf);
-        /* pack the filename of the show_help text file */
-        rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buf, &filename, 1, PMIX_STRING);
-        if (PMIX_SUCCESS != rc) {
-            PMIX_ERROR_LOG(rc);
-            PMIX_DATA_BUFFER_RELEASE(buf);
-            goto CLEANUP;
-        }
-        /* pack the topic tag */
-        rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buf, &topic, 1, PMIX_STRING);
-        if (PMIX_SUCCESS != rc) {
-            PMIX_ERROR_LOG(rc);
-            PMIX_DATA_BUFFER_RELEASE(buf);
-            goto CLEANUP;
-        }
-        /* pack the flag that we have a string */
-        rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buf, &have_output, 1, PMIX_INT8);
-        if (PMIX_SUCCESS != rc) {
-            PMIX_ERROR_LOG(rc);
-            PMIX_DATA_BUFFER_RELEASE(buf);
-            goto CLEANUP;
-        }
-        /* pack the resulting string */
-        rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buf, &output, 1, PMIX_STRING);
-        if (PMIX_SUCCESS != rc) {
-            PMIX_ERROR_LOG(rc);
-            PMIX_DATA_BUFFER_RELEASE(buf);
-            goto CLEANUP;
-        }
-
         /* send it via RML to the HNP */
-
         if (PRTE_SUCCESS
-            != (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, buf, PRTE_RML_TAG_SHOW_HELP,
-                                             prte_rml_send_callback, NULL))) {
-            PMIX_DATA_BUFFER_RELEASE(buf);
+            != send_help(filename, topic, PRTE_SHOW_HELP_OUTPUT, output, 0)) {
             /* okay, that didn't work, output locally  */
             prte_output(output_stream, "%s", output);
-        } else {
-            rc = PRTE_SUCCESS;
         }
+        rc = PRTE_SUCCESS;
         am_inside = false;
     }
 
@@ -533,8 +678,6 @@ CLEANUP:
 int prte_show_help_suppress(const char *filename, const char *topic)
 {
     int rc = PRTE_SUCCESS;
-    int8_t have_output = 0;
-    pmix_data_buffer_t *buf;
     static bool am_inside = false;
 
     if (prte_execute_quiet) {
@@ -563,34 +706,9 @@ int prte_show_help_suppress(const char *filename, const char *topic)
     } else {
         am_inside = true;
 
-        /* build the message to the HNP */
-        PMIX_DATA_BUFFER_CREATE(buf);
-        rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buf, &filename, 1, PMIX_STRING);
-        if (PMIX_SUCCESS != rc) {
-            PMIX_ERROR_LOG(rc);
-            PMIX_DATA_BUFFER_RELEASE(buf);
-            return PRTE_SUCCESS;
-        }
-        /* pack the topic tag */
-        rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buf, &topic, 1, PMIX_STRING);
-        if (PMIX_SUCCESS != rc) {
-            PMIX_ERROR_LOG(rc);
-            PMIX_DATA_BUFFER_RELEASE(buf);
-            return PRTE_SUCCESS;
-        }
-        /* pack the flag that we DO NOT have a string */
-        rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buf, &have_output, 1, PMIX_INT8);
-        if (PMIX_SUCCESS != rc) {
-            PMIX_ERROR_LOG(rc);
-            PMIX_DATA_BUFFER_RELEASE(buf);
-            return PRTE_SUCCESS;
-        }
         /* send it to the HNP */
-        if (PRTE_SUCCESS
-            != (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, buf, PRTE_RML_TAG_SHOW_HELP,
-                                             prte_rml_send_callback, NULL))) {
+        if (PRTE_SUCCESS != (rc = send_help(filename, topic, PRTE_SHOW_HELP_SUPPRESS, NULL, 0))) {
             PRTE_ERROR_LOG(rc);
-            PMIX_DATA_BUFFER_RELEASE(buf);
             /* okay, that didn't work, just process locally error, just ignore return  */
             show_help(filename, topic, NULL, PRTE_PROC_MY_NAME);
         }
@@ -600,6 +718,64 @@ int prte_show_help_suppress(const char *filename, const char *topic)
     return PRTE_SUCCESS;
 }
 
+int prte_show_help_relay(const pmix_byte_object_t *bo)
+{
+    pmix_data_buffer_t buf;
+    char *filename = NULL, *topic = NULL, *output = NULL;
+    int8_t have_output;
+    int32_t n;
+    int rc;
+
+    PMIX_DATA_BUFFER_CONSTRUCT(&buf);
+    rc = PMIx_Data_embed(&buf, bo);
+    if (PMIX_SUCCESS != rc) {
+        goto pmixerr;
+    }
+    n = 1;
+    rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, &buf, &filename, &n, PMIX_STRING);
+    if (PMIX_SUCCESS != rc) {
+        goto pmixerr;
+    }
+    n = 1;
+    rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, &buf, &topic, &n, PMIX_STRING);
+    if (PMIX_SUCCESS != rc) {
+        goto pmixerr;
+    }
+    n = 1;
+    rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, &buf, &have_output, &n, PMIX_INT8);
+    if (PMIX_SUCCESS != rc) {
+        goto pmixerr;
+    }
+    if (PRTE_SHOW_HELP_OUTPUT == have_output) {
+        n = 1;
+        rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, &buf, &output, &n, PMIX_STRING);
+        if (PMIX_SUCCESS != rc) {
+            goto pmixerr;
+        }
+        rc = prte_show_help_norender(filename, topic, 0, output);
+    } else {
+        rc = prte_show_help_suppress(filename, topic);
+    }
+    goto cleanup;
+
+pmixerr:
+    PMIX_ERROR_LOG(rc);
+    rc = prte_pmix_convert_status(rc);
+
+cleanup:
+    PMIX_DATA_BUFFER_DESTRUCT(&buf);
+    if (NULL != filename) {
+        free(filename);
+    }
+    if (NULL != topic) {
+        free(topic);
+    }
+    if (NULL != output) {
+        free(output);
+    }
+    return rc;
+}
+
 /*
  * Returns PRTE_SUCCESS if the strings match; PRTE_ERROR otherwise.
  */
@@ -657,18 +833,45 @@ static int match(const char *a, const char *b)
  * wasn't in the list already, this function will create a new entry
  * in the list and return it).
  *
- * Note that a list is not an overly-efficient mechanism for this kind
- * of data.  The assupmtion is that there will only be a small numebr
- * of (filename, topic) tuples displayed so the storage required will
- * be fairly small, and linear searches will be fast enough.
+ * Exact (filename, topic) tuples are found through a hash table, so
+ * the list only has to be scanned for tuples that contain a '*'
+ * wildcard - of which there are normally very few, if any.
  */
 static int get_tli(const char *filename, const char *topic, tuple_list_item_t **tli)
 {
-    /* Search the list for a duplicate. */
-    PRTE_LIST_FOREACH(*tli, &abd_tuples, tuple_list_item_t)
-    {
-        if (PRTE_SUCCESS == match((*tli)->tli_filename, filename)
-            && PRTE_SUCCESS == match((*tli)->tli_topic, topic)) {
+    char *key;
+    int rc;
+
+    if (NULL != strchr(filename, '*') || NULL != strchr(topic, '*')) {
+        /* a wildcard query can match anything, so search the whole list */
+        PRTE_LIST_FOREACH(*tli, &abd_tuples, tuple_list_item_t)
+        {
+            if (PRTE_SUCCESS == match((*tli)->tli_filename, filename)
+                && PRTE_SUCCESS == match((*tli)->tli_topic, topic)) {
+                return PRTE_SUCCESS;
+            }
+        }
+        key = NULL;
+    } else {
+        /* any wildcard tuples take precedence, as they would have
+         * been found first in the list */
+        if (0 < abd_nwild) {
+            PRTE_LIST_FOREACH(*tli, &abd_tuples, tuple_list_item_t)
+            {
+                if ((NULL != strchr((*tli)->tli_filename, '*')
+                     || NULL != strchr((*tli)->tli_topic, '*'))
+                    && PRTE_SUCCESS == match((*tli)->tli_filename, filename)
+                    && PRTE_SUCCESS == match((*tli)->tli_topic, topic)) {
+                    return PRTE_SUCCESS;
+                }
+            }
+        }
+        if (0 > prte_asprintf(&key, "%s\n%s", filename, topic)) {
+            return PRTE_ERR_OUT_OF_RESOURCE;
+        }
+        rc = prte_hash_table_get_value_ptr(&abd_hash, key, strlen(key), (void **) tli);
+        if (PRTE_SUCCESS == rc) {
+            free(key);
             return PRTE_SUCCESS;
         }
     }
@@ -676,14 +879,39 @@ static int get_tli(const char *filename, const char *topic, tuple_list_item_t **
     /* Nope, we didn't find it -- make a new one */
     *tli = PRTE_NEW(tuple_list_item_t);
     if (NULL == *tli) {
+        if (NULL != key) {
+            free(key);
+        }
         return PRTE_ERR_OUT_OF_RESOURCE;
     }
     (*tli)->tli_filename = strdup(filename);
     (*tli)->tli_topic = strdup(topic);
     prte_list_append(&abd_tuples, &((*tli)->super));
+    if (NULL == key) {
+        ++abd_nwild;
+    } else {
+        prte_hash_table_set_value_ptr(&abd_hash, key, strlen(key), *tli);
+        free(key);
+    }
     return PRTE_ERR_NOT_FOUND;
 }
 
+/*
+ * Arrange for the accumulated duplicate notices to be shown - see
+ * the description of the scheme in show_help() below
+ */
+static void schedule_duplicates(time_t now)
+{
+    if (now > show_help_time_last_displayed + 5 && !show_help_timer_set) {
+        show_accumulated_duplicates(0, 0, NULL);
+    } else if (!show_help_timer_set) {
+        prte_event_evtimer_set(prte_event_base, &show_help_timer_event,
+                               show_accumulated_duplicates, NULL);
+        prte_event_evtimer_add(&show_help_timer_event, &show_help_interval);
+        show_help_timer_set = true;
+    }
+}
+
 static void show_accumulated_duplicates(int fd, short event, void *context)
 {
     time_t now = time(NULL);
@@ -694,7 +922,7 @@ static void show_accumulated_duplicates(int fd, short event, void *context)
        yet */
     PRTE_LIST_FOREACH(tli, &abd_tuples, tuple_list_item_t)
     {
-        if (tli->tli_display && tli->tli_count_since_last_display > 0) {
+        if (tli->tli_display && tli->tli_shown && tli->tli_count_since_last_display > 0) {
             static bool first = true;
             prte_output(0, "%d more process%s sent help message %s / %s",
                         tli->tli_count_since_last_display,
@@ -721,10 +949,12 @@ static int show_help(const char *filename, const char *topic, const char *output
     tuple_list_item_t *tli = NULL;
     prte_namelist_t *pnli;
     time_t now = time(NULL);
+    /* the duplicate tracking is gone once we have been finalized */
+    bool aggregate = prte_help_want_aggregate && show_help_initialized;
 
     /* If we're aggregating, check for duplicates.  Otherwise, don't
        track duplicates at all and always display the message. */
-    if (prte_help_want_aggregate) {
+    if (aggregate) {
         rc = get_tli(filename, topic, &tli);
     } else {
         rc = PRTE_ERR_NOT_FOUND;
@@ -733,12 +963,14 @@ static int show_help(const char *filename, const char *topic, const char *output
     /* If there's no output string (i.e., this is a control message
        asking us to suppress), then skip to the end. */
     if (NULL == output) {
-        tli->tli_display = false;
+        if (NULL != tli) {
+            tli->tli_display = false;
+        }
         goto after_output;
     }
 
     /* Was it already displayed? */
-    if (PRTE_SUCCESS == rc) {
+    if (PRTE_SUCCESS == rc && tli->tli_shown) {
         /* Yes.  But do we want to print anything?  That's complicated.
 
            We always show the first message of a given (filename,
@@ -765,17 +997,10 @@ static int show_help(const char *filename, const char *topic, const char *output
            - set T=now when the timer expires
         */
         ++tli->tli_count_since_last_display;
-        if (now > show_help_time_last_displayed + 5 && !show_help_timer_set) {
-            show_accumulated_duplicates(0, 0, NULL);
-        } else if (!show_help_timer_set) {
-            prte_event_evtimer_set(prte_event_base, &show_help_timer_event,
-                                   show_accumulated_duplicates, NULL);
-            prte_event_evtimer_add(&show_help_timer_event, &show_help_interval);
-            show_help_timer_set = true;
-        }
+        schedule_duplicates(now);
     }
     /* Not already displayed */
-    else if (PRTE_ERR_NOT_FOUND == rc) {
+    else if (PRTE_SUCCESS == rc || PRTE_ERR_NOT_FOUND == rc) {
         if (NULL != prte_iof.output) {
             /* send it to any connected tools */
             prte_iof.output(sender, PRTE_IOF_STDDIAG, output);
@@ -784,6 +1009,13 @@ static int show_help(const char *filename, const char *topic, const char *output
         if (!show_help_timer_set) {
             show_help_time_last_displayed = now;
         }
+        if (NULL != tli) {
+            tli->tli_shown = true;
+            /* release any duplicates that arrived ahead of it */
+            if (0 < tli->tli_count_since_last_display) {
+                schedule_duplicates(now);
+            }
+        }
     }
     /* Some other error occurred */
     else {
@@ -793,7 +1025,7 @@ static int show_help(const char *filename, const char *topic, const char *output
 
 after_output:
     /* If we're aggregating, add this process name to the list */
-    if (prte_help_want_aggregate) {
+    if (aggregate) {
         pnli = PRTE_NEW(prte_namelist_t);
         if (NULL == pnli) {
             rc = PRTE_ERR_OUT_OF_RESOURCE;
@@ -813,9 +1045,10 @@ void prte_show_help_recv(int status, pmix_proc_t *sender, pmix_data_buffer_t *bu
 {
     char *output = NULL;
     char *filename = NULL, *topic = NULL;
-    int32_t n;
+    int32_t n, count;
     int8_t have_output;
     int rc;
+    tuple_list_item_t *tli;
 
     PRTE_OUTPUT_VERBOSE((5, prte_debug_output, "%s got show_help from %s",
                          PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_NAME_PRINT(sender)));
@@ -843,13 +1076,34 @@ void prte_show_help_recv(int status, pmix_proc_t *sender, pmix_data_buffer_t *bu
     }
 
     /* If we have an output string, unpack it */
-    if (have_output) {
+    if (PRTE_SHOW_HELP_OUTPUT == have_output) {
         n = 1;
         rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, buffer, &output, &n, PMIX_STRING);
         if (PMIX_SUCCESS != rc) {
             PMIX_ERROR_LOG(rc);
             goto cleanup;
         }
+    } else if (PRTE_SHOW_HELP_DUPLICATES == have_output) {
+        /* the sender already forwarded the first instance of this
+         * message and is just reporting how many more it has seen */
+        n = 1;
+        rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, buffer, &count, &n, PMIX_INT32);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            goto cleanup;
+        }
+        if (!prte_help_want_aggregate || !show_help_initialized) {
+            prte_output(0, "%d more process%s sent help message %s / %s", count,
+                        (count > 1) ? "es have" : " has", filename, topic);
+        } else if (PRTE_ERR_OUT_OF_RESOURCE != get_tli(filename, topic, &tli)) {
+            /* if the first instance hasn't reached us yet, the count
+             * is held until it does */
+            tli->tli_count_since_last_display += count;
+            if (tli->tli_shown) {
+                schedule_duplicates(time(NULL));
+            }
+        }
+        goto cleanup;
     }
 
     /* Send it to show_help */
@@ -187,6 +187,14 @@ PRTE_EXPORT int prte_show_help_add_dir(const char *directory);
  */
 PRTE_EXPORT int prte_show_help_suppress(const char *filename, const char *topic);
 
+/**
+ * Relay a packed show_help message received from a local client
+ * to the HNP. When aggregating, only the first instance of a given
+ * (filename, topic) is relayed - later instances are counted and
+ * the count relayed periodically.
+ */
+PRTE_EXPORT int prte_show_help_relay(const pmix_byte_object_t *bo);
+
 PRTE_EXPORT void prte_show_help_recv(int status, pmix_proc_t *sender, pmix_data_buffer_t *buffer,
                                      prte_rml_tag_t tag, void *cbdata);
 
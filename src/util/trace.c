@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2021      Nanook Consulting.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+#include "prte_config.h"
+#include "constants.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef HAVE_UNISTD_H
+#    include <unistd.h>
+#endif
+
+#include "src/mca/base/prte_mca_base_var.h"
+#include "src/sys/atomic.h"
+#include "src/threads/thread_usage.h"
+#include "src/util/output.h"
+#include "src/util/printf.h"
+#include "src/util/proc_info.h"
+#include "src/util/prte_environ.h"
+#include "src/util/show_help.h"
+#include "src/util/string_copy.h"
+
+#include "src/util/trace.h"
+
+/* max number of threads that can own a ring */
+#define PRTE_TRACE_MAX_RINGS 64
+
+typedef struct {
+    prte_trace_record_t *records;
+    /* total number of records written - only the owning
+     * thread ever updates this */
+    uint64_t head;
+    uint32_t id;
+} trace_ring_t;
+
+bool prte_trace_enabled = false;
+static int trace_ring_size = 65536;
+static char *trace_dir = NULL;
+
+static uint64_t ring_mask = 0;
+static trace_ring_t *rings[PRTE_TRACE_MAX_RINGS];
+static prte_atomic_int32_t nrings = 0;
+static struct timespec epoch;
+static uint64_t epoch_realtime = 0;
+
+#if PRTE_HAVE_THREAD_LOCAL
+static prte_thread_local trace_ring_t *my_ring = NULL;
+#else
+/* never used - tracing is disabled when there is no thread-local
+ * storage to give each thread its own ring */
+static trace_ring_t *my_ring = NULL;
+#endif
+
+void prte_trace_register_params(void)
+{
+    struct timespec now;
+    size_t sz;
+
+    prte_trace_enabled = false;
+    (void) prte_mca_base_var_register("prte", "prte", NULL, "trace",
+                                      "Record binary trace events for the state machine, RML, "
+                                      "grpcomm, odls and IOF in a per-thread ring that is written "
+                                      "to a file at finalize or on request (requires thread-local "
+                                      "storage - ignored if the build lacks it)",
+                                      PRTE_MCA_BASE_VAR_TYPE_BOOL, NULL, 0,
+                                      PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
+                                      PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_trace_enabled);
+
+    trace_ring_size = 65536;
+    (void) prte_mca_base_var_register("prte", "prte", NULL, "trace_ring_size",
+                                      "Number of trace events each thread retains (rounded up to "
+                                      "a power of two)",
+                                      PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0,
+                                      PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
+                                      PRTE_MCA_BASE_VAR_SCOPE_READONLY, &trace_ring_size);
+
+    trace_dir = NULL;
+    (void) prte_mca_base_var_register("prte", "prte", NULL, "trace_dir",
+                                      "Directory where trace files are written (default: the "
+                                      "system temporary directory)",
+                                      PRTE_MCA_BASE_VAR_TYPE_STRING, NULL, 0,
+                                      PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
+                                      PRTE_MCA_BASE_VAR_SCOPE_READONLY, &trace_dir);
+
+    if (!prte_trace_enabled) {
+        return;
+    }
+#if !PRTE_HAVE_THREAD_LOCAL
+    prte_show_help("help-prte-runtime.txt", "prte-trace:no-tls", true);
+    prte_trace_enabled = false;
+    return;
+#endif
+    if (0 >= trace_ring_size) {
+        prte_trace_enabled = false;
+        return;
+    }
+    for (sz = 1; sz < (size_t) trace_ring_size; sz <<= 1) {
+        continue;
+    }
+    ring_mask = sz - 1;
+
+    clock_gettime(CLOCK_MONOTONIC, &epoch);
+    clock_gettime(CLOCK_REALTIME, &now);
+    epoch_realtime = (uint64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static trace_ring_t *get_ring(void)
+{
+    trace_ring_t *ring;
+    int32_t idx;
+
+    idx = prte_atomic_fetch_add_32(&nrings, 1);
+    if (PRTE_TRACE_MAX_RINGS <= idx) {
+        /* out of rings - this thread goes untraced */
+        return NULL;
+    }
+    ring = (trace_ring_t *) calloc(1, sizeof(trace_ring_t));
+    if (NULL == ring) {
+        return NULL;
+    }
+    ring->records = (prte_trace_record_t *) calloc(ring_mask + 1, sizeof(prte_trace_record_t));
+    if (NULL == ring->records) {
+        free(ring);
+        return NULL;
+    }
+    ring->id = idx;
+    prte_atomic_wmb();
+    rings[idx] = ring;
+    return ring;
+}
+
+void prte_trace_record(prte_trace_event_id_t event, uint32_t arg0, uint64_t arg1)
+{
+    struct timespec now;
+    prte_trace_record_t *rec;
+    uint64_t slot;
+
+    if (NULL == my_ring) {
+        my_ring = get_ring();
+        if (NULL == my_ring) {
+            return;
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    slot = my_ring->head;
+    rec = &my_ring->records[slot & ring_mask];
+    rec->ts = (uint64_t)(now.tv_sec - epoch.tv_sec) * 1000000000 + now.tv_nsec - epoch.tv_nsec;
+    rec->event = event;
+    rec->arg0 = arg0;
+    rec->arg1 = arg1;
+    /* make the record visible before advancing the head */
+    prte_atomic_wmb();
+    my_ring->head = slot + 1;
+}
+
+int prte_trace_dump(const char *reason)
+{
+    static uint32_t seq = 0;
+    prte_trace_file_header_t hdr;
+    prte_trace_ring_header_t rhdr;
+    trace_ring_t *ring;
+    char *filename;
+    const char *dir;
+    FILE *fp;
+    uint64_t head, first, n;
+    int32_t i, cnt;
+    int rc = PRTE_SUCCESS;
+
+    if (!prte_trace_enabled) {
+        return PRTE_SUCCESS;
+    }
+
+    cnt = nrings;
+    if (PRTE_TRACE_MAX_RINGS < cnt) {
+        cnt = PRTE_TRACE_MAX_RINGS;
+    }
+
+    dir = (NULL == trace_dir) ? prte_tmp_directory() : trace_dir;
+    if (0 > prte_asprintf(&filename, "%s/prte-trace.%s.%u.%lu.%s.%u.bin", dir,
+                          prte_process_info.myproc.nspace, prte_process_info.myproc.rank,
+                          (unsigned long) getpid(), reason, seq++)) {
+        return PRTE_ERR_OUT_OF_RESOURCE;
+    }
+    fp = fopen(filename, "w");
+    if (NULL == fp) {
+        prte_output(0, "%s: could not open trace file %s: %s",
+                    prte_process_info.nodename, filename, strerror(errno));
+        free(filename);
+        return PRTE_ERR_FILE_OPEN_FAILURE;
+    }
+
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, PRTE_TRACE_MAGIC, sizeof(hdr.magic));
+    hdr.version = PRTE_TRACE_VERSION;
+    hdr.rank = prte_process_info.myproc.rank;
+    hdr.record_size = sizeof(prte_trace_record_t);
+    hdr.epoch_realtime = epoch_realtime;
+    prte_string_copy(hdr.nspace, prte_process_info.myproc.nspace, sizeof(hdr.nspace));
+    if (NULL != prte_process_info.nodename) {
+        prte_string_copy(hdr.hostname, prte_process_info.nodename, sizeof(hdr.hostname));
+    }
+    for (i = 0; i < cnt; i++) {
+        if (NULL != rings[i]) {
+            ++hdr.nrings;
+        }
+    }
+    if (1 != fwrite(&hdr, sizeof(hdr), 1, fp)) {
+        rc = PRTE_ERR_FILE_WRITE_FAILURE;
+        goto done;
+    }
+
+    /* the owning threads may still be recording, so anything they
+     * overwrite while we copy is simply lost */
+    for (i = 0; i < cnt; i++) {
+        if (NULL == (ring = rings[i])) {
+            continue;
+        }
+        head = ring->head;
+        prte_atomic_rmb();
+        n = (head > ring_mask + 1) ? ring_mask + 1 : head;
+        first = head - n;
+        rhdr.ring = ring->id;
+        rhdr.nrecords = (uint32_t) n;
+        rhdr.dropped = first;
+        if (1 != fwrite(&rhdr, sizeof(rhdr), 1, fp)) {
+            rc = PRTE_ERR_FILE_WRITE_FAILURE;
+            goto done;
+        }
+        /* write the records oldest first, in at most two pieces */
+        if (0 < n) {
+            uint64_t start = first & ring_mask;
+            uint64_t len = (start + n > ring_mask + 1) ? ring_mask + 1 - start : n;
+            if (len != fwrite(&ring->records[start], sizeof(prte_trace_record_t), len, fp)
+                || (n > len
+                    && n - len != fwrite(ring->records, sizeof(prte_trace_record_t), n - len, fp))) {
+                rc = PRTE_ERR_FILE_WRITE_FAILURE;
+                goto done;
+            }
+        }
+    }
+
+done:
+    fclose(fp);
+    if (PRTE_SUCCESS != rc) {
+        prte_output(0, "%s: could not write trace file %s", prte_process_info.nodename, filename);
+    }
+    free(filename);
+    return rc;
+}
+
+void prte_trace_finalize(void)
+{
+    int32_t i, cnt;
+
+    if (!prte_trace_enabled) {
+        return;
+    }
+
+    /* stop recording before we release the rings */
+    prte_trace_enabled = false;
+    cnt = nrings;
+    if (PRTE_TRACE_MAX_RINGS < cnt) {
+        cnt = PRTE_TRACE_MAX_RINGS;
+    }
+    for (i = 0; i < cnt; i++) {
+        if (NULL != rings[i]) {
+            free(rings[i]->records);
+            free(rings[i]);
+            rings[i] = NULL;
+        }
+    }
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2021      Nanook Consulting.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+/** @file
+ *
+ * Low-overhead binary event tracing.
+ *
+ * Each thread that records an event gets its own fixed-size ring of
+ * binary records (timestamp, event id, two small arguments). Only the
+ * owning thread writes to a ring, so recording an event takes no locks
+ * and does no formatting or I/O - it is a clock read and a store. When
+ * tracing is disabled (the default), each trace point costs a single
+ * test of a global flag.
+ *
+ * The rings are written to a file on demand - when the process
+ * finalizes, or when a daemon receives PRTE_DAEMON_DUMP_TRACE_CMD - and
+ * can be converted to Chrome trace / Perfetto JSON offline with
+ * contrib/prte-trace2json.py.
+ *
+ * The file layout (native byte order) is a prte_trace_file_header_t,
+ * followed for each ring by a prte_trace_ring_header_t and its
+ * records in time order.
+ */
+
+#ifndef PRTE_UTIL_TRACE_H
+#define PRTE_UTIL_TRACE_H
+
+#include "prte_config.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "prefetch.h"
+
+BEGIN_C_DECLS
+
+/* event ids - keep contrib/prte-trace2json.py in sync */
+typedef enum {
+    PRTE_TRACE_JOB_STATE = 1,   /* arg0: state, arg1: local jobid */
+    PRTE_TRACE_PROC_STATE,      /* arg0: state, arg1: rank */
+    PRTE_TRACE_RML_SEND,        /* arg0: tag, arg1: peer rank */
+    PRTE_TRACE_RML_RECV,        /* arg0: tag, arg1: peer rank */
+    PRTE_TRACE_XCAST,           /* arg0: tag, arg1: bytes */
+    PRTE_TRACE_ALLGATHER_BEGIN, /* arg0: signature size, arg1: bytes */
+    PRTE_TRACE_ALLGATHER_END,   /* arg0: signature size, arg1: bytes */
+    PRTE_TRACE_FORK_BEGIN,      /* arg0: 0, arg1: rank */
+    PRTE_TRACE_FORK_END,        /* arg0: pid, arg1: rank */
+    PRTE_TRACE_IOF_READ,        /* arg0: channel, arg1: bytes */
+    PRTE_TRACE_IOF_WRITE,       /* arg0: fd, arg1: bytes */
+    PRTE_TRACE_MAX_EVENT
+} prte_trace_event_id_t;
+
+typedef struct {
+    uint64_t ts;   /* nsec since the trace epoch */
+    uint32_t event;
+    uint32_t arg0;
+    uint64_t arg1;
+} prte_trace_record_t;
+
+#define PRTE_TRACE_MAGIC   "PRTETRC1"
+#define PRTE_TRACE_VERSION 1
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t rank;
+    uint32_t nrings;
+    uint32_t record_size;
+    uint64_t epoch_realtime; /* nsec since 1970 at the trace epoch */
+    char nspace[256];
+    char hostname[64];
+} prte_trace_file_header_t;
+
+typedef struct {
+    uint32_t ring;
+    uint32_t nrecords;
+    uint64_t dropped; /* records overwritten before the dump */
+} prte_trace_ring_header_t;
+
+/* whether tracing is enabled - set by the prte_trace MCA param */
+PRTE_EXPORT extern bool prte_trace_enabled;
+
+PRTE_EXPORT void prte_trace_register_params(void);
+
+PRTE_EXPORT void prte_trace_record(prte_trace_event_id_t event, uint32_t arg0, uint64_t arg1);
+
+/**
+ * Write all rings to a new trace file for this process, tagged with
+ * the given reason and a per-process dump sequence number so that
+ * repeated dumps do not overwrite each other. Returns PRTE_SUCCESS,
+ * or an error if the file could not be written. The rings are not
+ * reset, so later dumps contain the full history that still fits
+ * in them.
+ */
+PRTE_EXPORT int prte_trace_dump(const char *reason);
+
+/**
+ * Stop tracing and release the rings. Must only be called once no
+ * other threads can record events.
+ */
+PRTE_EXPORT void prte_trace_finalize(void);
+
+#define PRTE_TRACE(e, a0, a1)                                         \
+    do {                                                              \
+        if (PRTE_UNLIKELY(prte_trace_enabled)) {                      \
+            prte_trace_record((e), (uint32_t) (a0), (uint64_t) (a1)); \
+        }                                                             \
+    } while (0)
+
+END_C_DECLS
+
+#endif /* PRTE_UTIL_TRACE_H */
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2021      Nanook Consulting.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ */
+
+/* Check the selected CRC32C kernel against the published check value
+ * and against itself across every length and alignment the kernels
+ * split their work on, and check that the copy-and-crc routine
+ * produces the same CRC as a separate copy and crc */
+
+#include "prte_config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/util/crc.h"
+
+#define TEST_LEN (64 * 1024)
+
+/* bitwise reference for CRC32C (Castagnoli, reflected) */
+static uint32_t ref_crc32c(const unsigned char *buf, size_t len, uint32_t crc)
+{
+    size_t i;
+    int k;
+
+    for (i = 0; i < len; i++) {
+        crc ^= buf[i];
+        for (k = 0; k < 8; k++) {
+            crc = (crc >> 1) ^ (0x82F63B78U & (0U - (crc & 1U)));
+        }
+    }
+    return crc;
+}
+
+/* check one length at one alignment, whole and continued across a split */
+static int check_one(const unsigned char *buf, size_t off, size_t len)
+{
+    uint32_t want, got;
+    size_t split = len / 3;
+    int nerr = 0;
+
+    want = ref_crc32c(buf + off, len, PRTE_CRC32C_INITIAL);
+    got = prte_crc32c_partial(buf + off, len, PRTE_CRC32C_INITIAL);
+    if (want != got) {
+        fprintf(stderr, "crc32c %s off %lu len %lu: got 0x%08x, want 0x%08x\n",
+                prte_crc_kernel_name(), (unsigned long) off, (unsigned long) len, got, want);
+        ++nerr;
+    }
+    got = prte_crc32c_partial(buf + off, split, PRTE_CRC32C_INITIAL);
+    got = prte_crc32c_partial(buf + off + split, len - split, got);
+    if (want != got) {
+        fprintf(stderr, "crc32c split off %lu len %lu: got 0x%08x, want 0x%08x\n",
+                (unsigned long) off, (unsigned long) len, got, want);
+        ++nerr;
+    }
+    return nerr;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned char *src, *dst;
+    uint32_t want, got;
+    size_t len, off;
+    int nerr = 0;
+
+    (void) argc;
+    (void) argv;
+
+    got = ~prte_crc32c_partial("123456789", 9, PRTE_CRC32C_INITIAL);
+    if (0xE3069283U != got) {
+        fprintf(stderr, "crc32c check value: got 0x%08x, want 0xe3069283\n", got);
+        ++nerr;
+    }
+
+    src = malloc(TEST_LEN + 16);
+    dst = malloc(TEST_LEN + 16);
+    for (len = 0; len < TEST_LEN + 16; len++) {
+        src[len] = (unsigned char) (len * 131 + 7);
+    }
+
+    /* short lengths at every alignment, then a long one */
+    for (off = 0; off < 8; off++) {
+        for (len = 0; len <= 600; len++) {
+            nerr += check_one(src, off, len);
+        }
+        nerr += check_one(src, off, TEST_LEN);
+    }
+
+    /* copy-and-crc, including a crc that runs past the copy */
+    for (len = 1; len <= TEST_LEN; len *= 3) {
+        memset(dst, 0, TEST_LEN + 16);
+        want = ref_crc32c(src, len + 5, PRTE_CRC32C_INITIAL);
+        got = prte_bcopy_crc32c_partial(src, dst, len, len + 5, PRTE_CRC32C_INITIAL);
+        if (want != got || 0 != memcmp(src, dst, len)) {
+            fprintf(stderr, "bcopy_crc32c len %lu: got 0x%08x, want 0x%08x\n",
+                    (unsigned long) len, got, want);
+            ++nerr;
+        }
+    }
+
+    free(src);
+    free(dst);
+    if (0 == nerr) {
+        fprintf(stderr, "crc32c: kernel %s ok\n", prte_crc_kernel_name());
+    }
+    return (0 == nerr) ? 0 : 1;
+}
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2021      Nanook Consulting.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ */
+
+/* Build batches of direct modex requests and responses the way the
+ * daemons queue them - each message packed into its own buffer and
+ * appended to the batch - and check that the receiving side gets the
+ * same count and the same messages back in order. Responses with data,
+ * with no data and with an error status are mixed in one batch, and a
+ * response that claims more data than it carries must not unpack */
+
+#include "prte_config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/pmix/pmix-internal.h"
+#include "src/prted/pmix/pmix_server_internal.h"
+
+#define NREQS 5
+
+static const size_t sizes[] = {100, 0, 1, 0, 70000};
+static const pmix_status_t statuses[] = {PMIX_SUCCESS, PMIX_SUCCESS, PMIX_SUCCESS,
+                                         PMIX_ERR_NOT_FOUND, PMIX_SUCCESS};
+#define NRESPS ((int) (sizeof(sizes) / sizeof(sizes[0])))
+
+/* append a message to a batch as pmix_server_dmdx_queue does */
+static int append(pmix_data_buffer_t *msgs, int32_t *nmsgs, pmix_data_buffer_t *msg)
+{
+    pmix_status_t prc;
+
+    prc = PMIx_Data_copy_payload(msgs, msg);
+    PMIX_DATA_BUFFER_DESTRUCT(msg);
+    if (PMIX_SUCCESS != prc) {
+        return 1;
+    }
+    ++(*nmsgs);
+    return 0;
+}
+
+/* frame the batch for sending and read back its count */
+static int frame(pmix_data_buffer_t *wire, pmix_data_buffer_t *msgs, int32_t nmsgs)
+{
+    int32_t n = -1, cnt = 1;
+
+    if (PMIX_SUCCESS != pmix_server_dmdx_pack_batch(wire, nmsgs, msgs)
+        || PMIX_SUCCESS != PMIx_Data_unpack(NULL, wire, &n, &cnt, PMIX_INT32) || 1 != cnt
+        || n != nmsgs) {
+        fprintf(stderr, "batch of %d came back as %d\n", nmsgs, n);
+        return 1;
+    }
+    return 0;
+}
+
+static int check_requests(void)
+{
+    pmix_data_buffer_t msgs, msg, wire;
+    pmix_proc_t tproc, rproc;
+    pmix_info_t info[2], *rinfo;
+    size_t ninfo, rninfo;
+    int32_t nmsgs = 0;
+    int n, room, nerr = 0;
+
+    PMIX_INFO_LOAD(&info[0], PMIX_REQUIRED_KEY, "unit-key", PMIX_STRING);
+    PMIX_INFO_LOAD(&info[1], PMIX_TIMEOUT, &n, PMIX_INT);
+    PMIX_DATA_BUFFER_CONSTRUCT(&msgs);
+    for (n = 0; n < NREQS; n++) {
+        PMIX_LOAD_PROCID(&tproc, "unit-dmdx", 10 * n);
+        PMIX_DATA_BUFFER_CONSTRUCT(&msg);
+        if (PMIX_SUCCESS
+            != pmix_server_dmdx_pack_request(&msg, &tproc, n + 1, (0 == n % 3) ? NULL : info,
+                                             (size_t) (n % 3))) {
+            fprintf(stderr, "request %d: pack failed\n", n);
+            PMIX_DATA_BUFFER_DESTRUCT(&msg);
+            ++nerr;
+            continue;
+        }
+        nerr += append(&msgs, &nmsgs, &msg);
+    }
+
+    PMIX_DATA_BUFFER_CONSTRUCT(&wire);
+    if (0 != nerr || 0 != frame(&wire, &msgs, nmsgs)) {
+        ++nerr;
+        goto done;
+    }
+    for (n = 0; n < nmsgs; n++) {
+        if (PMIX_SUCCESS
+            != pmix_server_dmdx_unpack_request(&wire, &rproc, &room, &rinfo, &rninfo)) {
+            fprintf(stderr, "request %d: unpack failed\n", n);
+            ++nerr;
+            break;
+        }
+        PMIX_LOAD_PROCID(&tproc, "unit-dmdx", 10 * n);
+        ninfo = (size_t) (n % 3);
+        if (!PMIX_CHECK_PROCID(&rproc, &tproc) || n + 1 != room || ninfo != rninfo) {
+            fprintf(stderr, "request %d: proc %s:%u room %d ninfo %lu\n", n, rproc.nspace,
+                    rproc.rank, room, (unsigned long) rninfo);
+            ++nerr;
+        } else if (0 < rninfo
+                   && (!PMIX_CHECK_KEY(&rinfo[0], PMIX_REQUIRED_KEY)
+                       || 0 != strcmp(rinfo[0].value.data.string, "unit-key"))) {
+            fprintf(stderr, "request %d: wrong qualifier\n", n);
+            ++nerr;
+        }
+        if (NULL != rinfo) {
+            PMIX_INFO_FREE(rinfo, rninfo);
+        }
+    }
+
+done:
+    PMIX_DATA_BUFFER_DESTRUCT(&wire);
+    PMIX_DATA_BUFFER_DESTRUCT(&msgs);
+    PMIX_INFO_DESTRUCT(&info[0]);
+    PMIX_INFO_DESTRUCT(&info[1]);
+    return nerr;
+}
+
+static int check_responses(void)
+{
+    pmix_data_buffer_t msgs, msg, wire;
+    pmix_proc_t tproc, rproc;
+    pmix_status_t status;
+    char *data, *rdata;
+    size_t sz, rsz;
+    int32_t nmsgs = 0;
+    int n, room, nerr = 0;
+
+    data = (char *) malloc(sizes[NRESPS - 1]);
+    for (sz = 0; sz < sizes[NRESPS - 1]; sz++) {
+        data[sz] = (char) (sz * 7);
+    }
+    PMIX_DATA_BUFFER_CONSTRUCT(&msgs);
+    for (n = 0; n < NRESPS; n++) {
+        PMIX_LOAD_PROCID(&tproc, "unit-dmdx", n);
+        PMIX_DATA_BUFFER_CONSTRUCT(&msg);
+        if (PMIX_SUCCESS
+            != pmix_server_dmdx_pack_response(&msg, statuses[n], &tproc, 100 + n,
+                                              (0 == sizes[n]) ? NULL : data, sizes[n])) {
+            fprintf(stderr, "response %d: pack failed\n", n);
+            PMIX_DATA_BUFFER_DESTRUCT(&msg);
+            ++nerr;
+            continue;
+        }
+        nerr += append(&msgs, &nmsgs, &msg);
+    }
+
+    PMIX_DATA_BUFFER_CONSTRUCT(&wire);
+    if (0 != nerr || 0 != frame(&wire, &msgs, nmsgs)) {
+        ++nerr;
+        goto done;
+    }
+    for (n = 0; n < nmsgs; n++) {
+        if (PMIX_SUCCESS
+            != pmix_server_dmdx_unpack_response(&wire, &status, &rproc, &room, &rdata, &rsz)) {
+            fprintf(stderr, "response %d: unpack failed\n", n);
+            ++nerr;
+            break;
+        }
+        PMIX_LOAD_PROCID(&tproc, "unit-dmdx", n);
+        if (statuses[n] != status || !PMIX_CHECK_PROCID(&rproc, &tproc) || 100 + n != room
+            || sizes[n] != rsz || (0 == rsz) != (NULL == rdata)
+            || (0 < rsz && 0 != memcmp(rdata, data, rsz))) {
+            fprintf(stderr, "response %d: status %d proc %s:%u room %d %lu bytes\n", n, status,
+                    rproc.nspace, rproc.rank, room, (unsigned long) rsz);
+            ++nerr;
+        }
+        free(rdata);
+    }
+    if (wire.unpack_ptr != wire.pack_ptr) {
+        fprintf(stderr, "responses: bytes left over\n");
+        ++nerr;
+    }
+
+done:
+    PMIX_DATA_BUFFER_DESTRUCT(&wire);
+    PMIX_DATA_BUFFER_DESTRUCT(&msgs);
+    free(data);
+    return nerr;
+}
+
+/* a response whose data was cut short must fail rather than
+ * hand back a partial blob */
+static int check_short(void)
+{
+    pmix_data_buffer_t buf;
+    pmix_proc_t tproc, rproc;
+    pmix_status_t status = PMIX_SUCCESS, prc;
+    char byte = 1, *rdata = NULL;
+    size_t sz = 16, rsz;
+    int room = 1;
+
+    PMIX_LOAD_PROCID(&tproc, "unit-dmdx", 0);
+    PMIX_DATA_BUFFER_CONSTRUCT(&buf);
+    PMIx_Data_pack(NULL, &buf, &status, 1, PMIX_STATUS);
+    PMIx_Data_pack(NULL, &buf, &tproc, 1, PMIX_PROC);
+    PMIx_Data_pack(NULL, &buf, &room, 1, PMIX_INT);
+    PMIx_Data_pack(NULL, &buf, &sz, 1, PMIX_SIZE);
+    PMIx_Data_pack(NULL, &buf, &byte, 1, PMIX_BYTE);
+    prc = pmix_server_dmdx_unpack_response(&buf, &status, &rproc, &room, &rdata, &rsz);
+    PMIX_DATA_BUFFER_DESTRUCT(&buf);
+    if (PMIX_SUCCESS == prc || NULL != rdata || 0 != rsz) {
+        fprintf(stderr, "short response: status %d %lu bytes\n", prc, (unsigned long) rsz);
+        free(rdata);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    pmix_proc_t me;
+    pmix_info_t info;
+    int nerr = 0;
+
+    (void) argc;
+    (void) argv;
+
+    /* packing requires the PMIx library, but not a server */
+    PMIX_INFO_LOAD(&info, PMIX_TOOL_DO_NOT_CONNECT, NULL, PMIX_BOOL);
+    if (PMIX_SUCCESS != PMIx_tool_init(&me, &info, 1)) {
+        fprintf(stderr, "dmdx_batch: PMIx_tool_init failed\n");
+        return 1;
+    }
+    nerr += check_requests();
+    nerr += check_responses();
+    nerr += check_short();
+    PMIx_tool_finalize();
+    PMIX_INFO_DESTRUCT(&info);
+    return (0 == nerr) ? 0 : 1;
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2021      Nanook Consulting.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ */
+
+/* Round-trip the daemon failure sets that prperror rbcasts and check
+ * that the header fields survive and that exactly the failed daemons
+ * come back set, including ranks on either side of a word boundary.
+ * An empty set and a set whose bitmap is missing must also unpack
+ * cleanly. Failure sets only exist in builds with fault tolerance */
+
+#include "prte_config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/pmix/pmix-internal.h"
+#if PRTE_ENABLE_FT
+#    include "src/class/prte_bitmap.h"
+#    include "src/mca/propagate/prperror/propagate_prperror.h"
+#endif
+
+#if PRTE_ENABLE_FT
+static const int failed[] = {0, 5, 63, 64, 127, 128, 1000};
+#    define NFAILED ((int) (sizeof(failed) / sizeof(failed[0])))
+
+static bool is_failed(int rank)
+{
+    int n;
+
+    for (n = 0; n < NFAILED; n++) {
+        if (failed[n] == rank) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int check_set(void)
+{
+    prte_bitmap_t bm;
+    pmix_data_buffer_t buf;
+    uint64_t *words = NULL;
+    int32_t nwords = 0;
+    int cbtype = 0, state = 0, n, nerr = 0;
+    pmix_rank_t origin = 0;
+    uint32_t epoch = 0;
+    int rc;
+
+    PRTE_CONSTRUCT(&bm, prte_bitmap_t);
+    for (n = 0; n < NFAILED; n++) {
+        prte_bitmap_set_bit(&bm, failed[n]);
+    }
+    PMIX_DATA_BUFFER_CONSTRUCT(&buf);
+    rc = prte_propagate_prperror_pack_failset(&buf, 7, PRTE_PROC_STATE_COMM_FAILED, 42, 3, &bm);
+    if (PRTE_SUCCESS == rc) {
+        rc = prte_propagate_prperror_unpack_failset(&buf, &cbtype, &state, &origin, &epoch,
+                                                    &words, &nwords);
+    }
+    if (PRTE_SUCCESS != rc) {
+        fprintf(stderr, "failure set: rc %d\n", rc);
+        ++nerr;
+        goto done;
+    }
+    if (7 != cbtype || PRTE_PROC_STATE_COMM_FAILED != state || 42 != origin || 3 != epoch) {
+        fprintf(stderr, "failure set: cbtype %d state %d origin %u epoch %u\n", cbtype, state,
+                origin, epoch);
+        ++nerr;
+    }
+    if (bm.array_size != nwords || NULL == words) {
+        fprintf(stderr, "failure set: %d words, want %d\n", nwords, bm.array_size);
+        ++nerr;
+        goto done;
+    }
+    for (n = 0; n < 64 * nwords; n++) {
+        if (is_failed(n) != (0 != (words[n / 64] & (1ULL << (n % 64))))) {
+            fprintf(stderr, "failure set: rank %d is %s\n", n, is_failed(n) ? "missing" : "extra");
+            ++nerr;
+        }
+    }
+
+done:
+    free(words);
+    PMIX_DATA_BUFFER_DESTRUCT(&buf);
+    PRTE_DESTRUCT(&bm);
+    return nerr;
+}
+
+static int check_empty(void)
+{
+    prte_bitmap_t bm;
+    pmix_data_buffer_t buf;
+    uint64_t *words = NULL;
+    int32_t nwords = -1;
+    int cbtype, state, rc;
+    pmix_rank_t origin;
+    uint32_t epoch;
+
+    PRTE_CONSTRUCT(&bm, prte_bitmap_t);
+    PMIX_DATA_BUFFER_CONSTRUCT(&buf);
+    rc = prte_propagate_prperror_pack_failset(&buf, 7, PRTE_PROC_STATE_COMM_FAILED, 0, 1, &bm);
+    if (PRTE_SUCCESS == rc) {
+        rc = prte_propagate_prperror_unpack_failset(&buf, &cbtype, &state, &origin, &epoch,
+                                                    &words, &nwords);
+    }
+    PMIX_DATA_BUFFER_DESTRUCT(&buf);
+    PRTE_DESTRUCT(&bm);
+    if (PRTE_SUCCESS != rc || 0 != nwords || NULL != words) {
+        fprintf(stderr, "empty set: rc %d nwords %d\n", rc, nwords);
+        free(words);
+        return 1;
+    }
+    return 0;
+}
+
+/* a set that claims more words than it carries must not unpack */
+static int check_short(void)
+{
+    pmix_data_buffer_t buf;
+    uint64_t *words = NULL, word = 1;
+    int32_t nwords = 2;
+    int cbtype = 7, state = PRTE_PROC_STATE_COMM_FAILED, rc;
+    pmix_rank_t origin = 1;
+    uint32_t epoch = 1;
+
+    PMIX_DATA_BUFFER_CONSTRUCT(&buf);
+    PMIx_Data_pack(NULL, &buf, &cbtype, 1, PMIX_INT);
+    PMIx_Data_pack(NULL, &buf, &state, 1, PMIX_INT);
+    PMIx_Data_pack(NULL, &buf, &origin, 1, PMIX_PROC_RANK);
+    PMIx_Data_pack(NULL, &buf, &epoch, 1, PMIX_UINT32);
+    PMIx_Data_pack(NULL, &buf, &nwords, 1, PMIX_INT32);
+    PMIx_Data_pack(NULL, &buf, &word, 1, PMIX_UINT64);
+    rc = prte_propagate_prperror_unpack_failset(&buf, &cbtype, &state, &origin, &epoch, &words,
+                                                &nwords);
+    PMIX_DATA_BUFFER_DESTRUCT(&buf);
+    if (PRTE_SUCCESS == rc || 0 != nwords || NULL != words) {
+        fprintf(stderr, "short set: rc %d nwords %d\n", rc, nwords);
+        free(words);
+        return 1;
+    }
+    return 0;
+}
+#endif
+
+int main(int argc, char **argv)
+{
+#if PRTE_ENABLE_FT
+    pmix_proc_t me;
+    pmix_info_t info;
+    int nerr = 0;
+#endif
+
+    (void) argc;
+    (void) argv;
+
+#if PRTE_ENABLE_FT
+    /* packing requires the PMIx library, but not a server */
+    PMIX_INFO_LOAD(&info, PMIX_TOOL_DO_NOT_CONNECT, NULL, PMIX_BOOL);
+    if (PMIX_SUCCESS != PMIx_tool_init(&me, &info, 1)) {
+        fprintf(stderr, "failset: PMIx_tool_init failed\n");
+        return 1;
+    }
+    nerr += check_set();
+    nerr += check_empty();
+    nerr += check_short();
+    PMIx_tool_finalize();
+    PMIX_INFO_DESTRUCT(&info);
+    return (0 == nerr) ? 0 : 1;
+#else
+    /* tell automake to skip us */
+    return 77;
+#endif
+}
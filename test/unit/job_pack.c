@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2021      Nanook Consulting.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ */
+
+/* Round-trip fully described jobs through prte_job_pack/unpack and
+ * check that every proc comes back with the same fields - both when
+ * the ranks are simply 0..n-1 and only implied, and when they have
+ * to be sent - and that only the global proc attributes travel */
+
+#include "prte_config.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "src/pmix/pmix-internal.h"
+#include "src/runtime/prte_globals.h"
+#include "src/util/attr.h"
+
+static prte_job_t *make_job(int nprocs, int stride)
+{
+    prte_job_t *job = PRTE_NEW(prte_job_t);
+    prte_proc_t *p;
+    int32_t nr;
+    int j;
+
+    PMIX_LOAD_NSPACE(job->nspace, "unit-job");
+    job->num_procs = nprocs;
+    job->version = 7;
+    prte_set_attribute(&job->attributes, PRTE_JOB_FULLY_DESCRIBED, PRTE_ATTR_GLOBAL, NULL,
+                       PMIX_BOOL);
+    for (j = 0; j < nprocs; j++) {
+        p = PRTE_NEW(prte_proc_t);
+        /* a stride other than 1 makes the ranks explicit */
+        PMIX_LOAD_PROCID(&p->name, job->nspace, (pmix_rank_t)(j * stride));
+        p->parent = j / 16;
+        p->local_rank = j % 16;
+        p->node_rank = (j % 16) + 1;
+        p->state = (0 == j % 100) ? PRTE_PROC_STATE_RUNNING : PRTE_PROC_STATE_INIT;
+        p->app_idx = (j < nprocs / 3) ? 0 : 1;
+        p->app_rank = (j < nprocs / 3) ? j : j - nprocs / 3;
+        if (0 == j % 97) {
+            prte_set_attribute(&p->attributes, PRTE_PROC_CPU_BITMAP, PRTE_ATTR_GLOBAL, "0-3",
+                               PMIX_STRING);
+        }
+        if (0 == j % 194) {
+            nr = j;
+            prte_set_attribute(&p->attributes, PRTE_PROC_NRESTARTS, PRTE_ATTR_GLOBAL, &nr,
+                               PMIX_INT32);
+            /* local attributes must not be sent */
+            prte_set_attribute(&p->attributes, PRTE_PROC_NOBARRIER, PRTE_ATTR_LOCAL, NULL,
+                               PMIX_BOOL);
+        }
+        prte_pointer_array_set_item(job->procs, j, p);
+    }
+    return job;
+}
+
+static int check_proc(prte_proc_t *a, prte_proc_t *b)
+{
+    char *sa = NULL, *sb = NULL;
+    int32_t na = 0, nb = 0, *nptr;
+    int rc = 0;
+
+    if (NULL == b || !PMIX_CHECK_PROCID(&a->name, &b->name) || a->parent != b->parent
+        || a->local_rank != b->local_rank || a->node_rank != b->node_rank || a->state != b->state
+        || a->app_idx != b->app_idx || a->app_rank != b->app_rank) {
+        return 1;
+    }
+    if (prte_get_attribute(&b->attributes, PRTE_PROC_NOBARRIER, NULL, PMIX_BOOL)) {
+        return 1;
+    }
+    if (prte_get_attribute(&a->attributes, PRTE_PROC_CPU_BITMAP, (void **) &sa, PMIX_STRING)
+        != prte_get_attribute(&b->attributes, PRTE_PROC_CPU_BITMAP, (void **) &sb, PMIX_STRING)
+        || (NULL != sa && (NULL == sb || 0 != strcmp(sa, sb)))) {
+        rc = 1;
+    }
+    free(sa);
+    free(sb);
+    nptr = &na;
+    if (prte_get_attribute(&a->attributes, PRTE_PROC_NRESTARTS, (void **) &nptr, PMIX_INT32)) {
+        nptr = &nb;
+        if (!prte_get_attribute(&b->attributes, PRTE_PROC_NRESTARTS, (void **) &nptr, PMIX_INT32)
+            || na != nb) {
+            rc = 1;
+        }
+    }
+    return rc;
+}
+
+static int round_trip(const char *name, int nprocs, int stride)
+{
+    prte_job_t *job, *out = NULL;
+    pmix_data_buffer_t buf;
+    prte_proc_t *p;
+    int j, rc, nerr = 0;
+
+    job = make_job(nprocs, stride);
+    PMIX_DATA_BUFFER_CONSTRUCT(&buf);
+    rc = prte_job_pack(&buf, job);
+    if (PRTE_SUCCESS == rc) {
+        rc = prte_job_unpack(&buf, &out);
+    }
+    if (PRTE_SUCCESS != rc) {
+        fprintf(stderr, "%s: pack/unpack failed: %d\n", name, rc);
+        ++nerr;
+        goto done;
+    }
+    if (!PMIX_CHECK_NSPACE(out->nspace, job->nspace) || out->num_procs != job->num_procs
+        || out->version != job->version) {
+        fprintf(stderr, "%s: job fields differ\n", name);
+        ++nerr;
+    }
+    if (out->procs->number_free != out->procs->size - nprocs) {
+        fprintf(stderr, "%s: got %d procs, want %d\n", name,
+                out->procs->size - out->procs->number_free, nprocs);
+        ++nerr;
+        goto done;
+    }
+    for (j = 0; j < nprocs; j++) {
+        p = (prte_proc_t *) prte_pointer_array_get_item(job->procs, j);
+        if (check_proc(p, (prte_proc_t *) prte_pointer_array_get_item(out->procs, j))) {
+            fprintf(stderr, "%s: proc %d differs\n", name, j);
+            ++nerr;
+            break;
+        }
+    }
+
+done:
+    PMIX_DATA_BUFFER_DESTRUCT(&buf);
+    PRTE_RELEASE(job);
+    if (NULL != out) {
+        PRTE_RELEASE(out);
+    }
+    return nerr;
+}
+
+int main(int argc, char **argv)
+{
+    pmix_proc_t me;
+    pmix_info_t info;
+    int nerr = 0;
+
+    (void) argc;
+    (void) argv;
+
+    /* packing PMIx values requires the PMIx library, but
+     * not a connection to a server */
+    PMIX_INFO_LOAD(&info, PMIX_TOOL_DO_NOT_CONNECT, NULL, PMIX_BOOL);
+    if (PMIX_SUCCESS != PMIx_tool_init(&me, &info, 1)) {
+        fprintf(stderr, "job_pack: PMIx_tool_init failed\n");
+        return 1;
+    }
+
+    nerr += round_trip("implicit ranks", 1000, 1);
+    nerr += round_trip("explicit ranks", 1000, 3);
+    nerr += round_trip("single proc", 1, 1);
+
+    PMIx_tool_finalize();
+    PMIX_INFO_DESTRUCT(&info);
+    return (0 == nerr) ? 0 : 1;
+}
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2021      Nanook Consulting.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ */
+
+/* Add the children of two jobs to prte_local_children in interleaved
+ * order and check that each job's index of its local children and
+ * each child's local_index stay in step with the global array as the
+ * children of one job are removed and new ones take their slots */
+
+#include "prte_config.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "src/runtime/prte_globals.h"
+
+#define NCHILD 100
+
+static prte_job_t *make_job(const char *nspace)
+{
+    prte_job_t *job = PRTE_NEW(prte_job_t);
+
+    PMIX_LOAD_NSPACE(job->nspace, nspace);
+    job->num_procs = NCHILD;
+    return job;
+}
+
+static prte_proc_t *add_child(prte_job_t *job, int rank)
+{
+    prte_proc_t *p = PRTE_NEW(prte_proc_t);
+
+    PMIX_LOAD_PROCID(&p->name, job->nspace, rank);
+    prte_pointer_array_set_item(job->procs, rank, p);
+    if (PRTE_SUCCESS != prte_add_local_child(job, p)) {
+        return NULL;
+    }
+    return p;
+}
+
+/* every child of the job must be in the job's index in rank order,
+ * be where its local_index says in the global array, and be held
+ * by both the job and the global array */
+static int check_job(const char *what, prte_job_t *job, int nchild)
+{
+    prte_proc_t *p;
+    int n, nerr = 0;
+
+    for (n = 0; n < job->local_children.size; n++) {
+        p = (prte_proc_t *) prte_pointer_array_get_item(&job->local_children, n);
+        if (n >= nchild) {
+            if (NULL != p) {
+                fprintf(stderr, "%s: extra child at %d\n", what, n);
+                ++nerr;
+            }
+            continue;
+        }
+        if (NULL == p || !PMIX_CHECK_NSPACE(p->name.nspace, job->nspace)
+            || (pmix_rank_t) n != p->name.rank) {
+            fprintf(stderr, "%s: wrong child at %d\n", what, n);
+            ++nerr;
+            continue;
+        }
+        if (0 > p->local_index || p != prte_pointer_array_get_item(prte_local_children,
+                                                                   p->local_index)) {
+            fprintf(stderr, "%s: rank %d has local_index %d\n", what, n, p->local_index);
+            ++nerr;
+        }
+        if (!PRTE_FLAG_TEST(p, PRTE_PROC_FLAG_LOCAL) || 2 != p->super.super.obj_reference_count) {
+            fprintf(stderr, "%s: rank %d has refcount %d\n", what, n,
+                    (int) p->super.super.obj_reference_count);
+            ++nerr;
+        }
+    }
+    if (n < nchild) {
+        fprintf(stderr, "%s: only %d of %d children\n", what, n, nchild);
+        ++nerr;
+    }
+    return nerr;
+}
+
+/* after removal the procs are only held by their job */
+static int check_removed(const char *what, prte_job_t *job)
+{
+    prte_proc_t *p;
+    int n, nerr = 0;
+
+    if (NULL != prte_pointer_array_get_item(&job->local_children, 0)) {
+        fprintf(stderr, "%s: index not emptied\n", what);
+        ++nerr;
+    }
+    for (n = 0; n < NCHILD; n++) {
+        p = (prte_proc_t *) prte_pointer_array_get_item(job->procs, n);
+        if (-1 != p->local_index || 1 != p->super.super.obj_reference_count) {
+            fprintf(stderr, "%s: rank %d has local_index %d refcount %d\n", what, n,
+                    p->local_index, (int) p->super.super.obj_reference_count);
+            ++nerr;
+        }
+    }
+    for (n = 0; n < prte_local_children->size; n++) {
+        p = (prte_proc_t *) prte_pointer_array_get_item(prte_local_children, n);
+        if (NULL != p && PMIX_CHECK_NSPACE(p->name.nspace, job->nspace)) {
+            fprintf(stderr, "%s: rank %u left at %d\n", what, p->name.rank, n);
+            ++nerr;
+        }
+    }
+    return nerr;
+}
+
+int main(int argc, char **argv)
+{
+    prte_job_t *a, *b, *c;
+    prte_proc_t *p;
+    int n, nerr = 0;
+
+    (void) argc;
+    (void) argv;
+
+    prte_local_children = PRTE_NEW(prte_pointer_array_t);
+    prte_pointer_array_init(prte_local_children, 1, PRTE_GLOBAL_ARRAY_MAX_SIZE, 1);
+
+    a = make_job("unit-a");
+    b = make_job("unit-b");
+    for (n = 0; n < NCHILD; n++) {
+        if (NULL == add_child(a, n) || NULL == add_child(b, n)) {
+            fprintf(stderr, "add_child %d failed\n", n);
+            return 1;
+        }
+    }
+    nerr += check_job("a", a, NCHILD);
+    nerr += check_job("b", b, NCHILD);
+
+    /* taking out one job leaves the other alone */
+    prte_remove_local_children(a);
+    nerr += check_removed("a removed", a);
+    nerr += check_job("b after a removed", b, NCHILD);
+
+    /* doing it again is harmless */
+    prte_remove_local_children(a);
+    nerr += check_removed("a removed twice", a);
+
+    /* a new job takes the freed slots */
+    c = make_job("unit-c");
+    for (n = 0; n < NCHILD; n++) {
+        if (NULL == (p = add_child(c, n))) {
+            fprintf(stderr, "add_child c %d failed\n", n);
+            return 1;
+        }
+        if (2 * NCHILD <= p->local_index) {
+            fprintf(stderr, "c rank %d not in a freed slot (%d)\n", n, p->local_index);
+            ++nerr;
+        }
+    }
+    nerr += check_job("c", c, NCHILD);
+    nerr += check_job("b after c added", b, NCHILD);
+
+    prte_remove_local_children(b);
+    prte_remove_local_children(c);
+    nerr += check_removed("b removed", b);
+    nerr += check_removed("c removed", c);
+    for (n = 0; n < prte_local_children->size; n++) {
+        if (NULL != prte_pointer_array_get_item(prte_local_children, n)) {
+            fprintf(stderr, "slot %d still in use\n", n);
+            ++nerr;
+        }
+    }
+
+    PRTE_RELEASE(a);
+    PRTE_RELEASE(b);
+    PRTE_RELEASE(c);
+    PRTE_RELEASE(prte_local_children);
+    return (0 == nerr) ? 0 : 1;
+}
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2021      Nanook Consulting.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ */
+
+/* Round-trip the run-length encoded proc locations that the launch
+ * message carries for prior jobs, and check that the receiver ends
+ * up with every proc on the node of its daemon, counting the procs
+ * that moved */
+
+#include "prte_config.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "src/mca/odls/base/odls_private.h"
+#include "src/pmix/pmix-internal.h"
+#include "src/runtime/prte_globals.h"
+
+#define NDAEMONS 8
+#define NPROCS   1000
+
+static prte_job_t *make_daemons(void)
+{
+    prte_job_t *daemons = PRTE_NEW(prte_job_t);
+    prte_proc_t *dmn;
+    prte_node_t *node;
+    int n;
+
+    PMIX_LOAD_NSPACE(daemons->nspace, "unit-dvm");
+    daemons->num_procs = NDAEMONS;
+    for (n = 0; n < NDAEMONS; n++) {
+        node = PRTE_NEW(prte_node_t);
+        prte_asprintf(&node->name, "node%d", n);
+        dmn = PRTE_NEW(prte_proc_t);
+        PMIX_LOAD_PROCID(&dmn->name, daemons->nspace, n);
+        dmn->node = node;
+        prte_pointer_array_set_item(daemons->procs, n, dmn);
+    }
+    return daemons;
+}
+
+/* place ranks in blocks of 16 per daemon, or round-robin */
+static pmix_rank_t daemon_of(int rank, bool cyclic)
+{
+    return cyclic ? (pmix_rank_t)(rank % NDAEMONS) : (pmix_rank_t)((rank / 16) % NDAEMONS);
+}
+
+static prte_job_t *make_job(prte_job_t *daemons, bool cyclic, bool with_procs)
+{
+    prte_job_t *job = PRTE_NEW(prte_job_t);
+    prte_proc_t *p, *dmn;
+    int j;
+
+    PMIX_LOAD_NSPACE(job->nspace, "unit-job");
+    job->num_procs = NPROCS;
+    for (j = 0; j < NPROCS && with_procs; j++) {
+        p = PRTE_NEW(prte_proc_t);
+        PMIX_LOAD_PROCID(&p->name, job->nspace, j);
+        p->parent = daemon_of(j, cyclic);
+        dmn = (prte_proc_t *) prte_pointer_array_get_item(daemons->procs, p->parent);
+        PRTE_RETAIN(dmn->node);
+        p->node = dmn->node;
+        prte_pointer_array_set_item(job->procs, j, p);
+    }
+    return job;
+}
+
+static int check_job(const char *name, prte_job_t *job, prte_job_t *daemons, bool cyclic)
+{
+    prte_proc_t *p, *dmn;
+    int j;
+
+    for (j = 0; j < NPROCS; j++) {
+        p = (prte_proc_t *) prte_pointer_array_get_item(job->procs, j);
+        dmn = (prte_proc_t *) prte_pointer_array_get_item(daemons->procs, daemon_of(j, cyclic));
+        if (NULL == p || p->name.rank != (pmix_rank_t) j || p->node != dmn->node
+            || p->parent != dmn->name.rank) {
+            fprintf(stderr, "%s: proc %d is not on %s\n", name, j, dmn->node->name);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    prte_job_t *daemons, *src, *dst;
+    pmix_data_buffer_t buf;
+    pmix_proc_t me;
+    pmix_info_t info;
+    int32_t nruns, cnt;
+    int j, rc, nmoved, nerr = 0;
+
+    (void) argc;
+    (void) argv;
+
+    /* packing requires the PMIx library, but not a server */
+    PMIX_INFO_LOAD(&info, PMIX_TOOL_DO_NOT_CONNECT, NULL, PMIX_BOOL);
+    if (PMIX_SUCCESS != PMIx_tool_init(&me, &info, 1)) {
+        fprintf(stderr, "locations: PMIx_tool_init failed\n");
+        return 1;
+    }
+    daemons = make_daemons();
+
+    /* a receiver that has never seen the job gets all of its procs */
+    src = make_job(daemons, false, true);
+    dst = make_job(daemons, false, false);
+    PMIX_DATA_BUFFER_CONSTRUCT(&buf);
+    rc = prte_odls_base_pack_locations(&buf, src);
+    nmoved = 0;
+    if (PRTE_SUCCESS == rc) {
+        rc = prte_odls_base_unpack_locations(&buf, dst, daemons, &nmoved);
+    }
+    if (PRTE_SUCCESS != rc || 0 != nmoved) {
+        fprintf(stderr, "new job: rc %d nmoved %d\n", rc, nmoved);
+        ++nerr;
+    } else {
+        nerr += check_job("new job", dst, daemons, false);
+    }
+    PMIX_DATA_BUFFER_DESTRUCT(&buf);
+
+    /* blocks of 16 ranks are one run each */
+    PMIX_DATA_BUFFER_CONSTRUCT(&buf);
+    (void) prte_odls_base_pack_locations(&buf, src);
+    cnt = 1;
+    rc = PMIx_Data_unpack(NULL, &buf, &nruns, &cnt, PMIX_INT32);
+    if (PMIX_SUCCESS != rc || (NPROCS + 15) / 16 != nruns) {
+        fprintf(stderr, "block placement: %d runs, want %d\n", nruns, (NPROCS + 15) / 16);
+        ++nerr;
+    }
+    PMIX_DATA_BUFFER_DESTRUCT(&buf);
+    PRTE_RELEASE(src);
+
+    /* moving the job to a round-robin placement moves every proc
+     * that is not on the same daemon under both */
+    src = make_job(daemons, true, true);
+    PMIX_DATA_BUFFER_CONSTRUCT(&buf);
+    rc = prte_odls_base_pack_locations(&buf, src);
+    nmoved = 0;
+    if (PRTE_SUCCESS == rc) {
+        rc = prte_odls_base_unpack_locations(&buf, dst, daemons, &nmoved);
+    }
+    if (PRTE_SUCCESS != rc) {
+        fprintf(stderr, "moved job: rc %d\n", rc);
+        ++nerr;
+    } else {
+        nerr += check_job("moved job", dst, daemons, true);
+        for (j = 0; j < NPROCS; j++) {
+            if (daemon_of(j, false) != daemon_of(j, true)) {
+                --nmoved;
+            }
+        }
+        if (0 != nmoved) {
+            fprintf(stderr, "moved job: nmoved off by %d\n", nmoved);
+            ++nerr;
+        }
+    }
+    PMIX_DATA_BUFFER_DESTRUCT(&buf);
+    PRTE_RELEASE(src);
+    PRTE_RELEASE(dst);
+
+    PRTE_RELEASE(daemons);
+    PMIx_tool_finalize();
+    PMIX_INFO_DESTRUCT(&info);
+    return (0 == nerr) ? 0 : 1;
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2021      Nanook Consulting.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ */
+
+/* Check the parsing of the modex prefetch specs accepted by
+ * prun --prefetch and PRTE_PMIX_DMODEX_PREFETCH */
+
+#include "prte_config.h"
+
+#include <stdio.h>
+
+#include "constants.h"
+#include "src/prted/pmix/pmix_server_internal.h"
+
+static const struct {
+    const char *spec;
+    int rc;
+    int type;
+    int k;
+} cases[] = {
+    {"ranks:1", PRTE_SUCCESS, PRTE_PMIX_PREFETCH_RANKS, 1},
+    {"ranks:16", PRTE_SUCCESS, PRTE_PMIX_PREFETCH_RANKS, 16},
+    {"RANKS:3", PRTE_SUCCESS, PRTE_PMIX_PREFETCH_RANKS, 3},
+    {"nodes:4", PRTE_SUCCESS, PRTE_PMIX_PREFETCH_NODES, 4},
+    {"Nodes:2147483647", PRTE_SUCCESS, PRTE_PMIX_PREFETCH_NODES, 2147483647},
+    {"ranks:0", PRTE_ERR_BAD_PARAM, 0, 0},
+    {"ranks:-2", PRTE_ERR_BAD_PARAM, 0, 0},
+    {"ranks:", PRTE_ERR_BAD_PARAM, 0, 0},
+    {"ranks:4x", PRTE_ERR_BAD_PARAM, 0, 0},
+    {"ranks: 4 ", PRTE_ERR_BAD_PARAM, 0, 0},
+    {"nodes:2147483648", PRTE_ERR_BAD_PARAM, 0, 0},
+    {"ranks4", PRTE_ERR_BAD_PARAM, 0, 0},
+    {"slots:4", PRTE_ERR_BAD_PARAM, 0, 0},
+    {"", PRTE_ERR_BAD_PARAM, 0, 0},
+};
+
+int main(int argc, char **argv)
+{
+    size_t n;
+    int rc, type, k, nerr = 0;
+
+    (void) argc;
+    (void) argv;
+
+    for (n = 0; n < sizeof(cases) / sizeof(cases[0]); n++) {
+        type = k = 0;
+        rc = pmix_server_prefetch_parse(cases[n].spec, &type, &k);
+        if (rc != cases[n].rc
+            || (PRTE_SUCCESS == rc && (type != cases[n].type || k != cases[n].k))) {
+            fprintf(stderr,
+                    "prefetch spec \"%s\": got rc %d type %d k %d, want rc %d type %d k %d\n",
+                    cases[n].spec, rc, type, k, cases[n].rc, cases[n].type, cases[n].k);
+            ++nerr;
+        }
+    }
+    return (0 == nerr) ? 0 : 1;
+}